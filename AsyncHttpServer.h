@@ -0,0 +1,813 @@
+// AsyncHttpServer.h — Ereignisgesteuerter HTTP/1.1-Server auf ESPAsyncTCP
+//
+// Ersetzt ESP8266WebServer, der einen Client nach dem anderen blockierend aus
+// loop() bedient (ein langsames Handy bremst Rendering und MQTT aus).
+//   - Mehrere Verbindungen gleichzeitig (MAX_CONNECTIONS)
+//   - Empfang in den lwIP-Callbacks: dort wird nur gepuffert, kein Anwendungscode
+//   - handleClient() in loop() ruft für fertig empfangene Requests den Handler auf
+//     und schiebt Antworten nur so weit in den TCP-Sendepuffer, wie Platz ist.
+//     Große Antworten (Web-UI aus PROGMEM, Dateien) laufen über viele
+//     loop()-Durchläufe, ohne zu blockieren.
+//   - Handler-API wie ESP8266WebServer (on/arg/hasArg/header/send/send_P/
+//     sendHeader/setContentLength/sendContent/streamFile), die Routen im Sketch
+//     bleiben unverändert. arg("plain") ist der Request-Body.
+//   - Keep-Alive: HTTP/1.1-Verbindungen bleiben nach der Antwort offen (Keep-Alive
+//     und SSE-Streams zusammen max. MAX_KEEPALIVE, Leerlauf-Timeout
+//     KEEPALIVE_TIMEOUT_MS). Sind trotzdem alle Slots belegt, schließt accept()
+//     die am längsten ruhende Keep-Alive-Verbindung, statt den neuen Client
+//     abzuweisen. Requests, die während einer laufenden Antwort eintreffen
+//     (Pipelining), werden gepuffert und danach der Reihe nach beantwortet.
+//   - beginStream(): Verbindung bleibt nach dem Handler offen (Server-Sent Events)
+//   - Routen mit "*" am Ende passen auf das Präfix, der Rest steht in pathArg()
+//
+// send_P() und streamFile() beenden die Antwort (danach kein sendContent()).
+// Dynamisch erzeugte Antworten, die nicht in den TCP-Puffer passen, werden bis
+// MAX_QUEUED_BYTES im Heap gepuffert; darüber wartet sendContent() kurz auf ACKs.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef ASYNC_HTTP_SERVER_H
+#define ASYNC_HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <ESPAsyncTCP.h>
+#include <FS.h>
+#include <ctype.h>
+#include <functional>
+
+enum HTTPMethod : uint8_t { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+const size_t CONTENT_LENGTH_UNKNOWN = (size_t)-1;
+const size_t CONTENT_LENGTH_NOT_SET = (size_t)-2;
+
+class AsyncHttpServer {
+ public:
+  typedef std::function<void()> Handler;
+
+  static const uint8_t MAX_CONNECTIONS = 6;
+  static const uint8_t MAX_ROUTES = 40;
+  static const size_t MAX_HEADER_BYTES = 2048;
+  static const size_t MAX_BODY_BYTES = 4096;
+  static const size_t MAX_QUEUED_BYTES = 4096;         // Erzeugte Antwort, die noch nicht in den TCP-Puffer passt
+  static const unsigned long REQUEST_TIMEOUT_MS = 10000;
+  static const unsigned long SEND_TIMEOUT_MS = 30000;  // Ohne Fortschritt beim Senden
+  static const unsigned long DRAIN_TIMEOUT_MS = 2000;
+  static const uint8_t MAX_KEEPALIVE = 4;                // Offen gehaltene Slots inkl. SSE-Streams
+  static const uint8_t MAX_REQUESTS_PER_CONNECTION = 100;
+  static const unsigned long KEEPALIVE_TIMEOUT_MS = 5000;  // Leerlauf zwischen zwei Requests
+
+  // Handle auf eine per beginStream() übernommene Verbindung
+  struct StreamId {
+    uint8_t slot;
+    uint16_t gen;
+  };
+
+  // Statistik für /api/status und /metrics
+  uint32_t requests = 0;   // Bearbeitete Requests
+  uint32_t rejected = 0;   // Verbindungen abgewiesen (alle Slots belegt)
+  uint8_t peakConnections = 0;
+  uint32_t responses[6] = {};  // Nach Statusklasse: responses[2] = 2xx usw.
+  uint32_t unmatched = 0;       // Requests ohne passende Route
+  uint32_t keepAliveReuses = 0; // Requests auf einer bereits benutzten Verbindung
+  uint32_t keepAliveEvicted = 0; // Ruhende Keep-Alive-Verbindungen für neue Clients geschlossen
+  uint32_t pipelined = 0;       // Davon schon während der vorigen Antwort empfangen
+
+  explicit AsyncHttpServer(uint16_t port) : _server(port) {}
+
+  void begin() {
+    _server.onClient([](void* arg, AsyncClient* c) {
+      static_cast<AsyncHttpServer*>(arg)->accept(c);
+    }, this);
+    _server.setNoDelay(true);
+    _server.begin();
+  }
+
+  void on(const char* uri, Handler handler) { on(uri, HTTP_ANY, handler); }
+
+  // uri = "/effect/*": alle Pfade mit diesem Präfix, Rest per pathArg()
+  void on(const char* uri, HTTPMethod method, Handler handler) {
+    if (_routeCount >= MAX_ROUTES) return;
+    _routes[_routeCount++] = {uri, method, handler, 0};
+  }
+
+  void onNotFound(Handler handler) { _notFound = handler; }
+
+  // Aus loop(): fertige Requests bearbeiten, Antworten weiterschieben, aufräumen
+  void handleClient() {
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+      Conn& c = _conns[i];
+      if (c.state == FREE) continue;
+      if (c.disconnected) {
+        release(c);
+        continue;
+      }
+      unsigned long idle = millis() - c.lastActivity;
+      switch (c.state) {
+        case READING:
+          if (c.served > 0 && c.rx.length() == 0) {
+            // Keep-Alive im Leerlauf: sauber schließen
+            if (idle > KEEPALIVE_TIMEOUT_MS) close(c);
+          } else if (idle > REQUEST_TIMEOUT_MS) {
+            c.client->close(true);
+          }
+          break;
+        case READY:
+          dispatch(i);
+          break;
+        case SENDING:
+          pump(c);
+          if (!pending(c)) {
+            if (c.keepAlive) {
+              nextRequest(c);
+            } else {
+              close(c);
+            }
+          } else if (idle > SEND_TIMEOUT_MS) {
+            c.client->close(true);
+          }
+          break;
+        case STREAM:
+          pump(c);
+          break;
+        case CLOSING:
+          if (idle > REQUEST_TIMEOUT_MS) c.client->close(true);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  // Requests pro Route (für /metrics)
+  uint8_t routeCount() const { return _routeCount; }
+  const char* routeUri(uint8_t i) const { return _routes[i].uri; }
+  uint32_t routeHits(uint8_t i) const { return _routes[i].hits; }
+
+  uint8_t activeConnections() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+      if (_conns[i].state != FREE) n++;
+    }
+    return n;
+  }
+
+  // --- Request (nur innerhalb eines Handlers gültig) ---
+
+  HTTPMethod method() const { return _cur ? _cur->method : HTTP_ANY; }
+
+  String uri() const {
+    return _cur ? substr(_cur->pathStart, _cur->pathLen) : String();
+  }
+
+  // Teil des Pfads hinter dem Präfix einer "*"-Route
+  String pathArg() const {
+    if (!_cur) return String();
+    return substr(_cur->pathStart + _cur->wildcardOffset, _cur->pathLen - _cur->wildcardOffset);
+  }
+
+  bool hasArg(const char* name) const {
+    if (!_cur) return false;
+    if (strcmp(name, "plain") == 0) return _cur->contentLength > 0;
+    return findArg(name, nullptr);
+  }
+
+  String arg(const char* name) const {
+    if (!_cur) return String();
+    if (strcmp(name, "plain") == 0) return substr(_cur->headerLen, _cur->contentLength);
+    String value;
+    findArg(name, &value);
+    return value;
+  }
+
+  // Alle Request-Header bleiben bis zum Ende des Handlers verfügbar
+  String header(const char* name) const {
+    const char* value;
+    size_t len;
+    if (!_cur || !findHeader(*_cur, name, value, len)) return String();
+    return substr(value - _cur->rx.c_str(), len);
+  }
+
+  IPAddress remoteIP() const {
+    return (_cur && _cur->client) ? _cur->client->remoteIP() : IPAddress();
+  }
+
+  bool clientConnected() const {
+    return _cur && !_cur->disconnected && _cur->client->connected();
+  }
+
+  // --- Response ---
+
+  void sendHeader(const char* name, const char* value) {
+    _respHeaders += name;
+    _respHeaders += ": ";
+    _respHeaders += value;
+    _respHeaders += "\r\n";
+  }
+
+  void setContentLength(size_t len) { _contentLength = len; }
+
+  void send(int code, const char* type = nullptr, const char* content = "") {
+    send(code, type, content, strlen(content));
+  }
+
+  void send(int code, const char* type, const String& content) {
+    send(code, type, content.c_str(), content.length());
+  }
+
+  void send(int code, const char* type, const char* content, size_t len) {
+    if (!_cur || _cur->headersSent) return;
+    bool chunked = _contentLength == CONTENT_LENGTH_UNKNOWN;
+    writeHeaders(code, type, chunked ? CONTENT_LENGTH_UNKNOWN : len);
+    if (len > 0) sendContent(content, len);
+    flush(*_cur);
+  }
+
+  void send_P(int code, PGM_P type, PGM_P content) {
+    send_P(code, type, content, strlen_P(content));
+  }
+
+  void send_P(int code, PGM_P type, PGM_P content, size_t len) {
+    if (!_cur || _cur->headersSent) return;
+    writeHeaders(code, type, len);
+    _cur->pgmData = content;
+    _cur->pgmLen = len;
+    _cur->pgmOffset = 0;
+    flush(*_cur);
+  }
+
+  void sendContent(const char* content) { sendContent(content, strlen(content)); }
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+
+  void sendContent(const char* content, size_t len) {
+    if (!_cur || !_cur->headersSent || _cur->chunkEnded) return;
+    if (!_cur->chunked) {
+      writeRaw(*_cur, content, len);
+    } else if (len == 0) {
+      writeRaw(*_cur, "0\r\n\r\n", 5);
+      _cur->chunkEnded = true;
+    } else {
+      char size[12];
+      snprintf(size, sizeof(size), "%x\r\n", (unsigned)len);
+      writeRaw(*_cur, size, strlen(size));
+      writeRaw(*_cur, content, len);
+      writeRaw(*_cur, "\r\n", 2);
+    }
+    flush(*_cur);
+  }
+
+  // Die Datei gehört danach dem Server (wird nach dem Senden geschlossen)
+  size_t streamFile(File& file, const char* type) {
+    if (!_cur || _cur->headersSent) return 0;
+    size_t size = file.size();
+    writeHeaders(200, type, size);
+    _cur->file = file;
+    _cur->hasFile = true;
+    flush(*_cur);
+    return size;
+  }
+
+  // --- Dauerhafte Verbindungen (Server-Sent Events) ---
+
+  // Übernimmt die aktuelle Verbindung: rawHeader wird unverändert gesendet,
+  // danach bleibt sie offen, bis streamClose() oder der Client trennt
+  StreamId beginStream(const char* rawHeader) {
+    if (!_cur || _cur->headersSent) return {0xFF, 0};
+    _cur->headersSent = true;
+    _cur->state = STREAM;
+    _cur->keepAlive = false;
+    _cur->client->setNoDelay(true);
+    responses[2]++;  // rawHeader beginnt mit "HTTP/1.1 200"
+    writeRaw(*_cur, rawHeader, strlen(rawHeader));
+    flush(*_cur);
+    return {(uint8_t)(_cur - _conns), _cur->gen};
+  }
+
+  bool streamConnected(StreamId id) const {
+    const Conn* c = streamConn(id);
+    return c && c->client->connected();
+  }
+
+  // Freier Platz im TCP-Sendepuffer (0 solange noch Daten warten)
+  size_t streamSpace(StreamId id) const {
+    const Conn* c = streamConn(id);
+    if (!c || pending(*c)) return 0;
+    return c->client->space();
+  }
+
+  void streamWrite(StreamId id, const char* data, size_t len) {
+    Conn* c = const_cast<Conn*>(streamConn(id));
+    if (!c) return;
+    writeRaw(*c, data, len);
+    flush(*c);
+  }
+
+  void streamClose(StreamId id) {
+    Conn* c = const_cast<Conn*>(streamConn(id));
+    if (c) c->client->close(true);
+  }
+
+ private:
+  enum State : uint8_t { FREE, READING, READY, SENDING, STREAM, CLOSING };
+
+  struct Conn {
+    AsyncClient* client = nullptr;
+    uint16_t gen = 0;
+    State state = FREE;
+    volatile bool disconnected = false;
+    unsigned long lastActivity = 0;
+
+    // Request (rx enthält Header + Body)
+    String rx;
+    size_t headerLen = 0;
+    size_t contentLength = 0;
+    uint16_t errorCode = 0;     // 413/431 bereits beim Empfang erkannt
+    HTTPMethod method = HTTP_ANY;
+    uint16_t pathStart = 0, pathLen = 0;
+    uint16_t wildcardOffset = 0;  // Länge des Routen-Präfixes ("*"-Routen)
+    uint16_t queryStart = 0, queryLen = 0;
+    bool http10 = false;
+    String pipelined;           // Nächster Request, empfangen während die Antwort läuft
+    uint8_t served = 0;         // Beantwortete Requests auf dieser Verbindung
+    bool keepAlive = false;     // Nach dieser Antwort offen bleiben
+
+    // Response
+    bool headersSent = false;
+    bool chunked = false;
+    bool chunkEnded = false;
+    String txQueue;             // Wartet auf Platz im TCP-Sendepuffer
+    PGM_P pgmData = nullptr;
+    size_t pgmLen = 0;
+    size_t pgmOffset = 0;
+    File file;
+    bool hasFile = false;
+
+    // lwIP-Callback: nur puffern und Vollständigkeit prüfen
+    void receive(const char* data, size_t len) {
+      if (state == STREAM || state == CLOSING || state == FREE) return;
+      lastActivity = millis();
+      if (state != READING) {
+        // Pipelining: rx gehört noch dem laufenden Handler
+        if (pipelined.length() + len > MAX_HEADER_BYTES + MAX_BODY_BYTES) {
+          keepAlive = false;  // Nach der Antwort schließen, Rest verwerfen
+          pipelined = String();
+          return;
+        }
+        pipelined.concat(data, len);
+        return;
+      }
+      if (rx.length() + len > MAX_HEADER_BYTES + MAX_BODY_BYTES) {
+        errorCode = 413;
+        state = READY;
+        return;
+      }
+      rx.concat(data, len);
+      checkComplete();
+    }
+
+    // Setzt READY, sobald Header und Body des ersten Requests in rx vollständig sind
+    void checkComplete() {
+      if (headerLen == 0) {
+        int end = rx.indexOf("\r\n\r\n");
+        if (end < 0) {
+          if (rx.length() > MAX_HEADER_BYTES) {
+            errorCode = 431;
+            state = READY;
+          }
+          return;
+        }
+        headerLen = end + 4;
+        contentLength = 0;
+        const char* value;
+        size_t valueLen;
+        if (findHeader(*this, "Content-Length", value, valueLen)) {
+          contentLength = strtoul(value, nullptr, 10);
+        }
+        if (contentLength > MAX_BODY_BYTES) {
+          errorCode = 413;
+          state = READY;
+          return;
+        }
+      }
+      if (rx.length() >= headerLen + contentLength) state = READY;
+    }
+  };
+
+  struct Route {
+    const char* uri;
+    HTTPMethod method;
+    Handler handler;
+    uint32_t hits;
+  };
+
+  AsyncServer _server;
+  Conn _conns[MAX_CONNECTIONS];
+  Route _routes[MAX_ROUTES];
+  uint8_t _routeCount = 0;
+  Handler _notFound;
+  Conn* _cur = nullptr;          // Request, dessen Handler gerade läuft
+  String _respHeaders;           // sendHeader() bis zum nächsten send()
+  size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+
+  void accept(AsyncClient* client) {
+    Conn* conn = nullptr;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+      if (_conns[i].state == FREE) {
+        conn = &_conns[i];
+        break;
+      }
+    }
+    if (!conn) conn = evictIdleKeepAlive();
+    if (!conn) {
+      rejected++;
+      client->close(true);
+      client->free();
+      delete client;
+      return;
+    }
+    uint16_t gen = conn->gen + 1;
+    *conn = Conn();
+    conn->gen = gen;
+    conn->client = client;
+    conn->state = READING;
+    conn->lastActivity = millis();
+    client->onData([](void* arg, AsyncClient*, void* data, size_t len) {
+      static_cast<Conn*>(arg)->receive(static_cast<const char*>(data), len);
+    }, conn);
+    client->onDisconnect([](void* arg, AsyncClient*) {
+      static_cast<Conn*>(arg)->disconnected = true;
+    }, conn);
+    uint8_t active = activeConnections();
+    if (active > peakConnections) peakConnections = active;
+  }
+
+  // Aus handleClient() bzw. evictIdleKeepAlive(): der Client ist bereits getrennt
+  void release(Conn& c) {
+    if (c.hasFile) c.file.close();
+    delete c.client;
+    uint16_t gen = c.gen;
+    c = Conn();
+    c.gen = gen;
+  }
+
+  void close(Conn& c) {
+    c.state = CLOSING;
+    c.keepAlive = false;
+    c.lastActivity = millis();
+    c.client->close();
+  }
+
+  // Slots, die über die laufende Antwort hinaus belegt bleiben: Keep-Alive und SSE
+  uint8_t heldConnections() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+      if (_conns[i].state == STREAM || (_conns[i].state != FREE && _conns[i].keepAlive)) n++;
+    }
+    return n;
+  }
+
+  // Alle Slots belegt: die am längsten ruhende Keep-Alive-Verbindung (wartet
+  // ohne Daten auf den nächsten Request) abbrechen und ihren Slot freigeben.
+  // Läuft im lwIP-Callback von accept(); abort() löst dort nur noch den
+  // Disconnect-Callback des alten Clients aus, danach ist er frei.
+  Conn* evictIdleKeepAlive() {
+    Conn* oldest = nullptr;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+      Conn& c = _conns[i];
+      if (c.state != READING || c.served == 0 || c.rx.length() > 0 || c.disconnected) continue;
+      if (!oldest || (long)(c.lastActivity - oldest->lastActivity) < 0) oldest = &c;
+    }
+    if (!oldest) return nullptr;
+    oldest->client->close(true);
+    release(*oldest);
+    keepAliveEvicted++;
+    return oldest;
+  }
+
+  // HTTP/1.1: offen, außer "Connection: close"; HTTP/1.0 nur mit "Connection: keep-alive"
+  static bool wantsKeepAlive(const Conn& c) {
+    const char* value;
+    size_t len;
+    bool has = findHeader(c, "Connection", value, len);
+    if (has && len >= 5 && strncasecmp(value, "close", 5) == 0) return false;
+    if (c.http10) return has && len >= 10 && strncasecmp(value, "keep-alive", 10) == 0;
+    return true;
+  }
+
+  // Antwort komplett übergeben: Verbindung für den nächsten Request vorbereiten.
+  // Bereits gepufferte (gepipelinete) Daten werden sofort geprüft.
+  void nextRequest(Conn& c) {
+    if (c.disconnected) return;
+    if (c.hasFile) c.file.close();
+    String rest = c.rx;
+    rest.concat(c.pipelined.c_str(), c.pipelined.length());
+    bool wasPipelined = rest.length() > 0;
+    uint8_t served = c.served;
+    AsyncClient* client = c.client;
+    uint16_t gen = c.gen;
+    c = Conn();
+    c.client = client;
+    c.gen = gen;
+    c.served = served;
+    c.state = READING;
+    c.lastActivity = millis();
+    if (wasPipelined) {
+      c.rx = rest;
+      c.checkComplete();
+      if (c.state == READY) pipelined++;
+    }
+  }
+
+  const Conn* streamConn(StreamId id) const {
+    if (id.slot >= MAX_CONNECTIONS) return nullptr;
+    const Conn& c = _conns[id.slot];
+    if (c.state != STREAM || c.gen != id.gen || c.disconnected) return nullptr;
+    return &c;
+  }
+
+  // Bereits per add() übergebene Daten sofort senden (tcp_output)
+  static void flush(Conn& c) {
+    if (!c.disconnected) c.client->send();
+  }
+
+  static bool pending(const Conn& c) {
+    return c.txQueue.length() > 0 || c.pgmData != nullptr || c.hasFile;
+  }
+
+  String substr(size_t start, size_t len) const {
+    String s;
+    s.concat(_cur->rx.c_str() + start, len);
+    return s;
+  }
+
+  static bool findHeader(const Conn& c, const char* name, const char*& value, size_t& len) {
+    const char* p = strstr(c.rx.c_str(), "\r\n");
+    const char* end = c.rx.c_str() + c.headerLen;
+    size_t nameLen = strlen(name);
+    while (p && p + 2 < end) {
+      p += 2;
+      const char* eol = strstr(p, "\r\n");
+      if (!eol || eol > end) break;
+      if ((size_t)(eol - p) > nameLen && p[nameLen] == ':' && strncasecmp(p, name, nameLen) == 0) {
+        value = p + nameLen + 1;
+        while (*value == ' ') value++;
+        len = eol - value;
+        return true;
+      }
+      p = eol;
+    }
+    return false;
+  }
+
+  // Sucht name in Query-String und (bei Formular-Body) im Body, dekodiert %XX und '+'
+  bool findArg(const char* name, String* out) const {
+    if (findArgIn(_cur->rx.c_str() + _cur->queryStart, _cur->queryLen, name, out)) return true;
+    const char* type;
+    size_t typeLen;
+    if (_cur->contentLength > 0 && findHeader(*_cur, "Content-Type", type, typeLen) &&
+        strncasecmp(type, "application/x-www-form-urlencoded", 33) == 0) {
+      return findArgIn(_cur->rx.c_str() + _cur->headerLen, _cur->contentLength, name, out);
+    }
+    return false;
+  }
+
+  static bool findArgIn(const char* p, size_t len, const char* name, String* out) {
+    const char* end = p + len;
+    size_t nameLen = strlen(name);
+    while (p < end) {
+      const char* amp = (const char*)memchr(p, '&', end - p);
+      if (!amp) amp = end;
+      const char* eq = (const char*)memchr(p, '=', amp - p);
+      const char* keyEnd = eq ? eq : amp;
+      if ((size_t)(keyEnd - p) == nameLen && memcmp(p, name, nameLen) == 0) {
+        if (out && eq) urlDecode(eq + 1, amp - eq - 1, *out);
+        return true;
+      }
+      p = amp + 1;
+    }
+    return false;
+  }
+
+  static void urlDecode(const char* p, size_t len, String& out) {
+    out.reserve(len);
+    for (size_t i = 0; i < len; i++) {
+      char c = p[i];
+      if (c == '+') {
+        c = ' ';
+      } else if (c == '%' && i + 2 < len && isxdigit(p[i + 1]) && isxdigit(p[i + 2])) {
+        char hex[3] = {p[i + 1], p[i + 2], '\0'};
+        c = (char)strtol(hex, nullptr, 16);
+        i += 2;
+      }
+      out += c;
+    }
+  }
+
+  bool parseRequestLine(Conn& c) {
+    const char* s = c.rx.c_str();
+    const char* sp1 = strchr(s, ' ');
+    if (!sp1) return false;
+    const char* sp2 = strchr(sp1 + 1, ' ');
+    const char* eol = strstr(s, "\r\n");
+    if (!sp2 || !eol || sp2 > eol) return false;
+    c.http10 = strncmp(sp2 + 1, "HTTP/1.0", 8) == 0;
+    static const struct { const char* name; HTTPMethod method; } METHODS[] = {
+      {"GET", HTTP_GET}, {"HEAD", HTTP_HEAD}, {"POST", HTTP_POST}, {"PUT", HTTP_PUT},
+      {"PATCH", HTTP_PATCH}, {"DELETE", HTTP_DELETE}, {"OPTIONS", HTTP_OPTIONS}
+    };
+    c.method = HTTP_ANY;
+    for (const auto& m : METHODS) {
+      if ((size_t)(sp1 - s) == strlen(m.name) && strncmp(s, m.name, sp1 - s) == 0) c.method = m.method;
+    }
+    if (c.method == HTTP_ANY) return false;
+    const char* q = (const char*)memchr(sp1 + 1, '?', sp2 - sp1 - 1);
+    c.pathStart = sp1 + 1 - s;
+    c.pathLen = (q ? q : sp2) - (sp1 + 1);
+    c.queryStart = q ? q + 1 - s : 0;
+    c.queryLen = q ? sp2 - q - 1 : 0;
+    return true;
+  }
+
+  bool matchRoute(const char* uri, Conn& c) {
+    size_t n = strlen(uri);
+    const char* path = c.rx.c_str() + c.pathStart;
+    if (n > 0 && uri[n - 1] == '*') {
+      if (c.pathLen < n - 1 || strncmp(uri, path, n - 1) != 0) return false;
+      c.wildcardOffset = n - 1;
+      return true;
+    }
+    return n == c.pathLen && strncmp(uri, path, n) == 0;
+  }
+
+  void dispatch(uint8_t slot) {
+    Conn& c = _conns[slot];
+    _cur = &c;
+    _respHeaders = String();
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    c.state = SENDING;
+    c.lastActivity = millis();
+    requests++;
+    if (c.served > 0) keepAliveReuses++;
+    c.served++;
+    c.keepAlive = false;
+
+    if (c.errorCode) {
+      send(c.errorCode, "text/plain", c.errorCode == 413 ? "Payload Too Large" : "Request Header Fields Too Large");
+    } else if (!parseRequestLine(c)) {
+      send(400, "text/plain", "Bad Request");
+    } else {
+      // HEAD wird wie GET beantwortet (mit Body) — dann nicht offen halten
+      c.keepAlive = c.method != HTTP_HEAD && c.served < MAX_REQUESTS_PER_CONNECTION &&
+                    wantsKeepAlive(c) && heldConnections() < MAX_KEEPALIVE;
+      Route* route = nullptr;
+      for (uint8_t i = 0; i < _routeCount && !route; i++) {
+        Route& r = _routes[i];
+        if ((r.method == HTTP_ANY || r.method == c.method) && matchRoute(r.uri, c)) {
+          route = &r;
+        }
+      }
+      if (route) {
+        route->hits++;
+        route->handler();
+      } else if (_notFound) {
+        unmatched++;
+        _notFound();
+      } else {
+        unmatched++;
+        send(404, "text/plain", "Not found");
+      }
+    }
+
+    // Wie ESP8266WebServer: offene Chunked-Antwort abschließen
+    if (c.chunked && !c.chunkEnded) sendContent("", 0);
+    // Ohne Antwort kann der Client das Ende nicht erkennen → schließen
+    if (!c.headersSent) c.keepAlive = false;
+    // Request-Puffer freigeben, ein evtl. schon empfangener Folge-Request bleibt
+    size_t consumed = c.headerLen + c.contentLength;
+    if (c.keepAlive && consumed < c.rx.length()) {
+      c.rx.remove(0, consumed);
+    } else {
+      c.rx = String();
+    }
+    _respHeaders = String();
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _cur = nullptr;
+    pump(c);
+  }
+
+  static const char* statusText(int code) {
+    switch (code) {
+      case 200: return "OK";
+      case 204: return "No Content";
+      case 304: return "Not Modified";
+      case 400: return "Bad Request";
+      case 404: return "Not Found";
+      case 413: return "Payload Too Large";
+      case 429: return "Too Many Requests";
+      case 431: return "Request Header Fields Too Large";
+      case 500: return "Internal Server Error";
+      case 503: return "Service Unavailable";
+      default:  return "";
+    }
+  }
+
+  void writeHeaders(int code, const char* type, size_t len) {
+    Conn& c = *_cur;
+    char line[96];
+    String head;
+    head.reserve(128 + _respHeaders.length());
+    if (code >= 100 && code < 600) responses[code / 100]++;
+    snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", code, statusText(code));
+    head += line;
+    if (type && code != 304) {
+      head += "Content-Type: ";
+      head += type;
+      head += "\r\n";
+    }
+    if (len == CONTENT_LENGTH_UNKNOWN) {
+      head += "Transfer-Encoding: chunked\r\n";
+      c.chunked = true;
+    } else if (code != 304) {
+      snprintf(line, sizeof(line), "Content-Length: %u\r\n", (unsigned)len);
+      head += line;
+    }
+    if (c.keepAlive) {
+      snprintf(line, sizeof(line), "Connection: keep-alive\r\nKeep-Alive: timeout=%u, max=%u\r\n",
+               (unsigned)(KEEPALIVE_TIMEOUT_MS / 1000), (unsigned)(MAX_REQUESTS_PER_CONNECTION - c.served));
+      head += line;
+    } else {
+      head += "Connection: close\r\n";
+    }
+    head += _respHeaders;
+    head += "\r\n";
+    _respHeaders = String();
+    c.headersSent = true;
+    writeRaw(c, head.c_str(), head.length());
+  }
+
+  // Direkt in den TCP-Sendepuffer, Rest in txQueue (Reihenfolge bleibt erhalten)
+  void writeRaw(Conn& c, const char* data, size_t len) {
+    if (c.disconnected || len == 0) return;
+    if (!pending(c)) {
+      size_t space = c.client->space();
+      size_t n = c.client->add(data, len < space ? len : space, ASYNC_WRITE_FLAG_COPY);
+      data += n;
+      len -= n;
+    }
+    if (len == 0) return;
+    c.txQueue.concat(data, len);
+    if (c.txQueue.length() > MAX_QUEUED_BYTES) drain(c);
+  }
+
+  // Nur für große erzeugte Antworten: kurz auf ACKs warten statt unbegrenzt zu puffern
+  void drain(Conn& c) {
+    unsigned long start = millis();
+    while (c.txQueue.length() > MAX_QUEUED_BYTES / 2 && !c.disconnected &&
+           millis() - start < DRAIN_TIMEOUT_MS) {
+      pump(c);
+      delay(1);
+    }
+    if (c.txQueue.length() > MAX_QUEUED_BYTES) {
+      c.txQueue = String();
+      c.client->close(true);
+      c.disconnected = true;
+    }
+  }
+
+  // Füllt den TCP-Sendepuffer aus txQueue, PROGMEM-Quelle oder Datei
+  void pump(Conn& c) {
+    if (c.disconnected) return;
+    bool added = false;
+    char buf[256];
+    while (c.client->canSend()) {
+      size_t space = c.client->space();
+      size_t n = 0;
+      if (c.txQueue.length() > 0) {
+        n = c.client->add(c.txQueue.c_str(), min(space, (size_t)c.txQueue.length()), ASYNC_WRITE_FLAG_COPY);
+        if (n > 0) c.txQueue.remove(0, n);
+      } else if (c.pgmData) {
+        size_t chunk = min(min(space, sizeof(buf)), c.pgmLen - c.pgmOffset);
+        memcpy_P(buf, c.pgmData + c.pgmOffset, chunk);
+        n = c.client->add(buf, chunk, ASYNC_WRITE_FLAG_COPY);
+        c.pgmOffset += n;
+        if (c.pgmOffset >= c.pgmLen) c.pgmData = nullptr;
+      } else if (c.hasFile) {
+        size_t chunk = c.file.read((uint8_t*)buf, min(space, sizeof(buf)));
+        n = chunk > 0 ? c.client->add(buf, chunk, ASYNC_WRITE_FLAG_COPY) : 0;
+        if (n < chunk) c.txQueue.concat(buf + n, chunk - n);  // Rest zuerst beim nächsten Mal
+        if (chunk == 0 || c.file.available() <= 0) {
+          c.file.close();
+          c.hasFile = false;
+        }
+      } else {
+        break;
+      }
+      if (n == 0) break;
+      added = true;
+    }
+    if (added) {
+      c.client->send();
+      c.lastActivity = millis();
+    }
+  }
+};
+
+#endif  // ASYNC_HTTP_SERVER_H
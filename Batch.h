@@ -0,0 +1,129 @@
+// Batch.h — Batch-Änderungen prüfen und vormerken (POST /api/batch, MQTT-JSON)
+//
+// Ein JSON-Objekt mit beliebig vielen Einstellungen. stage() prüft alles zuerst
+// (ein ungültiger Key verwirft den ganzen Batch) und merkt die Werte in einem
+// Pending<N> vor; applyPendingBatch() im Sketch übernimmt sie in loop() an der
+// nächsten Frame-Grenze gemeinsam und persistiert einmal.
+// Keys: alle Schema-Felder mit FLAG_BATCH plus Laufzeitwerte ohne Speicherplatz
+// (display, effect, temp, humi).
+//
+// Geparst wird direkt im übergebenen Puffer (JsonScan), ohne Heap. Nur
+// String-Werte werden in den Pool des Pending kopiert, weil der Request-Body
+// bzw. MQTT-Puffer nicht bis zum nächsten Frame lebt.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <Arduino.h>
+#include "ConfigSchema.h"
+#include "JsonScan.h"
+
+// Aus dem Sketch
+void applyPendingBatch();
+int8_t findEffectIndexByName(const char* name);
+
+namespace Batch {
+
+  const size_t STRING_POOL = 160;  // Escapte String-Werte (tz), siehe static_assert im Sketch
+  const size_t KEY_MAX = 24;       // Unbekannter Key in der Fehlermeldung
+
+  template <size_t N>
+  struct Pending {
+    bool pending;
+    uint8_t count;                   // Anzahl Keys (für Log/Antwort)
+    const char* source;              // "batch" oder "mqtt"
+    ConfigSchema::Staged staged[N];  // Index = Schema-Index
+    char strings[STRING_POOL];       // Kopie, der Request-Body lebt nicht bis zum Frame
+    int8_t display;                  // -1 = unverändert
+    int8_t effect;                   // -1 = unverändert
+    float temp;                      // NAN = unverändert
+    float humi;
+  };
+
+  // Prüft ein Batch-JSON und merkt es in b vor. Gibt nullptr oder einen
+  // Fehlertext zurück; errorField zeigt dann auf den betroffenen Key.
+  template <size_t N>
+  const char* stage(const ConfigSchema::Field (&schema)[N], Pending<N>& b,
+                    const char* json, size_t len, const char* source, const char*& errorField) {
+    static char badKey[KEY_MAX];
+    // Noch nicht übernommener Batch (zwei Requests im selben Loop) geht vor
+    if (b.pending) {
+      applyPendingBatch();
+    }
+    memset(&b, 0, sizeof(b));
+    b.display = -1;
+    b.effect = -1;
+    b.temp = NAN;
+    b.humi = NAN;
+    size_t poolUsed = 0;
+    const char* error = nullptr;
+    errorField = nullptr;
+
+    bool syntaxOk = JsonScan::forEach(json, len, [&](const JsonScan::Token& t) {
+      if (t.depth != 1 || error) return;
+      auto fail = [&](const char* msg) {
+        size_t n = min((size_t)t.keyLen, sizeof(badKey) - 1);
+        memcpy(badKey, t.key, n);
+        badKey[n] = '\0';
+        error = msg;
+        errorField = badKey;
+      };
+      if (JsonScan::keyEquals(t, "display")) {
+        bool on;
+        if (!JsonScan::toBool(t, on)) { fail("Invalid value"); return; }
+        b.display = on ? 1 : 0;
+      } else if (JsonScan::keyEquals(t, "effect")) {
+        char name[KEY_MAX];
+        if (t.type != JsonScan::JSON_STRING || !JsonScan::unescape(t.value, t.valueLen, name, sizeof(name))) {
+          fail("Invalid value");
+          return;
+        }
+        int8_t idx = findEffectIndexByName(name);
+        if (idx < 0) { fail("Unknown effect"); return; }
+        b.effect = idx;
+      } else if (JsonScan::keyEquals(t, "temp") || JsonScan::keyEquals(t, "humi")) {
+        bool isTemp = t.key[0] == 't';
+        float v;
+        if (!JsonScan::toFloat(t, v)) { fail("Invalid value"); return; }
+        if (isTemp ? (v < -40.0f || v > 80.0f) : (v < 0.0f || v > 100.0f)) { fail("Value out of range"); return; }
+        (isTemp ? b.temp : b.humi) = v;
+      } else {
+        int16_t i = ConfigSchema::find(schema, N, t, ConfigSchema::FLAG_BATCH);
+        if (i < 0) { fail("Unknown key"); return; }
+        ConfigSchema::Staged& s = b.staged[i];
+        const char* err = ConfigSchema::stage(schema[i], t, s);
+        if (!err && !s.present) err = "Invalid value";
+        if (err) { fail(err); return; }
+        if (t.type == JsonScan::JSON_STRING) {
+          if (poolUsed + t.valueLen + 1 > sizeof(b.strings)) { fail("Value too long"); return; }
+          memcpy(b.strings + poolUsed, t.value, t.valueLen);
+          b.strings[poolUsed + t.valueLen] = '\0';
+          s.str = b.strings + poolUsed;
+          poolUsed += t.valueLen + 1;
+        }
+      }
+      b.count++;
+    });
+
+    if (!syntaxOk) error = "Invalid JSON";
+    if (!error && b.count == 0) error = "Empty batch";
+    if (!error) {
+      int16_t bad = ConfigSchema::checkStrings(schema, N, b.staged);
+      if (bad >= 0) {
+        error = "Invalid value";
+        errorField = schema[bad].name;
+      }
+    }
+    if (error) {
+      b.pending = false;
+      return error;
+    }
+    b.source = source;
+    b.pending = true;
+    return nullptr;
+  }
+
+}  // namespace Batch
+
+#endif  // BATCH_H
@@ -0,0 +1,135 @@
+// CborWriter.h — Minimaler CBOR-Encoder (RFC 8949) ohne Heap, Gegenstück zu JsonWriter
+//
+// Für Poller, die /api/status oft abfragen: Integer-Keys statt Feldnamen,
+// Zahlen binär statt als Text. Maps und Arrays haben unbestimmte Länge
+// (0xBF/0x9F ... 0xFF), damit Felder beim Schreiben weggelassen werden können
+// ohne vorher zu zählen. Floats als float32, NaN wird wie im JSON zu null.
+//
+// Puffer und Sink wie bei JsonWriter: ohne Sink setzt ein Überlauf ok() = false,
+// mit Sink wird ein voller Puffer weitergegeben. Am Ende flush() aufrufen.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef CBOR_WRITER_H
+#define CBOR_WRITER_H
+
+#include <Arduino.h>
+
+class CborWriter {
+ public:
+  typedef void (*Sink)(const char* data, size_t len);
+
+  CborWriter(uint8_t* buf, size_t capacity, Sink sink = nullptr)
+    : _buf(buf), _cap(capacity), _len(0), _overflow(false), _sink(sink) {}
+
+  void flush() {
+    if (!_sink || _len == 0) return;
+    _sink((const char*)_buf, _len);
+    _len = 0;
+  }
+
+  bool ok() const { return !_overflow; }
+  size_t length() const { return _len; }
+  const uint8_t* data() const { return _buf; }
+
+  void beginMap() { put(0xBF); }
+  void endMap() { put(0xFF); }
+  void beginArray(uint8_t key) { writeHead(MAJOR_UINT, key); put(0x9F); }
+  void endArray() { put(0xFF); }
+
+  void addUInt(uint8_t key, uint32_t value) {
+    writeHead(MAJOR_UINT, key);
+    writeHead(MAJOR_UINT, value);
+  }
+
+  void addInt(uint8_t key, int32_t value) {
+    writeHead(MAJOR_UINT, key);
+    writeInt(value);
+  }
+
+  void addBool(uint8_t key, bool value) {
+    writeHead(MAJOR_UINT, key);
+    put(value ? 0xF5 : 0xF4);
+  }
+
+  void addFloat(uint8_t key, float value) {
+    writeHead(MAJOR_UINT, key);
+    writeFloat(value);
+  }
+
+  void addString(uint8_t key, const char* value) {
+    writeHead(MAJOR_UINT, key);
+    writeString(value);
+  }
+
+  // Array-Elemente (ohne Key)
+  void writeInt(int32_t value) {
+    if (value < 0) {
+      writeHead(MAJOR_NEGINT, (uint32_t)(-1 - value));
+    } else {
+      writeHead(MAJOR_UINT, (uint32_t)value);
+    }
+  }
+
+  void writeFloat(float value) {
+    if (isnan(value)) {
+      put(0xF6);  // null
+      return;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(0xFA);
+    putBigEndian(bits, 4);
+  }
+
+  void writeString(const char* value) {
+    if (!value) value = "";
+    size_t n = strlen(value);
+    writeHead(MAJOR_TEXT, n);
+    for (size_t i = 0; i < n; i++) put((uint8_t)value[i]);
+  }
+
+ private:
+  static const uint8_t MAJOR_UINT = 0;
+  static const uint8_t MAJOR_NEGINT = 1;
+  static const uint8_t MAJOR_TEXT = 3;
+
+  uint8_t* _buf;
+  size_t _cap;
+  size_t _len;
+  bool _overflow;
+  Sink _sink;
+
+  void put(uint8_t b) {
+    if (_len >= _cap) {
+      if (!_sink) {
+        _overflow = true;
+        return;
+      }
+      flush();
+    }
+    _buf[_len++] = b;
+  }
+
+  void putBigEndian(uint32_t v, uint8_t bytes) {
+    for (int8_t i = bytes - 1; i >= 0; i--) put((uint8_t)(v >> (8 * i)));
+  }
+
+  // Kürzeste Kodierung: < 24 direkt im Initial-Byte, sonst 1/2/4 Folgebytes
+  void writeHead(uint8_t major, uint32_t v) {
+    uint8_t m = major << 5;
+    if (v < 24) {
+      put(m | v);
+    } else if (v <= 0xFF) {
+      put(m | 24);
+      put((uint8_t)v);
+    } else if (v <= 0xFFFF) {
+      put(m | 25);
+      putBigEndian(v, 2);
+    } else {
+      put(m | 26);
+      putBigEndian(v, 4);
+    }
+  }
+};
+
+#endif  // CBOR_WRITER_H
@@ -0,0 +1,309 @@
+// ConfigLog.h — Log-strukturierter Konfigurationsspeicher mit CRC32 pro Record
+//
+// Ersetzt die EEPROM-Emulation (1 Sektor, bei jedem Commit komplett gelöscht und
+// neu geschrieben) durch ein Append-Only-Log über eigene Flash-Sektoren:
+//
+//   Sektor:  [SectorHeader magic|sequence] [Record] [Record] ... [0xFF...]
+//   Record:  [key u16][len u16][data, auf 4 Bytes gepaddet][crc32]
+//
+// - Eine Feldänderung hängt nur einen Record an (wenige Bytes, kein Erase)
+// - Ist der aktive Sektor voll, werden alle aktuellen Werte in den nächsten
+//   Sektor kompaktiert (Rotation über alle Sektoren = Wear-Levelling). Der
+//   Sektor-Header wird zuletzt geschrieben — ein Stromausfall während der
+//   Kompaktierung lässt den alten Sektor gültig.
+// - Laden = ein sequentieller Scan des Sektors mit der höchsten Sequenznummer;
+//   der letzte gültige Record pro Key gewinnt.
+//
+// Der Key ist die bisherige EEPROM-Adresse des Felds: Das Log schreibt in den
+// bestehenden EEPROM-RAM-Shadow zurück, Lade-/persist-Code bleibt unverändert.
+//
+// Flash-Bereich: vom (aufgerundeten) Ende des Dateisystems bis einschließlich
+// des EEPROM-Sektors. Nach der Migration wird EEPROM.commit() nie mehr aufgerufen.
+// Bei weniger als zwei Sektoren (z.B. 1M-Layouts) bleibt es beim EEPROM.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef CONFIG_LOG_H
+#define CONFIG_LOG_H
+
+#include <Arduino.h>
+#include "Crc32.h"
+
+extern "C" uint32_t _FS_end;
+extern "C" uint32_t _EEPROM_start;
+
+namespace ConfigLog {
+
+  const uint32_t MAGIC = 0x47464349;        // "ICFG"
+  const uint8_t MAX_SECTORS = 4;
+  const uint8_t MAX_FIELDS = 32;           // Feldtabelle des Aufrufers per static_assert dagegen prüfen
+  const uint16_t MAX_RECORD_DATA = 128;
+  const uint32_t FLASH_MAPPED_BASE = 0x40200000;
+
+  enum FieldType : uint8_t {
+    FIELD_BINARY = 0,   // Immer volle Größe
+    FIELD_STRING = 1    // Nur bis inkl. Null-Terminator
+  };
+
+  struct Field {
+    uint16_t addr;      // Offset im Shadow = Record-Key
+    uint8_t size;       // Maximale Größe im Shadow
+    FieldType type;
+  };
+
+  struct SectorHeader {
+    uint32_t magic;
+    uint32_t sequence;
+  };
+
+  // Position des aktuell gültigen Records pro Feld (offset 0 = kein Record)
+  struct Slot {
+    uint16_t offset;
+    uint32_t crc;
+  };
+
+  inline const Field* fields = nullptr;
+  inline uint8_t fieldCount = 0;
+  inline uint8_t* shadow = nullptr;
+
+  inline uint32_t firstSector = 0;
+  inline uint8_t sectorCount = 0;
+  inline uint8_t activeSector = 0;
+  inline uint32_t sequence = 0;
+  inline uint16_t writeOffset = 0;
+  inline bool mounted = false;
+  inline Slot slots[MAX_FIELDS];
+
+  // Statistik
+  inline uint32_t appends = 0;
+  inline uint32_t bytesWritten = 0;
+  inline uint32_t compactions = 0;
+  inline uint32_t corruptRecords = 0;
+
+  // Record-Puffer (4-Byte-aligned für ESP.flashRead/flashWrite)
+  inline uint32_t recordBuf[(4 + MAX_RECORD_DATA + 4) / 4];
+  inline uint32_t verifyBuf[(4 + MAX_RECORD_DATA + 4) / 4];
+
+  inline uint32_t sectorAddr(uint8_t index) {
+    return (firstSector + index) * SPI_FLASH_SEC_SIZE;
+  }
+
+  inline uint16_t pad4(uint16_t len) {
+    return (len + 3) & ~3;
+  }
+
+  inline uint16_t recordSize(uint16_t len) {
+    return 4 + pad4(len) + 4;
+  }
+
+  inline int8_t findField(uint16_t key) {
+    for (uint8_t i = 0; i < fieldCount; i++) {
+      if (fields[i].addr == key) return i;
+    }
+    return -1;
+  }
+
+  // Aktuelle Länge eines Felds im Shadow
+  inline uint16_t fieldLen(uint8_t i) {
+    const Field& f = fields[i];
+    if (f.type == FIELD_STRING) {
+      uint16_t n = strnlen((const char*)shadow + f.addr, f.size);
+      return n < f.size ? n + 1 : f.size;
+    }
+    return f.size;
+  }
+
+  // Baut den Record für Feld i in recordBuf, gibt die Gesamtgröße zurück
+  inline uint16_t buildRecord(uint8_t i, uint32_t& crcOut) {
+    uint16_t len = fieldLen(i);
+    uint8_t* p = (uint8_t*)recordBuf;
+    uint16_t key = fields[i].addr;
+    memcpy(p, &key, 2);
+    memcpy(p + 2, &len, 2);
+    memset(p + 4, 0, pad4(len));
+    memcpy(p + 4, shadow + fields[i].addr, len);
+    crcOut = crc32(p, 4 + pad4(len));
+    memcpy(p + 4 + pad4(len), &crcOut, 4);
+    return recordSize(len);
+  }
+
+  // Flash-Bereich bestimmen. false = zu wenig Platz, EEPROM weiterverwenden.
+  // count <= MAX_FIELDS (slots[] hat keine Reserve)
+  inline bool begin(const Field* fieldTable, uint8_t count, uint8_t* shadowPtr) {
+    fields = fieldTable;
+    fieldCount = count;
+    shadow = shadowPtr;
+    uint32_t fsEnd = (uint32_t)(uintptr_t)&_FS_end - FLASH_MAPPED_BASE;
+    uint32_t eepromSector = ((uint32_t)(uintptr_t)&_EEPROM_start - FLASH_MAPPED_BASE) / SPI_FLASH_SEC_SIZE;
+    firstSector = (fsEnd + SPI_FLASH_SEC_SIZE - 1) / SPI_FLASH_SEC_SIZE;
+    if (eepromSector < firstSector) {
+      sectorCount = 0;
+      return false;
+    }
+    uint32_t n = eepromSector - firstSector + 1;
+    sectorCount = n > MAX_SECTORS ? MAX_SECTORS : n;
+    // Bei mehr freien Sektoren als MAX_SECTORS die letzten (inkl. EEPROM-Sektor) nehmen
+    firstSector = eepromSector - sectorCount + 1;
+    return sectorCount >= 2;
+  }
+
+  // Scannt einen Sektor und überträgt alle gültigen Records in den Shadow
+  inline void scanSector(uint8_t index) {
+    uint32_t base = sectorAddr(index);
+    uint16_t off = sizeof(SectorHeader);
+    memset(slots, 0, sizeof(slots));
+    while (off + 8 <= SPI_FLASH_SEC_SIZE) {
+      uint32_t head;
+      if (!ESP.flashRead(base + off, &head, 4) || head == 0xFFFFFFFF) {
+        break;  // Ende des Logs (gelöschter Flash)
+      }
+      uint16_t key = head & 0xFFFF;
+      uint16_t len = head >> 16;
+      uint16_t total = recordSize(len);
+      bool ok = len <= MAX_RECORD_DATA && off + total <= SPI_FLASH_SEC_SIZE &&
+                ESP.flashRead(base + off, recordBuf, total);
+      uint32_t storedCrc = 0;
+      if (ok) {
+        memcpy(&storedCrc, (uint8_t*)recordBuf + 4 + pad4(len), 4);
+        ok = storedCrc == crc32(recordBuf, 4 + pad4(len));
+      }
+      if (!ok) {
+        // Abgebrochener Schreibvorgang: Rest des Sektors ist unbrauchbar,
+        // der nächste Append kompaktiert in einen frischen Sektor
+        corruptRecords++;
+        off = SPI_FLASH_SEC_SIZE;
+        break;
+      }
+      int8_t i = findField(key);
+      if (i >= 0 && len <= fields[i].size) {
+        memcpy(shadow + key, (uint8_t*)recordBuf + 4, len);
+        slots[i].offset = off;
+        slots[i].crc = storedCrc;
+      }
+      off += total;
+    }
+    writeOffset = off;
+  }
+
+  // Gibt es für den Key einen gültigen Record im aktiven Sektor?
+  inline bool hasRecord(uint16_t key) {
+    int8_t i = findField(key);
+    return i >= 0 && slots[i].offset != 0;
+  }
+
+  // Sucht den gültigen Sektor mit der höchsten Sequenz. false = kein Log vorhanden.
+  inline bool mount() {
+    int8_t best = -1;
+    uint32_t bestSeq = 0;
+    for (uint8_t s = 0; s < sectorCount; s++) {
+      SectorHeader h;
+      if (!ESP.flashRead(sectorAddr(s), (uint32_t*)&h, sizeof(h))) continue;
+      if (h.magic != MAGIC || h.sequence == 0xFFFFFFFF) continue;
+      if (best < 0 || h.sequence > bestSeq) {
+        best = s;
+        bestSeq = h.sequence;
+      }
+    }
+    if (best < 0) {
+      return false;
+    }
+    activeSector = best;
+    sequence = bestSeq;
+    // Felder ohne Record (z.B. neu hinzugekommen) sind danach 0 statt EEPROM-Resten;
+    // hasRecord() unterscheidet sie von gespeicherten Nullen
+    for (uint8_t i = 0; i < fieldCount; i++) {
+      memset(shadow + fields[i].addr, 0, fields[i].size);
+    }
+    scanSector(activeSector);
+    mounted = true;
+    return true;
+  }
+
+  // Schreibt alle Felder aus dem Shadow in den nächsten Sektor (auch Format/Migration)
+  inline bool compact() {
+    uint8_t target = mounted ? (activeSector + 1) % sectorCount : 0;
+    uint32_t base = sectorAddr(target);
+    if (!ESP.flashEraseSector(firstSector + target)) {
+      return false;
+    }
+    uint16_t off = sizeof(SectorHeader);
+    Slot newSlots[MAX_FIELDS];
+    for (uint8_t i = 0; i < fieldCount; i++) {
+      uint32_t crc;
+      uint16_t total = buildRecord(i, crc);
+      if (off + total > SPI_FLASH_SEC_SIZE || !ESP.flashWrite(base + off, recordBuf, total)) {
+        return false;
+      }
+      newSlots[i].offset = off;
+      newSlots[i].crc = crc;
+      off += total;
+      bytesWritten += total;
+    }
+    // Header zuletzt: erst jetzt wird der neue Sektor beim Mount berücksichtigt
+    SectorHeader h = {MAGIC, mounted ? sequence + 1 : 1};
+    if (!ESP.flashWrite(base, (uint32_t*)&h, sizeof(h))) {
+      return false;
+    }
+    memcpy(slots, newSlots, sizeof(slots));
+    activeSector = target;
+    sequence = h.sequence;
+    writeOffset = off;
+    mounted = true;
+    compactions++;
+    return true;
+  }
+
+  // Neues Log anlegen (Migration aus dem EEPROM-Shadow)
+  inline bool format() {
+    mounted = false;
+    return compact();
+  }
+
+  // Hängt Feld i an, wenn es sich vom gespeicherten Record unterscheidet
+  inline bool commitField(uint8_t i) {
+    uint32_t crc;
+    uint16_t total = buildRecord(i, crc);
+    uint32_t base = sectorAddr(activeSector);
+    if (slots[i].offset != 0 && slots[i].crc == crc &&
+        ESP.flashRead(base + slots[i].offset, verifyBuf, total) &&
+        memcmp(verifyBuf, recordBuf, total) == 0) {
+      return true;  // Unverändert
+    }
+    if (writeOffset + total > SPI_FLASH_SEC_SIZE) {
+      return compact();  // Schreibt alle Felder, inkl. diesem
+    }
+    if (!ESP.flashWrite(base + writeOffset, recordBuf, total)) {
+      return false;
+    }
+    slots[i].offset = writeOffset;
+    slots[i].crc = crc;
+    writeOffset += total;
+    appends++;
+    bytesWritten += total;
+    return true;
+  }
+
+  // Persistiert alle Felder, die den geänderten Shadow-Bereich [lo, hi) berühren
+  inline bool commitRange(uint16_t lo, uint16_t hi) {
+    if (!mounted) return false;
+    uint32_t compactionsBefore = compactions;
+    for (uint8_t i = 0; i < fieldCount; i++) {
+      const Field& f = fields[i];
+      if (f.addr >= hi || f.addr + f.size <= lo) continue;
+      if (!commitField(i)) return false;
+      if (compactions != compactionsBefore) return true;  // Kompaktierung hat alles geschrieben
+    }
+    return true;
+  }
+
+  // Inhalts-Prüfsumme über die aktuellen Records (ohne Flash-/Shadow-Scan)
+  inline uint16_t contentChecksum() {
+    uint32_t x = 0;
+    for (uint8_t i = 0; i < fieldCount; i++) {
+      x ^= slots[i].crc + i;
+    }
+    return (uint16_t)(x ^ (x >> 16));
+  }
+
+}  // namespace ConfigLog
+
+#endif  // CONFIG_LOG_H
@@ -0,0 +1,308 @@
+// ConfigSchema.h — Ein Feld-Deskriptor pro Einstellung, daraus generiert:
+//   - Laden aus dem Speicher (EEPROM-Shadow bzw. ConfigLog) inkl. Bereichsprüfung
+//   - Persistieren (pro Gruppe, über EepromWriteBack)
+//   - Backup-/Status-JSON (JsonWriter)
+//   - Restore (ein Durchlauf mit JsonScan, erst prüfen, dann übernehmen)
+//   - Batch-Änderungen (/api/batch): gleiche Prüfung pro Feld über stage()
+//
+// Die Tabelle selbst (CONFIG_SCHEMA) steht in IkeaObegraensad.ino, weil sie auf
+// die globalen Variablen zeigt. Neue Einstellung = eine Zeile in der Tabelle.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef CONFIG_SCHEMA_H
+#define CONFIG_SCHEMA_H
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "EepromWriteBack.h"
+#include "JsonWriter.h"
+#include "JsonScan.h"
+
+namespace ConfigSchema {
+
+  enum Type : uint8_t {
+    TYPE_BOOL,    // bool, 1 Byte im Speicher (0/1; andere Werte → Default)
+    TYPE_U16,     // uint16_t
+    TYPE_U32,     // uint32_t
+    TYPE_STRING   // char[size], im Speicher null-terminiert (max storageSize-1 Zeichen)
+  };
+
+  // Gruppen = bisherige persist*()-Funktionen
+  enum Group : uint8_t {
+    GROUP_BRIGHTNESS = 1 << 0,
+    GROUP_MQTT       = 1 << 1,
+    GROUP_NTP        = 1 << 2,
+    GROUP_SLIDES     = 1 << 3,
+    GROUP_RESTART    = 1 << 4,
+    GROUP_ALL        = 0xFF
+  };
+
+  enum Flags : uint8_t {
+    FLAG_BACKUP      = 1 << 0,  // In /api/backup enthalten und per /api/restore setzbar
+    FLAG_STATUS      = 1 << 1,  // In /api/status enthalten
+    FLAG_ALLOW_EMPTY = 1 << 2,  // Leerer String ist ein gültiger Wert (sonst: Default/ignorieren)
+    FLAG_CLAMP       = 1 << 3,  // Restore: Zahl außerhalb des Bereichs begrenzen statt ablehnen
+    FLAG_BATCH       = 1 << 4   // Per /api/batch bzw. MQTT-JSON setzbar (Laufzeit-Einstellungen)
+  };
+
+  typedef bool (*StringValidator)(const char*);
+  typedef bool (*StoredCheck)(uint16_t storageAddr);  // Hat das Feld einen gespeicherten Wert?
+
+  const uint16_t MAX_STRING_SIZE = 128;  // Größter String-Puffer (RAM und Speicher)
+
+  struct Field {
+    const char* name;          // JSON-Key (Backup, Restore, Status)
+    const char* alias;         // Zusätzlicher Status-Key (HA-Kompatibilität) oder nullptr
+    Type type;
+    uint8_t group;
+    uint8_t flags;
+    void* ptr;                 // RAM-Variable
+    uint16_t size;             // RAM-Puffergröße (nur TYPE_STRING)
+    uint16_t storageAddr;      // Offset im EEPROM-Shadow / ConfigLog-Key
+    uint16_t storageSize;      // Bytes im Speicher (Strings inkl. Terminator)
+    int32_t minVal;            // Zahlen: Bereich
+    int32_t maxVal;
+    int32_t defVal;            // Default (Zahlen/Bool)
+    const char* defStr;        // Default (Strings)
+    StringValidator validate;  // Optionale Prüfung für Strings
+  };
+
+  // --- Hilfsfunktionen pro Feld ---
+
+  inline int32_t getNumber(const Field& f) {
+    switch (f.type) {
+      case TYPE_BOOL: return *(bool*)f.ptr ? 1 : 0;
+      case TYPE_U16:  return *(uint16_t*)f.ptr;
+      case TYPE_U32:  return (int32_t)*(uint32_t*)f.ptr;
+      default:        return 0;
+    }
+  }
+
+  inline void setNumber(const Field& f, int32_t v) {
+    switch (f.type) {
+      case TYPE_BOOL: *(bool*)f.ptr = v != 0; break;
+      case TYPE_U16:  *(uint16_t*)f.ptr = (uint16_t)v; break;
+      case TYPE_U32:  *(uint32_t*)f.ptr = (uint32_t)v; break;
+      default: break;
+    }
+  }
+
+  inline void setString(const Field& f, const char* s) {
+    char* dst = (char*)f.ptr;
+    strncpy(dst, s, f.size - 1);
+    dst[f.size - 1] = '\0';
+  }
+
+  inline bool stringValid(const Field& f, const char* s) {
+    if (s[0] == '\0') return (f.flags & FLAG_ALLOW_EMPTY) != 0;
+    if (strlen(s) >= f.storageSize) return false;
+    return !f.validate || f.validate(s);
+  }
+
+  inline void applyDefault(const Field& f) {
+    if (f.type == TYPE_STRING) {
+      setString(f, f.defStr ? f.defStr : "");
+    } else {
+      setNumber(f, f.defVal);
+    }
+  }
+
+  // --- Generierte Operationen über die ganze Tabelle ---
+
+  inline void applyDefaults(const Field* fields, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) applyDefault(fields[i]);
+  }
+
+  // Lädt alle Felder aus dem EEPROM-Shadow. Ungültige Werte → Default.
+  // Felder ohne gespeicherten Wert (stored() == false, z.B. nach einem Update
+  // neu hinzugekommen) bekommen ebenfalls den Default; zurückgegeben werden
+  // deren Gruppen, damit der Aufrufer sie einmal persistieren kann.
+  inline uint8_t load(const Field* fields, uint8_t count, StoredCheck stored = nullptr) {
+    const uint8_t* shadow = EEPROM.getConstDataPtr();
+    uint8_t missing = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      const Field& f = fields[i];
+      if (stored && !stored(f.storageAddr)) {
+        applyDefault(f);
+        missing |= f.group;
+        continue;
+      }
+      const uint8_t* src = shadow + f.storageAddr;
+      if (f.type == TYPE_STRING) {
+        char tmp[MAX_STRING_SIZE + 1];
+        memcpy(tmp, src, f.storageSize);
+        tmp[f.storageSize] = '\0';
+        if (stringValid(f, tmp)) {
+          setString(f, tmp);
+        } else {
+          applyDefault(f);
+        }
+        continue;
+      }
+      int32_t v = 0;
+      switch (f.type) {
+        case TYPE_BOOL: v = src[0]; break;
+        case TYPE_U16:  { uint16_t x; memcpy(&x, src, 2); v = x; break; }
+        case TYPE_U32:  { uint32_t x; memcpy(&x, src, 4); v = (int32_t)x; break; }
+        default: break;
+      }
+      if (f.type == TYPE_BOOL && v > 1) {
+        // Ungeschriebenes EEPROM-Byte (0xFF): neues Feld → Default
+        applyDefault(f);
+        missing |= f.group;
+      } else if (f.type == TYPE_BOOL) {
+        setNumber(f, v == 1);
+      } else if (v < f.minVal || v > f.maxVal) {
+        applyDefault(f);
+      } else {
+        setNumber(f, v);
+      }
+    }
+    return missing;
+  }
+
+  // Schreibt alle Felder der Gruppen in den Shadow (nur geänderte Bytes werden dirty)
+  inline void store(const Field* fields, uint8_t count, uint8_t groups) {
+    for (uint8_t i = 0; i < count; i++) {
+      const Field& f = fields[i];
+      if (!(f.group & groups)) continue;
+      switch (f.type) {
+        case TYPE_BOOL: EepromWriteBack::write(f.storageAddr, *(bool*)f.ptr ? 1 : 0); break;
+        case TYPE_U16:  EepromWriteBack::put(f.storageAddr, *(uint16_t*)f.ptr); break;
+        case TYPE_U32:  EepromWriteBack::put(f.storageAddr, *(uint32_t*)f.ptr); break;
+        case TYPE_STRING: EepromWriteBack::writeString(f.storageAddr, (const char*)f.ptr, f.storageSize); break;
+      }
+    }
+  }
+
+  inline void writeValue(JsonWriter& w, const char* key, const Field& f) {
+    switch (f.type) {
+      case TYPE_BOOL:   w.addBool(key, *(bool*)f.ptr); break;
+      case TYPE_STRING: w.addString(key, (const char*)f.ptr); break;
+      default:          w.addUInt(key, (uint32_t)getNumber(f)); break;
+    }
+  }
+
+  // Alle Felder mit dem Flag als Key/Value-Paare ins offene JSON-Objekt
+  inline void serialize(JsonWriter& w, const Field* fields, uint8_t count, uint8_t flag) {
+    for (uint8_t i = 0; i < count; i++) {
+      const Field& f = fields[i];
+      if (!(f.flags & flag)) continue;
+      writeValue(w, f.name, f);
+      if (flag == FLAG_STATUS && f.alias) {
+        writeValue(w, f.alias, f);
+      }
+    }
+  }
+
+  // Restore-Zwischenstand pro Feld: Werte zeigen in den JSON-Text (keine Kopie)
+  struct Staged {
+    bool present;
+    int32_t number;
+    const char* str;
+    uint16_t strLen;
+  };
+
+  // Ergebnis von parseRestore()
+  struct RestoreResult {
+    bool ok;
+    long version;
+    const char* error;       // Statischer Text für die Fehlermeldung
+    const char* errorField;  // Betroffener Key oder nullptr
+  };
+
+  // Index des Felds mit dem Key und dem Flag, -1 = unbekannt
+  inline int16_t find(const Field* fields, uint8_t count, const JsonScan::Token& t, uint8_t flag) {
+    for (uint8_t i = 0; i < count; i++) {
+      if ((fields[i].flags & flag) && JsonScan::keyEquals(t, fields[i].name)) return i;
+    }
+    return -1;
+  }
+
+  // Prüft einen JSON-Wert für Feld f und merkt ihn in s vor. Gibt einen
+  // Fehlertext zurück (nullptr = ok); bei falschem Typ bleibt s.present false.
+  inline const char* stage(const Field& f, const JsonScan::Token& t, Staged& s) {
+    if (f.type == TYPE_STRING) {
+      if (t.type != JsonScan::JSON_STRING) return nullptr;
+      s.str = t.value;
+      s.strLen = t.valueLen;
+      s.present = true;
+    } else if (f.type == TYPE_BOOL) {
+      bool b;
+      if (JsonScan::toBool(t, b)) { s.number = b; s.present = true; }
+    } else {
+      long v;
+      if (!JsonScan::toLong(t, v)) return nullptr;
+      if (v < f.minVal || v > f.maxVal) {
+        if (!(f.flags & FLAG_CLAMP)) return "Value out of range";
+        v = constrain(v, (long)f.minVal, (long)f.maxVal);
+      }
+      s.number = v;
+      s.present = true;
+    }
+    return nullptr;
+  }
+
+  // Prüft alle vorgemerkten Strings (Unescape in temporären Puffer). Leere
+  // Strings ohne FLAG_ALLOW_EMPTY werden verworfen (= beibehalten, wie bisher).
+  // Gibt den Index des ersten ungültigen Felds zurück, -1 = alles ok.
+  inline int16_t checkStrings(const Field* fields, uint8_t count, Staged* staged) {
+    for (uint8_t i = 0; i < count; i++) {
+      const Field& f = fields[i];
+      if (f.type != TYPE_STRING || !staged[i].present) continue;
+      char tmp[MAX_STRING_SIZE];
+      bool fits = JsonScan::unescape(staged[i].str, staged[i].strLen, tmp, min((size_t)f.size, sizeof(tmp)));
+      if (tmp[0] == '\0' && !(f.flags & FLAG_ALLOW_EMPTY)) {
+        staged[i].present = false;
+        continue;
+      }
+      if (!fits || !stringValid(f, tmp)) return i;
+    }
+    return -1;
+  }
+
+  // Ein Durchlauf über das Backup-JSON: "version" auf oberster Ebene, Felder im
+  // "config"-Objekt. Alles wird geprüft, bevor apply() etwas übernimmt.
+  inline RestoreResult parseRestore(const char* json, size_t len, const Field* fields,
+                                    uint8_t count, Staged* staged) {
+    RestoreResult r = {true, -1, nullptr, nullptr};
+    bool configSeen = false;
+    memset(staged, 0, sizeof(Staged) * count);
+    bool syntaxOk = JsonScan::forEach(json, len, [&](const JsonScan::Token& t) {
+      if (t.depth == 1) {
+        if (JsonScan::keyEquals(t, "version")) JsonScan::toLong(t, r.version);
+        if (JsonScan::keyEquals(t, "config") && t.type == JsonScan::JSON_OBJECT) configSeen = true;
+        return;
+      }
+      if (t.depth != 2 || !r.ok) return;
+      int16_t i = find(fields, count, t, FLAG_BACKUP);
+      if (i < 0) return;
+      const char* error = stage(fields[i], t, staged[i]);
+      if (error) r = {false, r.version, error, fields[i].name};
+    });
+    if (!syntaxOk) return {false, r.version, "Invalid JSON", nullptr};
+    if (!r.ok) return r;
+    if (r.version < 0) return {false, r.version, "Invalid backup format: missing version", nullptr};
+    if (!configSeen) return {false, r.version, "Invalid backup format: missing config", nullptr};
+
+    int16_t bad = checkStrings(fields, count, staged);
+    if (bad >= 0) return {false, r.version, "Invalid value", fields[bad].name};
+    return r;
+  }
+
+  // Übernimmt die von parseRestore() geprüften Werte in die RAM-Variablen
+  inline void applyStaged(const Field* fields, uint8_t count, const Staged* staged) {
+    for (uint8_t i = 0; i < count; i++) {
+      const Field& f = fields[i];
+      if (!staged[i].present) continue;
+      if (f.type == TYPE_STRING) {
+        JsonScan::unescape(staged[i].str, staged[i].strLen, (char*)f.ptr, f.size);
+      } else {
+        setNumber(f, staged[i].number);
+      }
+    }
+  }
+
+}  // namespace ConfigSchema
+
+#endif  // CONFIG_SCHEMA_H
@@ -0,0 +1,28 @@
+// Crc32.h — CRC-32 (IEEE 802.3, reflektiert, Polynom 0xEDB88320)
+//
+// Bitweise Implementierung ohne Tabelle: spart 1 KB Flash/RAM und ist für die
+// kleinen Datenmengen hier (RTC-Slots, Konfigurations-Records) schnell genug.
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// crc = vorheriger Wert für inkrementelle Berechnung (Start: 0)
+inline uint32_t crc32Update(uint32_t crc, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    for (uint8_t k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+inline uint32_t crc32(const void* data, size_t len) {
+  return crc32Update(0, data, len);
+}
+
+#endif  // CRC32_H
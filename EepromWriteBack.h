@@ -0,0 +1,125 @@
+// EepromWriteBack.h — Verzögerter, zusammenfassender Write-Back für den EEPROM-Shadow
+//
+// Jeder EEPROM.commit() löscht und beschreibt einen kompletten Flash-Sektor
+// (4 KB, zig ms CPU-Stall, begrenzte Lebensdauer). Statt bei jeder Änderung zu
+// committen, schreiben die persist*()-Funktionen nur in den RAM-Shadow:
+//   - put()/write()/writeString() vergleichen vorher und markieren nur wirklich
+//     geänderte Bytes als dirty (Bereich dirtyLo..dirtyHi)
+//   - commitDue() meldet einen fälligen Commit erst nach QUIET_PERIOD_MS ohne
+//     weitere Änderung (spätestens nach MAX_DELAY_MS bei Dauerfeuer)
+//   - ohne geänderte Bytes gibt es keinen Commit
+//
+// Den eigentlichen Commit (Watchdog, Logging) macht der Sketch über
+// flushEEPROM() — auch sofort vor Restart, OTA und Restore.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef EEPROM_WRITE_BACK_H
+#define EEPROM_WRITE_BACK_H
+
+#include <Arduino.h>
+#include <EEPROM.h>
+
+namespace EepromWriteBack {
+
+  const unsigned long QUIET_PERIOD_MS = 5000;  // Ruhezeit nach letzter Änderung
+  const unsigned long MAX_DELAY_MS = 30000;    // Obergrenze bei ständigen Änderungen
+
+  inline uint16_t dirtyLo = UINT16_MAX;   // Erstes geändertes Byte
+  inline uint16_t dirtyHi = 0;            // Letztes geändertes Byte + 1
+  inline unsigned long firstChangeMs = 0;
+  inline unsigned long lastChangeMs = 0;
+  inline const char* pendingSource = "";  // Letzter Verursacher (für Logging)
+  inline uint32_t changeCount = 0;        // Anzahl tatsächlicher Byte-Änderungen
+  inline uint32_t changeCountSeen = 0;    // Stand beim letzten noteRequest()
+
+  // Statistik für /api/status
+  inline uint32_t commits = 0;        // Tatsächliche Flash-Commits
+  inline uint32_t requests = 0;       // persist*()-Aufrufe insgesamt
+  inline uint32_t skipped = 0;        // persist*()-Aufrufe ohne Byte-Änderung
+  inline uint32_t failures = 0;       // Fehlgeschlagene Commits
+
+  inline bool isDirty() {
+    return dirtyHi > dirtyLo;
+  }
+
+  inline uint16_t dirtyBytes() {
+    return isDirty() ? dirtyHi - dirtyLo : 0;
+  }
+
+  inline void markDirty(uint16_t addr, uint16_t len) {
+    unsigned long now = millis();
+    if (!isDirty()) {
+      firstChangeMs = now;
+    }
+    lastChangeMs = now;
+    changeCount++;
+    if (addr < dirtyLo) dirtyLo = addr;
+    if (addr + len > dirtyHi) dirtyHi = addr + len;
+  }
+
+  // Schreibt nur, wenn sich die Bytes unterscheiden. Gibt true bei Änderung zurück.
+  inline bool writeBytes(uint16_t addr, const void* data, uint16_t len) {
+    if (addr + len > EEPROM.length()) {
+      return false;
+    }
+    if (memcmp(EEPROM.getConstDataPtr() + addr, data, len) == 0) {
+      return false;
+    }
+    memcpy(EEPROM.getDataPtr() + addr, data, len);
+    markDirty(addr, len);
+    return true;
+  }
+
+  inline bool write(uint16_t addr, uint8_t value) {
+    return writeBytes(addr, &value, 1);
+  }
+
+  template <typename T>
+  bool put(uint16_t addr, const T& value) {
+    return writeBytes(addr, &value, sizeof(T));
+  }
+
+  // C-String inkl. Null-Terminator (maxLen inkl. Terminator), Rest bleibt unverändert
+  inline bool writeString(uint16_t addr, const char* str, uint16_t maxLen) {
+    uint16_t len = strlen(str);
+    if (len >= maxLen) {
+      len = maxLen - 1;
+    }
+    bool changed = writeBytes(addr, str, len);
+    changed |= write(addr + len, 0);
+    return changed;
+  }
+
+  // Ein persist*()-Aufruf ist fertig — nur für Statistik/Logging
+  inline void noteRequest(const char* source) {
+    requests++;
+    if (changeCount != changeCountSeen) {
+      pendingSource = source;
+      changeCountSeen = changeCount;
+    } else {
+      skipped++;
+    }
+  }
+
+  inline bool commitDue() {
+    if (!isDirty()) return false;
+    unsigned long now = millis();
+    return (now - lastChangeMs) >= QUIET_PERIOD_MS || (now - firstChangeMs) >= MAX_DELAY_MS;
+  }
+
+  // Nach erfolgreichem Commit aufrufen
+  inline void markClean() {
+    dirtyLo = UINT16_MAX;
+    dirtyHi = 0;
+    commits++;
+  }
+
+  // Commit fehlgeschlagen: Bereich bleibt dirty, nächster Versuch nach der Ruhezeit
+  inline void markFailed() {
+    failures++;
+    lastChangeMs = millis();
+  }
+
+}  // namespace EepromWriteBack
+
+#endif  // EEPROM_WRITE_BACK_H
@@ -0,0 +1,129 @@
+// EffectRegistry.h — Effekt-Registry, zur Compile-Zeit ausgewertet
+//
+// Eine Zeile pro Effekt in EFFECTS[] (IkeaObegraensad.ino). Daraus entstehen
+// ohne Laufzeitkosten:
+//   - eine kollisionsfreie Hashtabelle über die Namen (FNV-1a, der Seed wird
+//     vom Compiler gesucht; Groß-/Kleinschreibung egal). Lookup = ein Hash plus
+//     ein Stringvergleich statt strcasecmp() über alle Effekte.
+//   - die fertige JSON-Liste der Namen für /api/status
+// Doppelte Namen lassen static_assert(EFFECT_HASH.ok) fehlschlagen.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef EFFECT_REGISTRY_H
+#define EFFECT_REGISTRY_H
+
+#include <Arduino.h>
+#include "Effect.h"
+
+namespace EffectRegistry {
+
+  struct Entry {
+    const char* name;   // Name für Route, MQTT und Web-Interface (Kleinbuchstaben, ohne Sonderzeichen)
+    Effect* effect;
+  };
+
+  const uint8_t NO_EFFECT = 0xFF;
+  const uint32_t MAX_SEED = 4096;  // Suchraum für den Seed (Compile-Zeit)
+
+  constexpr char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+  }
+
+  constexpr size_t length(const char* s) {
+    size_t n = 0;
+    while (s[n]) n++;
+    return n;
+  }
+
+  // FNV-1a über die Kleinbuchstaben, der Seed verändert den Startwert
+  constexpr uint32_t hash(const char* s, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261UL ^ (seed * 16777619UL);
+    for (size_t i = 0; i < len; i++) {
+      h = (h ^ (uint8_t)lower(s[i])) * 16777619UL;
+    }
+    // Die Multiplikation trägt nur nach oben: obere Bits in die unteren falten,
+    // sonst hängen die Tabellenslots (untere Bits) kaum vom Seed ab
+    return h ^ (h >> 16);
+  }
+
+  // Nächste Zweierpotenz >= 2 * Anzahl (halb leer → Seed schnell gefunden)
+  constexpr size_t tableSize(size_t count) {
+    size_t n = 1;
+    while (n < 2 * count) n <<= 1;
+    return n;
+  }
+
+  template <size_t SIZE>
+  struct HashTable {
+    bool ok;              // false = kein kollisionsfreier Seed (doppelte Namen?)
+    uint32_t seed;
+    uint8_t slots[SIZE];  // Index in EFFECTS[] oder NO_EFFECT
+  };
+
+  template <size_t SIZE, size_t N>
+  constexpr HashTable<SIZE> buildHash(const Entry (&entries)[N]) {
+    static_assert((SIZE & (SIZE - 1)) == 0, "SIZE muss eine Zweierpotenz sein");
+    static_assert(N < NO_EFFECT && N <= SIZE, "Zu viele Effekte");
+    HashTable<SIZE> t = {};
+    for (uint32_t seed = 0; seed < MAX_SEED; seed++) {
+      for (size_t i = 0; i < SIZE; i++) t.slots[i] = NO_EFFECT;
+      bool collision = false;
+      for (size_t i = 0; i < N && !collision; i++) {
+        size_t slot = hash(entries[i].name, length(entries[i].name), seed) & (SIZE - 1);
+        if (t.slots[slot] != NO_EFFECT) {
+          collision = true;
+        } else {
+          t.slots[slot] = (uint8_t)i;
+        }
+      }
+      if (!collision) {
+        t.ok = true;
+        t.seed = seed;
+        return t;
+      }
+    }
+    return t;
+  }
+
+  // Index des Effekts oder -1
+  template <size_t SIZE, size_t N>
+  inline int8_t find(const HashTable<SIZE>& t, const Entry (&entries)[N], const char* name, size_t len) {
+    uint8_t idx = t.slots[hash(name, len, t.seed) & (SIZE - 1)];
+    if (idx == NO_EFFECT) return -1;
+    const char* candidate = entries[idx].name;
+    if (strlen(candidate) != len || strncasecmp(candidate, name, len) != 0) return -1;
+    return (int8_t)idx;
+  }
+
+  // ["name1","name2",...] inkl. Terminator
+  template <size_t N>
+  constexpr size_t jsonListSize(const Entry (&entries)[N]) {
+    size_t n = 3;
+    for (size_t i = 0; i < N; i++) n += length(entries[i].name) + 3;
+    return n;
+  }
+
+  template <size_t SIZE>
+  struct JsonList {
+    char text[SIZE];
+  };
+
+  template <size_t SIZE, size_t N>
+  constexpr JsonList<SIZE> buildJsonList(const Entry (&entries)[N]) {
+    JsonList<SIZE> l = {};
+    size_t o = 0;
+    l.text[o++] = '[';
+    for (size_t i = 0; i < N; i++) {
+      if (i > 0) l.text[o++] = ',';
+      l.text[o++] = '"';
+      for (const char* p = entries[i].name; *p; p++) l.text[o++] = *p;
+      l.text[o++] = '"';
+    }
+    l.text[o++] = ']';
+    l.text[o] = '\0';
+    return l;
+  }
+
+}  // namespace EffectRegistry
+
+#endif  // EFFECT_REGISTRY_H
@@ -0,0 +1,176 @@
+// HaDiscovery.h — Home Assistant MQTT-Discovery aus Flash-Vorlagen
+//
+// Die Config-Payloads (mehrere hundert Bytes pro Entität) liegen als Vorlagen
+// in PROGMEM und werden beim Publish direkt in den Socket expandiert
+// (PubSubClient::beginPublish()/write()/endPublish()) — kein String, kein
+// großer Puffer. beginPublish() braucht die Länge vorab, daher läuft expand()
+// zweimal: erst zählen (out == nullptr), dann schreiben.
+//
+// Platzhalter in den Vorlagen:
+//   $B Base-Topic (als "~", Topics darin beginnen mit "~/")
+//   $U Unique-ID-Präfix (= Node-ID)     $N Gerätename    $V Firmware-Version
+//   $E Effektliste als JSON-Array       $D Gerätebeschreibung ("dev":{...})
+//   $S(feld) State-Topic des Felds: JSON-Modus "~/state", Delta-Modus "~/state/feld"
+//   $J(feld) JSON-Wert im Template: value_json.feld bzw. value_json (true/512/null)
+//   $T(feld) Text-Wert im Template: value_json.feld bzw. value
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef HA_DISCOVERY_H
+#define HA_DISCOVERY_H
+
+#include <Arduino.h>
+
+namespace HaDiscovery {
+
+  const char PREFIX[] = "homeassistant";
+  const char STATUS_TOPIC[] = "homeassistant/status";  // Birth-Message "online" → neu senden
+
+  struct Context {
+    const char* base;
+    const char* uid;
+    const char* name;
+    const char* version;
+    const char* effects;
+    bool delta;          // State als Einzel-Topics (mqttDeltaState)
+  };
+
+  struct Entity {
+    const char* component;
+    const char* object;
+    PGM_P config;
+  };
+
+  const char DEVICE[] PROGMEM =
+    R"ha("dev":{"ids":["$U"],"name":"$N","mf":"IKEA (DIY)","mdl":"OBEGRÄNSAD","sw":"$V"})ha";
+
+  // Basic-Schema-Light: stat_val_tpl muss pl_on/pl_off liefern (kein stat_on wie beim Switch)
+  const char LIGHT[] PROGMEM =
+    R"ha({"~":"$B","name":null,"uniq_id":"$U_light","obj_id":"$U_light",)ha"
+    R"ha("cmd_t":"~/cmd","pl_on":"display:on","pl_off":"display:off",)ha"
+    R"ha("stat_t":"$S(display)","stat_val_tpl":"{{ 'display:on' if $J(display) else 'display:off' }}",)ha"
+    R"ha("bri_cmd_t":"~/cmd","bri_cmd_tpl":"brightness:{{ value }}","bri_scl":1023,)ha"
+    R"ha("bri_stat_t":"$S(brightness)","bri_val_tpl":"{{ $J(brightness) }}",)ha"
+    R"ha("fx_cmd_t":"~/cmd","fx_cmd_tpl":"effect:{{ value }}","fx_list":$E,)ha"
+    R"ha("fx_stat_t":"$S(effect)","fx_val_tpl":"{{ $T(effect) }}",$D})ha";
+
+  const char AUTO_BRIGHTNESS[] PROGMEM =
+    R"ha({"~":"$B","name":"Auto brightness","uniq_id":"$U_autobrightness","obj_id":"$U_autobrightness",)ha"
+    R"ha("cmd_t":"~/cmd","pl_on":"autobrightness:on","pl_off":"autobrightness:off",)ha"
+    R"ha("stat_t":"$S(autoBrightness)","val_tpl":"{{ 'ON' if $J(autoBrightness) else 'OFF' }}",)ha"
+    R"ha("stat_on":"ON","stat_off":"OFF","ent_cat":"config",$D})ha";
+
+  const char TEMPERATURE[] PROGMEM =
+    R"ha({"~":"$B","name":"Temperature","uniq_id":"$U_temperature","obj_id":"$U_temperature",)ha"
+    R"ha("stat_t":"$S(sensorTemp)","val_tpl":"{{ $J(sensorTemp) }}",)ha"
+    R"ha("dev_cla":"temperature","unit_of_meas":"°C","stat_cla":"measurement",$D})ha";
+
+  const char HUMIDITY[] PROGMEM =
+    R"ha({"~":"$B","name":"Humidity","uniq_id":"$U_humidity","obj_id":"$U_humidity",)ha"
+    R"ha("stat_t":"$S(sensorHumi)","val_tpl":"{{ $J(sensorHumi) }}",)ha"
+    R"ha("dev_cla":"humidity","unit_of_meas":"%","stat_cla":"measurement",$D})ha";
+
+  // Rohwert des LDR (0–1023), keine Lux → ohne device_class
+  const char AMBIENT_LIGHT[] PROGMEM =
+    R"ha({"~":"$B","name":"Ambient light","uniq_id":"$U_ambient_light","obj_id":"$U_ambient_light",)ha"
+    R"ha("stat_t":"$S(ambientLight)","val_tpl":"{{ $J(ambientLight) }}",)ha"
+    R"ha("ic":"mdi:brightness-5","stat_cla":"measurement","ent_cat":"diagnostic",$D})ha";
+
+  const Entity ENTITIES[] = {
+    {"light",  "light",          LIGHT},
+    {"switch", "autobrightness", AUTO_BRIGHTNESS},
+    {"sensor", "temperature",    TEMPERATURE},
+    {"sensor", "humidity",       HUMIDITY},
+    {"sensor", "ambient_light",  AMBIENT_LIGHT},
+  };
+  const uint8_t ENTITY_COUNT = sizeof(ENTITIES) / sizeof(ENTITIES[0]);
+
+  // Zählt alle Zeichen; mit Ziel werden sie gepuffert in Blöcken weitergegeben
+  class Output {
+   public:
+    explicit Output(Print* out) : _out(out), _len(0), _count(0) {}
+
+    void put(char c) {
+      _count++;
+      if (!_out) return;
+      _buf[_len++] = c;
+      if (_len == sizeof(_buf)) flush();
+    }
+
+    void puts(const char* s) {
+      while (*s) put(*s++);
+    }
+
+    void flush() {
+      if (_out && _len) _out->write((const uint8_t*)_buf, _len);
+      _len = 0;
+    }
+
+    size_t count() const { return _count; }
+
+   private:
+    Print* _out;
+    char _buf[64];
+    uint8_t _len;
+    size_t _count;
+  };
+
+  inline void expandInto(PGM_P tpl, const Context& ctx, Output& o) {
+    for (PGM_P p = tpl;; p++) {
+      char c = pgm_read_byte(p);
+      if (c == '\0') return;
+      if (c != '$') {
+        o.put(c);
+        continue;
+      }
+      char marker = pgm_read_byte(++p);
+      char field[24] = "";
+      if (pgm_read_byte(p + 1) == '(') {
+        uint8_t n = 0;
+        for (p += 2; (c = pgm_read_byte(p)) != ')' && c != '\0'; p++) {
+          if (n < sizeof(field) - 1) field[n++] = c;
+        }
+        field[n] = '\0';
+        if (c == '\0') return;
+      }
+      switch (marker) {
+        case 'B': o.puts(ctx.base); break;
+        case 'U': o.puts(ctx.uid); break;
+        case 'N': o.puts(ctx.name); break;
+        case 'V': o.puts(ctx.version); break;
+        case 'E': o.puts(ctx.effects); break;
+        case 'D': expandInto(DEVICE, ctx, o); break;
+        case 'S':
+          o.puts("~/state");
+          if (ctx.delta) {
+            o.put('/');
+            o.puts(field);
+          }
+          break;
+        case 'J':
+        case 'T':
+          if (ctx.delta) {
+            o.puts(marker == 'J' ? "value_json" : "value");
+          } else {
+            o.puts("value_json.");
+            o.puts(field);
+          }
+          break;
+        default:
+          o.put('$');
+          if (marker == '\0') return;
+          o.put(marker);
+      }
+    }
+  }
+
+  // Länge der expandierten Vorlage; mit out wird sie zugleich geschrieben
+  inline size_t expand(PGM_P tpl, const Context& ctx, Print* out) {
+    Output o(out);
+    expandInto(tpl, ctx, o);
+    o.flush();
+    return o.count();
+  }
+
+}  // namespace HaDiscovery
+
+#endif  // HA_DISCOVERY_H
@@ -1,6 +1,5 @@
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
-#include <ESP8266WebServer.h>
 #include <ESP8266mDNS.h>
 #include <PubSubClient.h>
 #include <EEPROM.h>
@@ -10,6 +9,9 @@
 #include <stdarg.h>
 #include <FS.h>
 #include <ArduinoOTA.h>
+#include <coredecls.h> // settimeofday_cb()
+#include <ESPAsyncTCP.h>
+#include <lwip/dns.h>
 extern "C" {
 #include <user_interface.h>
 }
@@ -18,6 +20,10 @@ extern "C" {
 // Für Production-Builds: Kommentiere die nächste Zeile aus
 //#define DEBUG_LOGGING_ENABLED
 
+// Zyklengenaues Tracing (Ringpuffer, Export via /api/trace) aktivieren
+// Für Production-Builds auskommentiert lassen: TRACE_SCOPE() kompiliert dann zu nichts
+//#define TRACE_ENABLED
+
 // Firmware-Version
 #define FIRMWARE_VERSION "1.7.1"
 
@@ -37,6 +43,9 @@ extern "C" {
 #include "Lines.h"
 #include "secrets.h"
 #include "WebInterface.h"
+#include "WebInterfaceGz.h"
+#include "AsyncHttpServer.h"
+#include "RateLimiter.h"
 #include "Pulse.h"
 #include "Waves.h"
 #include "Spiral.h"
@@ -47,8 +56,26 @@ extern "C" {
 #include "SensorClock.h"
 #include "LocalSensor.h"
 #include "Logging.h"
-
-ESP8266WebServer server(80);
+#include "Perf.h"
+#include "Trace.h"
+#include "RtcState.h"
+#include "EepromWriteBack.h"
+#include "ConfigLog.h"
+#include "JsonWriter.h"
+#include "CborWriter.h"
+#include "Metrics.h"
+#include "JsonScan.h"
+#include "ConfigSchema.h"
+#include "EffectRegistry.h"
+#include "MqttCommand.h"
+#include "HaDiscovery.h"
+#include "MqttFrames.h"
+#include "MqttDispatch.h"
+#include "Batch.h"
+#include "MqttQueue.h"
+#include "LightSensor.h"
+
+AsyncHttpServer server(80);
 bool serverStarted = false;
 bool ntpConfigured = false;
 
@@ -66,7 +93,8 @@ const size_t INPUT_OPERATION_MAX = 64;
 // MQTT: Generischer Steuer-/Status-Kanal (keine Präsenz-Logik mehr)
 // Subscribe auf <baseTopic>/cmd, Publish auf <baseTopic>/state
 WiFiClient espClient;
-PubSubClient mqttClient(espClient);
+MqttQueue::AckClient mqttAckClient(espClient);  // Meldet PUBACKs an die Ausgangs-Queue
+PubSubClient mqttClient(mqttAckClient);
 char mqttServer[INPUT_MQTT_SERVER_MAX] = "";  // MQTT Broker IP (wird über Web-UI konfiguriert, kein Default)
 const uint16_t MQTT_PORT_DEFAULT = 1883; // Standard MQTT Port
 uint16_t mqttPort = MQTT_PORT_DEFAULT;
@@ -75,6 +103,23 @@ char mqttPassword[INPUT_MQTT_PASSWORD_MAX] = ""; // Optional
 char mqttBaseTopic[INPUT_MQTT_TOPIC_MAX] = "ikeaclock"; // Basis-Topic für cmd/state
 bool mqttEnabled = false;
 bool mqttStateDirty = false; // Markierung: State-Publish ausstehend
+bool mqttStateSnapshot = false; // Nach (Re-)Connect: alle Felder publishen, Intervall ignorieren
+bool mqttDeltaState = false; // true: geänderte Felder auf <baseTopic>/state/<feld> statt JSON
+const uint16_t MQTT_MIN_INTERVAL_DEFAULT = 500;
+uint16_t mqttMinIntervalMs = MQTT_MIN_INTERVAL_DEFAULT; // Änderungen innerhalb dieses Abstands zusammenfassen
+unsigned long lastMqttStatePublishMs = 0;
+const unsigned long MQTT_QUEUE_INTERVAL_MS = 10;  // Ausgangs-Queue gedrosselt leeren
+unsigned long lastMqttQueueProcessMs = 0;
+// Ein PUBLISH auf <baseTopic>/frame muss komplett in den PubSubClient-Puffer passen,
+// sonst verwirft PubSubClient ihn stillschweigend: volle Sequenz + längstes Topic
+// + Fixed Header (max. 5 Bytes) + Topic-Länge (2 Bytes)
+const uint16_t MQTT_BUFFER_SIZE = MqttFrames::MAX_FRAMES * MqttFrames::RECORD_BYTES +
+                                  INPUT_MQTT_TOPIC_MAX + sizeof("/frame") + 7;
+bool mqttDiscovery = true; // Home Assistant MQTT-Discovery (Entitäten unter homeassistant/...)
+uint32_t haDiscoverySentHash = 0;  // 0 = in diesem Boot noch nicht gesendet
+bool haDiscoveryPending = false;
+bool haDiscoveryRemove = false;    // Discovery abgeschaltet: Entitäten entfernen
+uint32_t statusGeneration = 0; // Zählt Zustands-/Einstellungsänderungen (CBOR-Status, ?since=)
 bool displayEnabled = true; // Display-Status (via API/MQTT/Web steuerbar)
 
 // Restart-Counter für Diagnose
@@ -82,25 +127,21 @@ uint32_t restartCount = 0;
 char lastResetReason[INPUT_RESET_REASON_MAX] = "";
 
 // Restart-Diagnose Variablen
+// lastUptime/lastHeap/lastOperationBeforeRestart stammen aus dem RTC-Memory des
+// vorherigen Laufs; rtcDiag ist der Stand des laufenden Boots (nur RTC, kein Flash)
 unsigned long lastUptimeBeforeRestart = 0;
 uint32_t lastHeapBeforeRestart = 0;
 char lastOperation[INPUT_OPERATION_MAX] = "";
+char lastOperationBeforeRestart[RtcState::DIAG_OPERATION_LEN] = "";
+RtcState::DiagState rtcDiag = {};
 
-// Rate-Limiting für Web-API
-struct RateLimit {
-  unsigned long lastRequest;
-  uint8_t requestCount;
-};
-RateLimit apiRateLimit = {0, 0};
-const unsigned long RATE_LIMIT_WINDOW = 10000; // 10 Sekunden Zeitfenster
-const uint8_t RATE_LIMIT_MAX_REQUESTS = 20; // Max. 20 Requests pro Zeitfenster
+// Rate-Limiting für Web-API: Token-Buckets pro Client-IP (RateLimiter.h)
 
 // MQTT Reconnect mit Exponential Backoff
 unsigned long mqttReconnectBackoff = 1000; // Start mit 1 Sekunde
 const unsigned long MQTT_MAX_BACKOFF = 60000; // Maximal 60 Sekunden
 const unsigned long MQTT_BACKOFF_MULTIPLIER = 2; // Verdoppeln bei jedem Fehlschlag
 
-const unsigned long MQTT_CONNECT_TIMEOUT = 5000; // 5 Sekunden Timeout für Connect-Versuch
 
 // WiFi Reconnect mit Exponential Backoff
 unsigned long wifiReconnectBackoff = 5000;              // Start: 5 Sekunden
@@ -109,6 +150,19 @@ const unsigned long WIFI_RECONNECT_VERIFY_TIMEOUT = 8000; // Timeout für Verbin
 bool wifiReconnecting = false;
 unsigned long wifiReconnectStartMs = 0;
 
+// WiFi Fast-Reconnect: Kanal, BSSID und IP-Konfiguration der letzten erfolgreichen
+// Verbindung liegen im RTC-Memory (übersteht Restart/OTA) und werden zuerst probiert.
+// Erst wenn das scheitert, folgt der normale Scan mit DHCP.
+const unsigned long WIFI_FAST_CONNECT_TIMEOUT = 3000; // Danach Fallback auf vollen Scan
+const unsigned long WIFI_BOOT_CONNECT_TIMEOUT = 15000; // Gesamt-Timeout in setupWiFi()
+const uint8_t WIFI_MAX_FAST_CONNECTS = 8; // Danach wieder DHCP, damit der Router die Lease erneuert
+bool wifiFastConnectUsed = false;   // Letzter WiFi.begin() nutzte den RTC-Cache
+bool wifiStaticIpUsed = false;      // ... inklusive gecachter IP (ohne DHCP)
+
+// Boot-Zeitmessung (millis() seit Boot, 0 = noch nicht erreicht)
+unsigned long bootWifiConnectedMs = 0;
+unsigned long bootFirstMqttPublishMs = 0;
+
 // Brightness Konstanten
 const uint16_t PWM_MAX = 1023;              // Maximale PWM-Wert (ESP8266 analogWrite Range)
 const uint16_t DEFAULT_BRIGHTNESS = 512;    // Standard-Helligkeit (50% von PWM_MAX)
@@ -130,25 +184,15 @@ uint16_t sensorMax = SENSOR_MAX_DEFAULT;           // Maximaler Sensorwert (hell
 const uint8_t LIGHT_SENSOR_PIN = A0; // Analoger Pin für Phototransistor
 
 
-// Auto-Brightness Konstanten (optimiert gegen Watchdog-Resets)
-const uint8_t LIGHT_SENSOR_SAMPLES = 5;     // Reduziert von 10 auf 5 für schnellere Messung
-const uint8_t LIGHT_SENSOR_SAMPLE_DELAY = 10; // Reduziert von 20ms auf 10ms
+// Auto-Brightness Konstanten (Sampling und Median-Filter: siehe LightSensor.h)
 const uint16_t BRIGHTNESS_CHANGE_THRESHOLD = 30; // Erhöht für sanftere Übergänge (nur für große Änderungen)
 const unsigned long AUTO_BRIGHTNESS_UPDATE_INTERVAL = 3000; // 3s Update-Intervall
 
-// Exponential Moving Average für sanftere Helligkeitsanpassung (besser als Simple Moving Average)
-const float EMA_ALPHA_SENSOR = 0.08;  // Reduziert von 0.15 für langsamere Reaktion auf Sensor-Noise
-const float EMA_ALPHA_BRIGHTNESS = 0.12;  // Zusätzliche Glättung für Helligkeitsänderungen
-float emaSensorValue = 0.0;    // Aktueller EMA-Wert für Sensor
-float emaBrightnessValue = 0.0; // EMA-Wert für Helligkeit (zusätzliche Glättung)
-bool emaInitialized = false;   // Ist EMA initialisiert?
-bool emaBrightnessInitialized = false; // Ist Brightness-EMA initialisiert?
-
-// Non-blocking Sensor-Sampling
-uint8_t sensorSampleCount = 0;
-uint32_t sensorSampleSum = 0;
-unsigned long lastSensorSample = 0;
-bool sensorSamplingInProgress = false;
+// Exponential Moving Average für sanftere Helligkeitsanpassung (Q8-Festkomma, alpha in 1/256)
+const uint8_t EMA_ALPHA_SENSOR = 20;      // ≈ 0,08: langsame Reaktion auf Sensor-Noise
+const uint8_t EMA_ALPHA_BRIGHTNESS = 31;  // ≈ 0,12: zusätzliche Glättung für Helligkeitsänderungen
+LightSensor::Ema sensorEma(EMA_ALPHA_SENSOR);
+LightSensor::Ema brightnessEma(EMA_ALPHA_BRIGHTNESS);
 
 // SensorClock globals
 float    g_sensorTemp = NAN;   // Letzte Temperatur von HA (°C), NAN = kein Wert
@@ -193,12 +237,15 @@ const uint16_t EEPROM_NTP_SERVER2_ADDR = 278;       // String (64 bytes)
 const uint16_t EEPROM_HOUR_FORMAT_ADDR = 342;       // bool (1 byte) 24h=1, 12h=0
 const uint16_t EEPROM_RESTART_COUNT_ADDR = 343;     // uint32_t (4 bytes)
 const uint16_t EEPROM_LAST_RESET_REASON_ADDR = 347; // String (32 bytes)
-const uint16_t EEPROM_LAST_UPTIME_ADDR = 379;        // uint32_t (4 bytes) - Uptime vor letztem Restart
-const uint16_t EEPROM_LAST_HEAP_BEFORE_RESTART_ADDR = 383; // uint32_t (4 bytes) - Heap vor Restart
+const uint16_t EEPROM_LAST_UPTIME_ADDR = 379;        // uint32_t (4 bytes) - Legacy, jetzt RTC-Memory
+const uint16_t EEPROM_LAST_HEAP_BEFORE_RESTART_ADDR = 383; // uint32_t (4 bytes) - Legacy, jetzt RTC-Memory
 const uint16_t EEPROM_TZ_STRING_ADDR = 387;          // String (128 bytes) - Zeitzone
 const uint16_t EEPROM_CLOCK_DUR_ADDR = 515;          // uint16_t (2 bytes) – SensorClock Uhren-Folie
 const uint16_t EEPROM_TEMP_DUR_ADDR  = 517;          // uint16_t (2 bytes) – SensorClock Temperatur-Folie
 const uint16_t EEPROM_HUMI_DUR_ADDR  = 519;          // uint16_t (2 bytes) – SensorClock Luftfeuchtigkeits-Folie
+const uint16_t EEPROM_MQTT_DELTA_ADDR = 521;         // bool (1 byte) – State als Einzel-Topics
+const uint16_t EEPROM_MQTT_INTERVAL_ADDR = 522;      // uint16_t (2 bytes) – Mindestabstand State-Publish (ms)
+const uint16_t EEPROM_MQTT_DISCOVERY_ADDR = 524;     // bool (1 byte) – Home Assistant MQTT-Discovery
 
 // Buffer-Größen Konstanten
 const size_t BUFFER_SIZE_HOSTNAME = 32;      // Hostname Buffer
@@ -206,31 +253,36 @@ const size_t BUFFER_SIZE_TIME = 16;          // Zeit-Buffer
 const size_t BUFFER_SIZE_JSON_SMALL = 128;   // Kleiner JSON-Buffer
 const size_t BUFFER_SIZE_JSON_MEDIUM = 256;  // Mittlerer JSON-Buffer
 const size_t BUFFER_SIZE_JSON_LARGE = 512;   // Großer JSON-Buffer
-const size_t BUFFER_SIZE_JSON_BACKUP = 1024; // Backup JSON-Buffer
-const size_t BUFFER_SIZE_JSON_STATUS = 1536; // Status JSON-Buffer (groß wegen vieler Felder)
+const size_t BUFFER_SIZE_JSON_CHUNK = 256;   // Chunk-Puffer für gestreamte JSON-Antworten (Status, Backup)
 const size_t BUFFER_SIZE_CLIENT_ID = 32;     // MQTT Client-ID Buffer
 
 const uint8_t BUTTON_PIN = D4;
 
-Effect *effects[] = {
-  &snakeEffect,
-  &clockEffect,
-  &rainEffect,
-  &bounceEffect,
-  &starsEffect,
-  &linesEffect,
-  &pulseEffect,
-  &wavesEffect,
-  &spiralEffect,
-  &fireEffect,
-  &plasmaEffect,
-  &rippleEffect,
-  &sandClockEffect,
-  &sensorClockEffect
+// Effekt-Registry: ein Eintrag pro Effekt. Daraus erzeugt der Compiler die
+// Namens-Hashtabelle (findEffectIndexByName, /effect/<name>, MQTT) und die
+// Effektliste für /api/status (siehe EffectRegistry.h).
+constexpr EffectRegistry::Entry EFFECTS[] = {
+  {"snake",       &snakeEffect},
+  {"clock",       &clockEffect},
+  {"rain",        &rainEffect},
+  {"bounce",      &bounceEffect},
+  {"stars",       &starsEffect},
+  {"lines",       &linesEffect},
+  {"pulse",       &pulseEffect},
+  {"waves",       &wavesEffect},
+  {"spiral",      &spiralEffect},
+  {"fire",        &fireEffect},
+  {"plasma",      &plasmaEffect},
+  {"ripple",      &rippleEffect},
+  {"sandclock",   &sandClockEffect},
+  {"sensorclock", &sensorClockEffect}
 };
-const uint8_t effectCount = sizeof(effects) / sizeof(effects[0]);
+const uint8_t effectCount = sizeof(EFFECTS) / sizeof(EFFECTS[0]);
+constexpr auto EFFECT_HASH = EffectRegistry::buildHash<EffectRegistry::tableSize(effectCount)>(EFFECTS);
+static_assert(EFFECT_HASH.ok, "Effekt-Namen nicht eindeutig");
+constexpr auto EFFECT_LIST_JSON = EffectRegistry::buildJsonList<EffectRegistry::jsonListSize(EFFECTS)>(EFFECTS);
 uint8_t currentEffectIndex = 12; // start with sandclock
-Effect *currentEffect = effects[currentEffectIndex];
+Effect *currentEffect = EFFECTS[currentEffectIndex].effect;
 // POSIX TZ String mit automatischer Sommer-/Winterzeit-Umstellung (DST)
 // Format: STD<offset>DST<offset>,start[/time],end[/time]
 // Beispiel: CET-1CEST-2,M3.5.0/02,M10.5.0/03
@@ -286,56 +338,164 @@ bool isValidMqttBaseTopic(const char* topic) {
   return true;
 }
 
+// NTP-Server müssen wie ein Hostname/eine IP aussehen (mindestens ein Punkt)
+bool isValidNtpServer(const char* server) {
+  return server != nullptr && strchr(server, '.') != nullptr;
+}
+
+bool isValidTzString(const char* tz);
+
+// === Konfigurations-Schema ===
+// Einzige Stelle, an der Einstellungen beschrieben werden. Laden, Persistieren,
+// Backup, Restore und der Konfigurationsteil von /api/status werden daraus erzeugt
+// (siehe ConfigSchema.h). storageAddr ist zugleich der ConfigLog-Key.
+using namespace ConfigSchema;
+const uint8_t CFG_BACKUP_STATUS = FLAG_BACKUP | FLAG_STATUS;
+const uint8_t CFG_SETTING = CFG_BACKUP_STATUS | FLAG_BATCH;  // Zusätzlich per /api/batch setzbar
+
+constexpr Field CONFIG_SCHEMA[] = {
+  // name              alias                       type         group             flags                                   ptr                     size                   storageAddr                    storageSize                   min  max                 default                   defStr               validate
+  {"brightness",      nullptr,                    TYPE_U16,    GROUP_BRIGHTNESS, CFG_SETTING | FLAG_CLAMP,               &brightness,            0,                     EEPROM_BRIGHTNESS_ADDR,        2,                            0,   PWM_MAX,            DEFAULT_BRIGHTNESS,       nullptr,             nullptr},
+  {"autoBrightness",  "autoBrightnessEnabled",    TYPE_BOOL,   GROUP_BRIGHTNESS, CFG_SETTING,                            &autoBrightnessEnabled, 0,                     EEPROM_AUTO_BRIGHTNESS_ADDR,   1,                            0,   1,                  0,                        nullptr,             nullptr},
+  {"minBrightness",   "autoBrightnessMin",        TYPE_U16,    GROUP_BRIGHTNESS, CFG_SETTING | FLAG_CLAMP,               &minBrightness,         0,                     EEPROM_MIN_BRIGHTNESS_ADDR,    2,                            0,   PWM_MAX,            MIN_BRIGHTNESS_DEFAULT,   nullptr,             nullptr},
+  {"maxBrightness",   "autoBrightnessMax",        TYPE_U16,    GROUP_BRIGHTNESS, CFG_SETTING | FLAG_CLAMP,               &maxBrightness,         0,                     EEPROM_MAX_BRIGHTNESS_ADDR,    2,                            0,   PWM_MAX,            MAX_BRIGHTNESS_DEFAULT,   nullptr,             nullptr},
+  {"sensorMin",       "autoBrightnessSensorMin",  TYPE_U16,    GROUP_BRIGHTNESS, CFG_SETTING | FLAG_CLAMP,               &sensorMin,             0,                     EEPROM_SENSOR_MIN_ADDR,        2,                            0,   PWM_MAX,            SENSOR_MIN_DEFAULT,       nullptr,             nullptr},
+  {"sensorMax",       "autoBrightnessSensorMax",  TYPE_U16,    GROUP_BRIGHTNESS, CFG_SETTING | FLAG_CLAMP,               &sensorMax,             0,                     EEPROM_SENSOR_MAX_ADDR,        2,                            0,   PWM_MAX,            SENSOR_MAX_DEFAULT,       nullptr,             nullptr},
+  {"use24HourFormat", nullptr,                    TYPE_BOOL,   GROUP_BRIGHTNESS, CFG_SETTING,                            &use24HourFormat,       0,                     EEPROM_HOUR_FORMAT_ADDR,       1,                            0,   1,                  1,                        nullptr,             nullptr},
+  {"tz",              "timezone",                 TYPE_STRING, GROUP_BRIGHTNESS, CFG_SETTING,                            tzString,               sizeof(tzString),      EEPROM_TZ_STRING_ADDR,         EEPROM_TZ_STRING_LEN,         0,   0,                  0,                        "CET-1CEST-2,M3.5.0/02,M10.5.0/03", isValidTzString},
+  {"mqttEnabled",     nullptr,                    TYPE_BOOL,   GROUP_MQTT,       CFG_BACKUP_STATUS,                      &mqttEnabled,           0,                     EEPROM_MQTT_ENABLED_ADDR,      1,                            0,   1,                  0,                        nullptr,             nullptr},
+  {"mqttServer",      nullptr,                    TYPE_STRING, GROUP_MQTT,       CFG_BACKUP_STATUS | FLAG_ALLOW_EMPTY,   mqttServer,             sizeof(mqttServer),    EEPROM_MQTT_SERVER_ADDR,       EEPROM_MQTT_SERVER_LEN,       0,   0,                  0,                        "",                  nullptr},
+  {"mqttPort",        nullptr,                    TYPE_U16,    GROUP_MQTT,       CFG_BACKUP_STATUS,                      &mqttPort,              0,                     EEPROM_MQTT_PORT_ADDR,         2,                            1,   65535,              MQTT_PORT_DEFAULT,        nullptr,             nullptr},
+  {"mqttUser",        nullptr,                    TYPE_STRING, GROUP_MQTT,       FLAG_BACKUP | FLAG_ALLOW_EMPTY,         mqttUser,               sizeof(mqttUser),      EEPROM_MQTT_USER_ADDR,         EEPROM_MQTT_USER_LEN,         0,   0,                  0,                        "",                  nullptr},
+  {"mqttPassword",    nullptr,                    TYPE_STRING, GROUP_MQTT,       FLAG_ALLOW_EMPTY,                       mqttPassword,           sizeof(mqttPassword),  EEPROM_MQTT_PASSWORD_ADDR,     EEPROM_MQTT_PASSWORD_LEN,     0,   0,                  0,                        "",                  nullptr},
+  {"mqttBaseTopic",   "mqttTopic",                TYPE_STRING, GROUP_MQTT,       CFG_BACKUP_STATUS,                      mqttBaseTopic,          sizeof(mqttBaseTopic), EEPROM_MQTT_TOPIC_ADDR,        EEPROM_MQTT_TOPIC_LEN,        0,   0,                  0,                        "ikeaclock",         isValidMqttBaseTopic},
+  {"mqttDeltaState",  nullptr,                    TYPE_BOOL,   GROUP_MQTT,       CFG_BACKUP_STATUS,                      &mqttDeltaState,        0,                     EEPROM_MQTT_DELTA_ADDR,        1,                            0,   1,                  0,                        nullptr,             nullptr},
+  {"mqttMinInterval", nullptr,                    TYPE_U16,    GROUP_MQTT,       CFG_BACKUP_STATUS | FLAG_CLAMP,         &mqttMinIntervalMs,     0,                     EEPROM_MQTT_INTERVAL_ADDR,     2,                            0,   60000,              MQTT_MIN_INTERVAL_DEFAULT, nullptr,            nullptr},
+  {"mqttDiscovery",   nullptr,                    TYPE_BOOL,   GROUP_MQTT,       CFG_BACKUP_STATUS,                      &mqttDiscovery,         0,                     EEPROM_MQTT_DISCOVERY_ADDR,    1,                            0,   1,                  1,                        nullptr,             nullptr},
+  {"ntpServer1",      nullptr,                    TYPE_STRING, GROUP_NTP,        FLAG_BACKUP,                            ntpServer1,             sizeof(ntpServer1),    EEPROM_NTP_SERVER1_ADDR,       EEPROM_NTP_SERVER_LEN,        0,   0,                  0,                        "pool.ntp.org",      isValidNtpServer},
+  {"ntpServer2",      nullptr,                    TYPE_STRING, GROUP_NTP,        FLAG_BACKUP,                            ntpServer2,             sizeof(ntpServer2),    EEPROM_NTP_SERVER2_ADDR,       EEPROM_NTP_SERVER_LEN,        0,   0,                  0,                        "time.nist.gov",     isValidNtpServer},
+  {"clockDur",        nullptr,                    TYPE_U16,    GROUP_SLIDES,     CFG_SETTING,                            &g_clockDur,            0,                     EEPROM_CLOCK_DUR_ADDR,         2,                            1,   3600,               10,                       nullptr,             nullptr},
+  {"tempDur",         nullptr,                    TYPE_U16,    GROUP_SLIDES,     CFG_SETTING,                            &g_tempDur,             0,                     EEPROM_TEMP_DUR_ADDR,          2,                            1,   3600,               5,                        nullptr,             nullptr},
+  {"humiDur",         nullptr,                    TYPE_U16,    GROUP_SLIDES,     CFG_SETTING,                            &g_humiDur,             0,                     EEPROM_HUMI_DUR_ADDR,          2,                            1,   3600,               5,                        nullptr,             nullptr},
+  {"restartCount",    nullptr,                    TYPE_U32,    GROUP_RESTART,    FLAG_STATUS,                            &restartCount,          0,                     EEPROM_RESTART_COUNT_ADDR,     4,                            0,   INT32_MAX,          0,                        nullptr,             nullptr},
+  {"lastResetReason", nullptr,                    TYPE_STRING, GROUP_RESTART,    FLAG_STATUS | FLAG_ALLOW_EMPTY,         lastResetReason,        sizeof(lastResetReason), EEPROM_LAST_RESET_REASON_ADDR, EEPROM_RESET_REASON_LEN,    0,   0,                  0,                        "",                  nullptr},
+};
+const uint8_t CONFIG_SCHEMA_COUNT = sizeof(CONFIG_SCHEMA) / sizeof(CONFIG_SCHEMA[0]);
+
+// ConfigLog-Felder: Version/Magic + alle Schema-Felder (beim Boot aus dem Schema erzeugt)
+ConfigLog::Field configLogFields[CONFIG_SCHEMA_COUNT + 2];
+static_assert(CONFIG_SCHEMA_COUNT + 2 <= ConfigLog::MAX_FIELDS, "ConfigLog::MAX_FIELDS zu klein für CONFIG_SCHEMA");
+
+uint8_t buildConfigLogFields() {
+  uint8_t n = 0;
+  configLogFields[n++] = {EEPROM_VERSION_ADDR, 1, ConfigLog::FIELD_BINARY};
+  configLogFields[n++] = {EEPROM_MAGIC_ADDR, 1, ConfigLog::FIELD_BINARY};
+  for (uint8_t i = 0; i < CONFIG_SCHEMA_COUNT; i++) {
+    const Field& f = CONFIG_SCHEMA[i];
+    configLogFields[n++] = {f.storageAddr, (uint8_t)f.storageSize,
+                            f.type == TYPE_STRING ? ConfigLog::FIELD_STRING : ConfigLog::FIELD_BINARY};
+  }
+  return n;
+}
+
 // Helper-Funktionen für EEPROM-Operationen
 // Initialisiert EEPROM mit Version und Magic Byte (falls noch nicht gesetzt)
 void ensureEEPROMInitialized() {
   uint8_t storedVersion = EEPROM.read(EEPROM_VERSION_ADDR);
   uint8_t storedMagic = EEPROM.read(EEPROM_MAGIC_ADDR);
   if (storedVersion != EEPROM_VERSION || storedMagic != EEPROM_MAGIC) {
-    EEPROM.write(EEPROM_VERSION_ADDR, EEPROM_VERSION);
-    EEPROM.write(EEPROM_MAGIC_ADDR, EEPROM_MAGIC);
+    EepromWriteBack::write(EEPROM_VERSION_ADDR, EEPROM_VERSION);
+    EepromWriteBack::write(EEPROM_MAGIC_ADDR, EEPROM_MAGIC);
   }
 }
 
-// Commit EEPROM-Änderungen mit Watchdog-Fütterung und Logging
-void commitEEPROMWithWatchdog(const char* operationName) {
+// Merkt sich die aktuelle kritische Operation in RAM und RTC-Memory.
+// Kostet wenige µs (kein Flash) — nach einem Crash zeigt der nächste Boot,
+// wobei das Gerät hängen geblieben ist.
+void setLastOperation(const char* operationName) {
   strncpy(lastOperation, operationName, sizeof(lastOperation) - 1);
   lastOperation[sizeof(lastOperation) - 1] = '\0';
-  debugLogJson(operationName, "EEPROM commit start", "C", "{\"freeHeap\":%d}", ESP.getFreeHeap());
+  strncpy(rtcDiag.lastOperation, operationName, sizeof(rtcDiag.lastOperation) - 1);
+  rtcDiag.lastOperation[sizeof(rtcDiag.lastOperation) - 1] = '\0';
+  rtcDiag.uptimeMs = millis();
+  rtcDiag.freeHeap = ESP.getFreeHeap();
+  RtcState::write(RtcState::DIAG_SLOT, rtcDiag);
+}
+
+// Commit EEPROM-Änderungen mit Watchdog-Fütterung und Logging
+bool commitEEPROMWithWatchdog(const char* operationName) {
+  TRACE_SCOPE("EEPROM.commit");
+  setLastOperation(operationName);
+  debugLogJson(operationName, "EEPROM commit start", "C", "{\"freeHeap\":%d,\"dirtyBytes\":%u}",
+               ESP.getFreeHeap(), EepromWriteBack::dirtyBytes());
   
   // Watchdog vor blockierender EEPROM-Operation füttern
   ESP.wdtFeed();
-  EEPROM.commit();
+  bool ok = EEPROM.commit();
   // Watchdog nach blockierender EEPROM-Operation füttern
   ESP.wdtFeed();
   
-  debugLogJson(operationName, "EEPROM commit end", "C", "{\"freeHeap\":%d}", ESP.getFreeHeap());
+  debugLogJson(operationName, "EEPROM commit end", "C", "{\"freeHeap\":%d,\"ok\":%s}",
+               ESP.getFreeHeap(), ok ? "true" : "false");
+  return ok;
 }
 
-// Schreibt einen C-String in EEPROM (maxLen inkl. Null-Terminator)
-void writeStringToEEPROM(uint16_t addr, const char* str, uint16_t maxLen) {
-  uint16_t len = strlen(str);
-  if (len >= maxLen) {
-    len = maxLen - 1; // Platz für Null-Terminator lassen
+// Schreibt die geänderten Felder als Records in den Log-Store (kein Sektor-Erase,
+// außer bei einer Kompaktierung)
+bool commitConfigLog(const char* operationName) {
+  TRACE_SCOPE("ConfigLog.commit");
+  setLastOperation(operationName);
+  ESP.wdtFeed();
+  uint32_t bytesBefore = ConfigLog::bytesWritten;
+  bool ok = ConfigLog::commitRange(EepromWriteBack::dirtyLo, EepromWriteBack::dirtyHi);
+  ESP.wdtFeed();
+  debugLogJson(operationName, "ConfigLog commit", "C", "{\"ok\":%s,\"bytes\":%lu,\"compactions\":%lu}",
+               ok ? "true" : "false", (unsigned long)(ConfigLog::bytesWritten - bytesBefore),
+               (unsigned long)ConfigLog::compactions);
+  return ok;
+}
+
+// Prüfsumme für Backup/Diagnose: im Log-Store aus den Record-CRCs, sonst der
+// gespeicherte EEPROM-Wert (wird bei jedem persist*() aktuell gehalten)
+uint16_t configChecksum() {
+  if (ConfigLog::mounted) {
+    return ConfigLog::contentChecksum();
   }
-  for (uint16_t i = 0; i < len; i++) {
-    EEPROM.write(addr + i, str[i]);
+  uint16_t stored;
+  EEPROM.get(EEPROM_CHECKSUM_ADDR, stored);
+  return stored;
+}
+
+// Abschluss eines persist*()-Aufrufs: Checksumme aktualisieren und den Commit
+// dem Write-Back überlassen (zusammengefasst nach EepromWriteBack::QUIET_PERIOD_MS)
+void scheduleEEPROMCommit(const char* source) {
+  // Im Log-Store hat jeder Record seine eigene CRC — keine Gesamt-Checksumme nötig
+  if (!ConfigLog::mounted) {
+    EepromWriteBack::put(EEPROM_CHECKSUM_ADDR, calculateEEPROMChecksum());
   }
-  EEPROM.write(addr + len, 0); // Null-Terminator
+  EepromWriteBack::noteRequest(source);
 }
 
-// Liest einen C-String aus EEPROM in den bereitgestellten Buffer
-// Gibt die Anzahl gelesener Zeichen zurück (ohne Null-Terminator)
-uint16_t readStringFromEEPROM(uint16_t addr, char* buffer, uint16_t bufferSize) {
-  if (bufferSize == 0) return 0;
-  uint16_t i = 0;
-  for (; i < bufferSize - 1; i++) {
-    char c = EEPROM.read(addr + i);
-    if (c == 0) break;
-    buffer[i] = c;
+// Schreibt ausstehende Änderungen sofort ins Flash. Vor Restart, OTA und Restore
+// aufrufen; sonst erledigt das loop() nach der Ruhezeit.
+void flushEEPROM(const char* reason) {
+  if (!EepromWriteBack::isDirty()) {
+    return;
+  }
+  Serial.printf("[EEPROM] Commit (%s, last change: %s, %u bytes dirty)\n",
+                reason, EepromWriteBack::pendingSource, EepromWriteBack::dirtyBytes());
+  bool ok;
+  if (ConfigLog::mounted) {
+    ok = commitConfigLog(EepromWriteBack::pendingSource);
+  } else {
+    ok = commitEEPROMWithWatchdog(EepromWriteBack::pendingSource);
+  }
+  if (ok) {
+    EepromWriteBack::markClean();
+  } else {
+    EepromWriteBack::markFailed();
+    Serial.println("[EEPROM] Commit failed, will retry");
   }
-  buffer[i] = '\0'; // Null-Terminator sicherstellen
-  return i;
 }
 
 // Berechnet Checksumme über alle EEPROM-Daten (ab EEPROM_BRIGHTNESS_ADDR bis EEPROM_SIZE)
@@ -350,6 +510,11 @@ uint16_t calculateEEPROMChecksum() {
 
 // Validiert EEPROM-Daten: Version, Magic Byte und Checksumme
 bool validateEEPROM() {
+  // Log-Store: jeder Record wurde beim Mount per CRC32 geprüft
+  if (ConfigLog::mounted) {
+    return EEPROM.read(EEPROM_MAGIC_ADDR) == EEPROM_MAGIC;
+  }
+
   uint8_t version = EEPROM.read(EEPROM_VERSION_ADDR);
   uint8_t magic = EEPROM.read(EEPROM_MAGIC_ADDR);
   uint16_t storedChecksum;
@@ -369,327 +534,149 @@ bool validateEEPROM() {
   return false;
 }
 
-void loadBrightnessFromStorage() {
+// Log-Store: Felder ohne Record (nach einem Update neu) sind nicht gespeichert
+bool configFieldStored(uint16_t storageAddr) {
+  return !ConfigLog::mounted || ConfigLog::hasRecord(storageAddr);
+}
+
+void loadConfigFromStorage() {
   // Prüfe ob EEPROM initialisiert und gültig ist
   if (validateEEPROM()) {
-    // EEPROM ist gültig, lade Daten
-    uint16_t stored = DEFAULT_BRIGHTNESS;
-    EEPROM.get(EEPROM_BRIGHTNESS_ADDR, stored);
-    brightness = constrain(stored, 0, PWM_MAX);
-
-    // Auto-Brightness-Einstellungen laden
-    autoBrightnessEnabled = EEPROM.read(EEPROM_AUTO_BRIGHTNESS_ADDR) == 1;
-    EEPROM.get(EEPROM_MIN_BRIGHTNESS_ADDR, minBrightness);
-    EEPROM.get(EEPROM_MAX_BRIGHTNESS_ADDR, maxBrightness);
-    EEPROM.get(EEPROM_SENSOR_MIN_ADDR, sensorMin);
-    EEPROM.get(EEPROM_SENSOR_MAX_ADDR, sensorMax);
-
-    // MQTT-Einstellungen laden
-    mqttEnabled = EEPROM.read(EEPROM_MQTT_ENABLED_ADDR) == 1;
-    readStringFromEEPROM(EEPROM_MQTT_SERVER_ADDR, mqttServer, sizeof(mqttServer));
-    EEPROM.get(EEPROM_MQTT_PORT_ADDR, mqttPort);
-    readStringFromEEPROM(EEPROM_MQTT_USER_ADDR, mqttUser, sizeof(mqttUser));
-    readStringFromEEPROM(EEPROM_MQTT_PASSWORD_ADDR, mqttPassword, sizeof(mqttPassword));
-    readStringFromEEPROM(EEPROM_MQTT_TOPIC_ADDR, mqttBaseTopic, sizeof(mqttBaseTopic));
-    // EEPROM_PRESENCE_TIMEOUT_ADDR ist legacy und wird ignoriert (Layout bleibt für Kompatibilität)
-    // Migration: Alte Präsenz-Topics durch Default ersetzen
-    if (!isValidMqttBaseTopic(mqttBaseTopic)) {
-      strncpy(mqttBaseTopic, "ikeaclock", sizeof(mqttBaseTopic) - 1);
-      mqttBaseTopic[sizeof(mqttBaseTopic) - 1] = '\0';
-    }
-    
-    // NTP-Server laden
-    char loadedNtp1[EEPROM_NTP_SERVER_LEN + 1];
-    char loadedNtp2[EEPROM_NTP_SERVER_LEN + 1];
-    readStringFromEEPROM(EEPROM_NTP_SERVER1_ADDR, loadedNtp1, sizeof(loadedNtp1));
-    readStringFromEEPROM(EEPROM_NTP_SERVER2_ADDR, loadedNtp2, sizeof(loadedNtp2));
-    // Validierung: Nur verwenden wenn String nicht leer ist und gültig aussieht (enthält Punkt für Domain)
-    if (strlen(loadedNtp1) > 0 && strlen(loadedNtp1) < EEPROM_NTP_SERVER_LEN && strchr(loadedNtp1, '.') != nullptr) {
-      strncpy(ntpServer1, loadedNtp1, sizeof(ntpServer1) - 1);
-      ntpServer1[sizeof(ntpServer1) - 1] = '\0';
-    }
-    if (strlen(loadedNtp2) > 0 && strlen(loadedNtp2) < EEPROM_NTP_SERVER_LEN && strchr(loadedNtp2, '.') != nullptr) {
-      strncpy(ntpServer2, loadedNtp2, sizeof(ntpServer2) - 1);
-      ntpServer2[sizeof(ntpServer2) - 1] = '\0';
-    }
-    use24HourFormat = EEPROM.read(EEPROM_HOUR_FORMAT_ADDR) != 0;
-
-    // SensorClock Slide-Dauern laden
-    EEPROM.get(EEPROM_CLOCK_DUR_ADDR, g_clockDur);
-    EEPROM.get(EEPROM_TEMP_DUR_ADDR,  g_tempDur);
-    EEPROM.get(EEPROM_HUMI_DUR_ADDR,  g_humiDur);
-    if (g_clockDur < 1 || g_clockDur > 3600) g_clockDur = 10;
-    if (g_tempDur  < 1 || g_tempDur  > 3600) g_tempDur  = 5;
-    if (g_humiDur  < 1 || g_humiDur  > 3600) g_humiDur  = 5;
-
-    // Zeitzone laden
-    char loadedTz[EEPROM_TZ_STRING_LEN + 1];
-    readStringFromEEPROM(EEPROM_TZ_STRING_ADDR, loadedTz, sizeof(loadedTz));
-    // Validierung: Nur verwenden wenn String nicht leer ist
-    if (strlen(loadedTz) > 0 && strlen(loadedTz) < EEPROM_TZ_STRING_LEN) {
-      strncpy(tzString, loadedTz, sizeof(tzString) - 1);
+    // Alle Felder laut Schema laden (ungültige oder fehlende Werte → Default)
+    uint8_t missing = ConfigSchema::load(CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, configFieldStored);
+    if (missing) {
+      Serial.printf("[Config] New fields, storing defaults (groups 0x%02X)\n", missing);
+      persistConfigGroups(missing, "loadConfigFromStorage");
+    }
+
+    // Migration: Korrigiere altes TZ-Format ohne expliziten DST-Offset
+    // Alt: "CET-1CEST,M3.5.0/02,M10.5.0/03"
+    // Neu: "CET-1CEST-2,M3.5.0/02,M10.5.0/03"
+    if (strstr(tzString, "CET-1CEST,") != nullptr && strstr(tzString, "CEST-2") == nullptr) {
+      Serial.println("[EEPROM] Migriere TZ-String: Füge expliziten DST-Offset hinzu");
+      strncpy(tzString, "CET-1CEST-2,M3.5.0/02,M10.5.0/03", sizeof(tzString) - 1);
       tzString[sizeof(tzString) - 1] = '\0';
-      
-      // Migration: Korrigiere altes TZ-Format ohne expliziten DST-Offset
-      // Alt: "CET-1CEST,M3.5.0/02,M10.5.0/03"
-      // Neu: "CET-1CEST-2,M3.5.0/02,M10.5.0/03"
-      if (strstr(tzString, "CET-1CEST,") != nullptr && strstr(tzString, "CEST-2") == nullptr) {
-        Serial.println("[EEPROM] Migriere TZ-String: Füge expliziten DST-Offset hinzu");
-        // Ersetze direkt den gesamten String
-        const char* newTz = "CET-1CEST-2,M3.5.0/02,M10.5.0/03";
-        strncpy(tzString, newTz, sizeof(tzString) - 1);
-        tzString[sizeof(tzString) - 1] = '\0';
-        // Speichere migrierten Wert zurück
-        writeStringToEEPROM(EEPROM_TZ_STRING_ADDR, tzString, EEPROM_TZ_STRING_LEN + 1);
-        uint16_t checksum = calculateEEPROMChecksum();
-        EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-        commitEEPROMWithWatchdog("TZ migration");
-        Serial.printf("[EEPROM] TZ-String migriert zu: %s\n", tzString);
-      }
+      persistBrightnessToStorage();
+      Serial.printf("[EEPROM] TZ-String migriert zu: %s\n", tzString);
     }
 
-    // Restart-Counter laden (nur wenn EEPROM_VERSION >= 2)
-    uint8_t version = EEPROM.read(EEPROM_VERSION_ADDR);
-    if (version >= 2) {
-      EEPROM.get(EEPROM_RESTART_COUNT_ADDR, restartCount);
-      readStringFromEEPROM(EEPROM_LAST_RESET_REASON_ADDR, lastResetReason, sizeof(lastResetReason));
-    } else {
-      // Migration von Version 1: Restart-Counter auf 0 setzen
+    // Restart-Counter gibt es erst ab EEPROM_VERSION 2
+    if (EEPROM.read(EEPROM_VERSION_ADDR) < 2) {
       restartCount = 0;
       lastResetReason[0] = '\0';
     }
 
-    // Uptime und Heap vor Restart laden (nur wenn EEPROM_VERSION >= 3)
-    if (version >= 3) {
-      EEPROM.get(EEPROM_LAST_UPTIME_ADDR, lastUptimeBeforeRestart);
-      EEPROM.get(EEPROM_LAST_HEAP_BEFORE_RESTART_ADDR, lastHeapBeforeRestart);
-    } else {
-      lastUptimeBeforeRestart = 0;
-      lastHeapBeforeRestart = 0;
-    }
-
-    // Werte validieren und korrigieren falls nötig
-    minBrightness = constrain(minBrightness, 0, PWM_MAX);
-    maxBrightness = constrain(maxBrightness, 0, PWM_MAX);
-    sensorMin = constrain(sensorMin, 0, PWM_MAX);
-    sensorMax = constrain(sensorMax, 0, PWM_MAX);
-    if (mqttPort == 0 || mqttPort > 65535) mqttPort = MQTT_PORT_DEFAULT;
-    
+    // Uptime und Heap vor Restart kommen aus dem RTC-Memory (loadRestartDiagFromRtc()),
+    // EEPROM_LAST_UPTIME_ADDR / EEPROM_LAST_HEAP_BEFORE_RESTART_ADDR sind nur noch reserviert
     Serial.println("EEPROM data loaded and validated successfully");
   } else {
     // EEPROM ungültig oder nicht initialisiert, verwende Defaults
     Serial.println("EEPROM invalid or not initialized, using defaults");
-    brightness = DEFAULT_BRIGHTNESS;
-    autoBrightnessEnabled = false;
-    minBrightness = MIN_BRIGHTNESS_DEFAULT;
-    maxBrightness = MAX_BRIGHTNESS_DEFAULT;
-    sensorMin = SENSOR_MIN_DEFAULT;
-    sensorMax = SENSOR_MAX_DEFAULT;
-    mqttEnabled = false;
-    mqttServer[0] = '\0';
-    mqttPort = MQTT_PORT_DEFAULT;
-    mqttUser[0] = '\0';
-    mqttPassword[0] = '\0';
-    strncpy(mqttBaseTopic, "ikeaclock", sizeof(mqttBaseTopic) - 1);
-    mqttBaseTopic[sizeof(mqttBaseTopic) - 1] = '\0';
-    strncpy(ntpServer1, "pool.ntp.org", sizeof(ntpServer1) - 1);
-    ntpServer1[sizeof(ntpServer1) - 1] = '\0';
-    strncpy(ntpServer2, "time.nist.gov", sizeof(ntpServer2) - 1);
-    ntpServer2[sizeof(ntpServer2) - 1] = '\0';
-    use24HourFormat = true;
-    // Zeitzone: Standardwert verwenden (bereits in tzString initialisiert)
-    g_clockDur = 10;
-    g_tempDur  = 5;
-    g_humiDur  = 5;
-    restartCount = 0;
-    lastResetReason[0] = '\0';
-    lastUptimeBeforeRestart = 0;
-    lastHeapBeforeRestart = 0;
+    ConfigSchema::applyDefaults(CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT);
   }
 }
 
-void persistBrightnessToStorage() {
-  ensureEEPROMInitialized();
-  
-  // Daten schreiben
-  EEPROM.put(EEPROM_BRIGHTNESS_ADDR, brightness);
-  EEPROM.write(EEPROM_AUTO_BRIGHTNESS_ADDR, autoBrightnessEnabled ? 1 : 0);
-  EEPROM.put(EEPROM_MIN_BRIGHTNESS_ADDR, minBrightness);
-  EEPROM.put(EEPROM_MAX_BRIGHTNESS_ADDR, maxBrightness);
-  EEPROM.put(EEPROM_SENSOR_MIN_ADDR, sensorMin);
-  EEPROM.put(EEPROM_SENSOR_MAX_ADDR, sensorMax);
-  EEPROM.write(EEPROM_HOUR_FORMAT_ADDR, use24HourFormat ? 1 : 0);
-  writeStringToEEPROM(EEPROM_TZ_STRING_ADDR, tzString, EEPROM_TZ_STRING_LEN + 1);
-  
-  // Checksumme berechnen und speichern
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  
-  // Commit mit Watchdog-Fütterung
-  commitEEPROMWithWatchdog("persistBrightnessToStorage");
+// Zustand (Display, Effekt, Helligkeit, MQTT-Verbindung) geändert: MQTT-State
+// publishen und Generation für Status-Poller erhöhen
+void markStateChanged() {
+  mqttStateDirty = true;
+  statusGeneration++;
 }
 
-void persistSlideConfig() {
+// Schreibt alle Schema-Felder der Gruppen in den Shadow; Commit über den Write-Back
+void persistConfigGroups(uint8_t groups, const char* source) {
+  statusGeneration++;
   ensureEEPROMInitialized();
-  EEPROM.put(EEPROM_CLOCK_DUR_ADDR, g_clockDur);
-  EEPROM.put(EEPROM_TEMP_DUR_ADDR,  g_tempDur);
-  EEPROM.put(EEPROM_HUMI_DUR_ADDR,  g_humiDur);
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  commitEEPROMWithWatchdog("persistSlideConfig");
+  ConfigSchema::store(CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, groups);
+  scheduleEEPROMCommit(source);
 }
 
-void persistMqttToStorage() {
-  // Version und Magic Byte setzen (falls noch nicht gesetzt)
-  EEPROM.write(EEPROM_VERSION_ADDR, EEPROM_VERSION);
-  EEPROM.write(EEPROM_MAGIC_ADDR, EEPROM_MAGIC);
-  
-  // MQTT-Daten schreiben
-  EEPROM.write(EEPROM_MQTT_ENABLED_ADDR, mqttEnabled ? 1 : 0);
-  writeStringToEEPROM(EEPROM_MQTT_SERVER_ADDR, mqttServer, EEPROM_MQTT_SERVER_LEN + 1);
-  EEPROM.put(EEPROM_MQTT_PORT_ADDR, mqttPort);
-  writeStringToEEPROM(EEPROM_MQTT_USER_ADDR, mqttUser, EEPROM_MQTT_USER_LEN + 1);
-  writeStringToEEPROM(EEPROM_MQTT_PASSWORD_ADDR, mqttPassword, EEPROM_MQTT_PASSWORD_LEN + 1);
-  writeStringToEEPROM(EEPROM_MQTT_TOPIC_ADDR, mqttBaseTopic, EEPROM_MQTT_TOPIC_LEN + 1);
-  
-  // Checksumme berechnen und speichern
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  
-  // Kritische Operation: EEPROM.commit()
-  strncpy(lastOperation, "persistMqttToStorage", sizeof(lastOperation) - 1);
-  lastOperation[sizeof(lastOperation) - 1] = '\0';
-  // Commit mit Watchdog-Fütterung
-  commitEEPROMWithWatchdog("persistMqttToStorage");
+void persistBrightnessToStorage() {
+  persistConfigGroups(GROUP_BRIGHTNESS, "persistBrightnessToStorage");
 }
 
-// Speichert Restart-Counter und Reset-Grund in EEPROM
-void persistRestartInfo() {
-  EEPROM.put(EEPROM_RESTART_COUNT_ADDR, restartCount);
-  writeStringToEEPROM(EEPROM_LAST_RESET_REASON_ADDR, lastResetReason, EEPROM_RESET_REASON_LEN + 1);
-  
-  // Checksumme neu berechnen und speichern (Restart-Info ist Teil der Checksumme)
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  
-  // Watchdog vor blockierender EEPROM-Operation füttern
-  ESP.wdtFeed();
-  EEPROM.commit();
-  // Watchdog nach blockierender EEPROM-Operation füttern
-  ESP.wdtFeed();
+void persistSlideConfig() {
+  persistConfigGroups(GROUP_SLIDES, "persistSlideConfig");
 }
 
-// Speichert Uptime und Heap-Status vor Restart in EEPROM
-void persistUptimeHeapStatus() {
-  lastUptimeBeforeRestart = millis();
-  lastHeapBeforeRestart = ESP.getFreeHeap();
-  
-  EEPROM.put(EEPROM_LAST_UPTIME_ADDR, lastUptimeBeforeRestart);
-  EEPROM.put(EEPROM_LAST_HEAP_BEFORE_RESTART_ADDR, lastHeapBeforeRestart);
-  
-  // Checksumme neu berechnen und speichern
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  
-  // Watchdog vor blockierender EEPROM-Operation füttern
-  ESP.wdtFeed();
-  EEPROM.commit();
-  // Watchdog nach blockierender EEPROM-Operation füttern
-  ESP.wdtFeed();
+void persistMqttToStorage() {
+  persistConfigGroups(GROUP_MQTT, "persistMqttToStorage");
 }
 
-void persistNtpToStorage() {
-  ensureEEPROMInitialized();
-  writeStringToEEPROM(EEPROM_NTP_SERVER1_ADDR, ntpServer1, EEPROM_NTP_SERVER_LEN + 1);
-  writeStringToEEPROM(EEPROM_NTP_SERVER2_ADDR, ntpServer2, EEPROM_NTP_SERVER_LEN + 1);
-  uint16_t checksum = calculateEEPROMChecksum();
-  EEPROM.put(EEPROM_CHECKSUM_ADDR, checksum);
-  commitEEPROMWithWatchdog("persistNtpToStorage");
+// Speichert Restart-Counter und Reset-Grund
+void persistRestartInfo() {
+  persistConfigGroups(GROUP_RESTART, "persistRestartInfo");
 }
 
-// VERBESSERT: Non-blocking Sensor-Sampling (verhindert Watchdog-Resets)
-// Startet einen neuen Sample-Zyklus
-void startLightSensorSampling() {
-  sensorSampleCount = 0;
-  sensorSampleSum = 0;
-  sensorSamplingInProgress = true;
-  lastSensorSample = millis();
+void persistNtpToStorage() {
+  persistConfigGroups(GROUP_NTP, "persistNtpToStorage");
 }
 
-// Nimmt ein einzelnes Sample, gibt true zurück wenn Sampling abgeschlossen
-bool processLightSensorSample() {
-  if (!sensorSamplingInProgress) {
+// Bindet den Log-Store ein und lädt ihn in den EEPROM-Shadow.
+// Gibt false zurück, wenn kein Platz dafür ist (dann bleibt es beim EEPROM).
+bool mountConfigStore() {
+  if (!ConfigLog::begin(configLogFields, buildConfigLogFields(), EEPROM.getDataPtr())) {
+    Serial.println("[Config] Not enough free flash sectors, using EEPROM");
     return false;
   }
-
-  unsigned long now = millis();
-  if (now - lastSensorSample >= LIGHT_SENSOR_SAMPLE_DELAY) {
-    uint16_t sensorReading = analogRead(LIGHT_SENSOR_PIN);
-    sensorSampleSum += sensorReading;
-    sensorSampleCount++;
-    lastSensorSample = now;
-
-#ifdef DEBUG_LOGGING_ENABLED
-    if (sensorSampleCount == 1 || sensorSampleCount == LIGHT_SENSOR_SAMPLES) { // Erste und letzte Messung loggen
-      debugLogJson("processLightSensorSample", "Sensor sample", "D", "{\"sampleCount\":%d,\"reading\":%d,\"sum\":%lu}", sensorSampleCount, sensorReading, sensorSampleSum);
-    }
-#endif
-
-    if (sensorSampleCount >= LIGHT_SENSOR_SAMPLES) {
-      sensorSamplingInProgress = false;
-      return true; // Sampling abgeschlossen
-    }
+  if (ConfigLog::mount()) {
+    Serial.printf("[Config] Log store: sector %u/%u, seq %lu, %u bytes used\n",
+                  ConfigLog::activeSector + 1, ConfigLog::sectorCount,
+                  (unsigned long)ConfigLog::sequence, ConfigLog::writeOffset);
   }
-  return false; // Noch nicht fertig
+  return true;
 }
 
-// Gibt den gemittelten Sensorwert zurück
-uint16_t getLightSensorResult() {
-  if (sensorSampleCount == 0) return 0;
-  return sensorSampleSum / sensorSampleCount;
+// Einmalige Migration vom EEPROM-Layout v3 in den Log-Store. Läuft nach
+// loadConfigFromStorage(): bei ungültigem EEPROM werden zuerst die Defaults
+// in den Shadow geschrieben, damit keine Zufallswerte übernommen werden.
+void migrateToConfigLog() {
+  if (!validateEEPROM()) {
+    persistBrightnessToStorage();
+    persistSlideConfig();
+    persistMqttToStorage();
+    persistNtpToStorage();
+    persistRestartInfo();
+  }
+  ESP.wdtFeed();
+  if (ConfigLog::format()) {
+    EepromWriteBack::markClean();
+    Serial.printf("[Config] Migrated EEPROM v%u to log store (%u sectors)\n",
+                  EEPROM_VERSION, ConfigLog::sectorCount);
+  } else {
+    Serial.println("[Config] Log store format failed, using EEPROM");
+  }
+  ESP.wdtFeed();
 }
 
-// VERBESSERT: Exponential Moving Average (sanfter als Simple Moving Average)
-float applyEMA(float newValue) {
-#ifdef DEBUG_LOGGING_ENABLED
-  float oldEma = emaSensorValue;
-#endif
-  
-  if (!emaInitialized) {
-    emaSensorValue = newValue;
-    emaInitialized = true;
-#ifdef DEBUG_LOGGING_ENABLED
-    debugLogJson("applyEMA", "EMA initialized", "D", "{\"newValue\":%.2f}", newValue);
-#endif
-    return newValue;
+// Lädt die Restart-Diagnose des vorherigen Laufs aus dem RTC-Memory und startet
+// den Eintrag für den aktuellen Boot. Nach Power-On ist der Slot ungültig (CRC) —
+// dann gibt es keine Werte "vor dem Restart".
+void loadRestartDiagFromRtc() {
+  RtcState::DiagState prev;
+  if (RtcState::read(RtcState::DIAG_SLOT, prev)) {
+    lastUptimeBeforeRestart = prev.uptimeMs;
+    lastHeapBeforeRestart = prev.freeHeap;
+    prev.lastOperation[sizeof(prev.lastOperation) - 1] = '\0';
+    strncpy(lastOperationBeforeRestart, prev.lastOperation, sizeof(lastOperationBeforeRestart) - 1);
+    lastOperationBeforeRestart[sizeof(lastOperationBeforeRestart) - 1] = '\0';
+  } else {
+    lastUptimeBeforeRestart = 0;
+    lastHeapBeforeRestart = 0;
+    lastOperationBeforeRestart[0] = '\0';
+    Serial.println("[RTC] No restart diagnostics (power-on reset)");
   }
 
-  // EMA Formel: EMA_new = alpha * value + (1 - alpha) * EMA_old
-  emaSensorValue = EMA_ALPHA_SENSOR * newValue + (1.0 - EMA_ALPHA_SENSOR) * emaSensorValue;
-  
-#ifdef DEBUG_LOGGING_ENABLED
-  float emaChange = abs(emaSensorValue - oldEma);
-  if (emaChange > 10) { // Nur loggen bei größeren Änderungen
-    debugLogJson("applyEMA", "EMA update", "D", "{\"newValue\":%.2f,\"oldEma\":%.2f,\"newEma\":%.2f,\"change\":%.2f,\"alpha\":%.2f}", newValue, oldEma, emaSensorValue, emaChange, EMA_ALPHA_SENSOR);
-  }
-#endif
-  
-  return emaSensorValue;
+  memset(&rtcDiag, 0, sizeof(rtcDiag));
+  persistUptimeHeapStatus();
 }
 
-// Zusätzliche EMA-Glättung für Helligkeitsänderungen (verhindert abrupte Sprünge)
-uint16_t applyBrightnessEMA(uint16_t newBrightness) {
-  if (!emaBrightnessInitialized) {
-    emaBrightnessValue = (float)newBrightness;
-    emaBrightnessInitialized = true;
-    return newBrightness;
-  }
-  
-  // EMA auf Helligkeit anwenden
-  emaBrightnessValue = EMA_ALPHA_BRIGHTNESS * (float)newBrightness + (1.0 - EMA_ALPHA_BRIGHTNESS) * emaBrightnessValue;
-  
-  // Auf Integer runden
-  return (uint16_t)(emaBrightnessValue + 0.5);
+// Speichert aktuelle Uptime und Heap im RTC-Memory (übersteht Soft-/Watchdog-Reset,
+// kein Flash-Zugriff — darf beliebig oft aufgerufen werden)
+void persistUptimeHeapStatus() {
+  rtcDiag.uptimeMs = millis();
+  rtcDiag.freeHeap = ESP.getFreeHeap();
+  RtcState::write(RtcState::DIAG_SLOT, rtcDiag);
 }
 
 void updateAutoBrightness() {
@@ -701,242 +688,474 @@ void updateAutoBrightness() {
     return;
   }
 
-  // Wenn Sampling noch läuft, nichts tun (wird in loop() verarbeitet)
-  if (sensorSamplingInProgress) {
-    return;
-  }
-
-  // BUGFIX: Erst die fertigen Samples auswerten, DANN neues Sampling starten
-  // Prüfe ob Daten zum Auswerten da sind
-  if (sensorSampleCount > 0) {
-    // Alle Samples gesammelt, jetzt auswerten
-    uint16_t rawSensorValue = getLightSensorResult();
+  // Median der letzten Samples (LightSensor), danach EMA
+  uint16_t rawSensorValue = LightSensor::value();
 #ifdef DEBUG_LOGGING_ENABLED
-    debugLogJson("updateAutoBrightness", "Raw sensor value", "D", "{\"rawSensorValue\":%d}", rawSensorValue);
+  debugLogJson("updateAutoBrightness", "Raw sensor value", "D", "{\"rawSensorValue\":%d}", rawSensorValue);
 #endif
-    
-    float smoothedSensorValue = applyEMA(rawSensorValue);
+  
+  uint16_t smoothedSensorValue = sensorEma.update(rawSensorValue);
 #ifdef DEBUG_LOGGING_ENABLED
-    debugLogJson("updateAutoBrightness", "EMA smoothed value", "D", "{\"smoothedSensorValue\":%.2f,\"emaSensorValue\":%.2f}", smoothedSensorValue, emaSensorValue);
+  debugLogJson("updateAutoBrightness", "EMA smoothed value", "D", "{\"smoothedSensorValue\":%d,\"emaSensorQ8\":%ld}", smoothedSensorValue, (long)sensorEma.q8());
 #endif
 
-    // Map Sensorwert (sensorMin..sensorMax) auf Helligkeit (minBrightness..maxBrightness)
-    uint16_t newBrightness;
-    bool atBoundary = false;  // Flag für Grenzbereiche
+  // Map Sensorwert (sensorMin..sensorMax) auf Helligkeit (minBrightness..maxBrightness)
+  uint16_t newBrightness;
+  bool atBoundary = false;  // Flag für Grenzbereiche
 
-    if (smoothedSensorValue <= sensorMin) {
-      newBrightness = minBrightness;
-      atBoundary = true;  // An unterer Grenze
-    } else if (smoothedSensorValue >= sensorMax) {
-      newBrightness = maxBrightness;
-      atBoundary = true;  // An oberer Grenze
-    } else {
-      // Lineare Interpolation zwischen Min und Max
-      newBrightness = map((uint16_t)smoothedSensorValue, sensorMin, sensorMax, minBrightness, maxBrightness);
-    }
+  if (smoothedSensorValue <= sensorMin) {
+    newBrightness = minBrightness;
+    atBoundary = true;  // An unterer Grenze
+  } else if (smoothedSensorValue >= sensorMax) {
+    newBrightness = maxBrightness;
+    atBoundary = true;  // An oberer Grenze
+  } else {
+    // Lineare Interpolation zwischen Min und Max
+    newBrightness = map(smoothedSensorValue, sensorMin, sensorMax, minBrightness, maxBrightness);
+  }
 
 #ifdef DEBUG_LOGGING_ENABLED
-    int brightnessDiff = abs((int)newBrightness - (int)brightness);
-    debugLogJson("updateAutoBrightness", "Brightness calculation", "D", "{\"newBrightness\":%d,\"currentBrightness\":%d,\"diff\":%d,\"threshold\":%d,\"atBoundary\":%d}", newBrightness, brightness, brightnessDiff, BRIGHTNESS_CHANGE_THRESHOLD, atBoundary ? 1 : 0);
+  int brightnessDiff = abs((int)newBrightness - (int)brightness);
+  debugLogJson("updateAutoBrightness", "Brightness calculation", "D", "{\"newBrightness\":%d,\"currentBrightness\":%d,\"diff\":%d,\"threshold\":%d,\"atBoundary\":%d}", newBrightness, brightness, brightnessDiff, BRIGHTNESS_CHANGE_THRESHOLD, atBoundary ? 1 : 0);
 #endif
 
-    // Zusätzliche Glättung der Helligkeitsänderungen (verhindert abrupte Sprünge)
-    uint16_t smoothedBrightness = applyBrightnessEMA(newBrightness);
-    
-    // An Grenzen immer aktualisieren, sonst nur bei signifikanter Änderung (Hysterese)
-    // Hysterese verhindert Flackern im mittleren Bereich, sollte aber nicht Min/Max blockieren
-    // Verwende smoothedBrightness für Vergleich, aber aktualisiere mit smoothedBrightness für sanfte Übergänge
-    int smoothedDiff = abs((int)smoothedBrightness - (int)brightness);
-    
-    if (atBoundary || smoothedDiff > BRIGHTNESS_CHANGE_THRESHOLD) {
-      brightness = smoothedBrightness; // Verwende geglättete Helligkeit
-      analogWrite(PIN_ENABLE, PWM_MAX - brightness);
+  // Zusätzliche Glättung der Helligkeitsänderungen (verhindert abrupte Sprünge)
+  uint16_t smoothedBrightness = brightnessEma.update(newBrightness);
+  
+  // An Grenzen immer aktualisieren, sonst nur bei signifikanter Änderung (Hysterese)
+  // Hysterese verhindert Flackern im mittleren Bereich, sollte aber nicht Min/Max blockieren
+  // Verwende smoothedBrightness für Vergleich, aber aktualisiere mit smoothedBrightness für sanfte Übergänge
+  int smoothedDiff = abs((int)smoothedBrightness - (int)brightness);
+  
+  if (atBoundary || smoothedDiff > BRIGHTNESS_CHANGE_THRESHOLD) {
+    brightness = smoothedBrightness; // Verwende geglättete Helligkeit
+    analogWrite(PIN_ENABLE, PWM_MAX - brightness);
 #ifdef DEBUG_LOGGING_ENABLED
-      debugLogJson("updateAutoBrightness", "Brightness updated", "D", "{\"brightness\":%d,\"rawSensorValue\":%d,\"smoothedSensorValue\":%.2f,\"newBrightness\":%d,\"smoothedBrightness\":%d,\"atBoundary\":%d}", brightness, rawSensorValue, smoothedSensorValue, newBrightness, smoothedBrightness, atBoundary ? 1 : 0);
+    debugLogJson("updateAutoBrightness", "Brightness updated", "D", "{\"brightness\":%d,\"rawSensorValue\":%d,\"smoothedSensorValue\":%d,\"newBrightness\":%d,\"smoothedBrightness\":%d,\"atBoundary\":%d}", brightness, rawSensorValue, smoothedSensorValue, newBrightness, smoothedBrightness, atBoundary ? 1 : 0);
 #endif
-      Serial.printf("Auto-Brightness: Raw=%d, EMA=%.1f -> New=%d, Smoothed=%d%s\n",
-                    rawSensorValue, smoothedSensorValue, newBrightness, brightness,
-                    atBoundary ? " (boundary)" : "");
-    } else {
+    Serial.printf("Auto-Brightness: Raw=%d, EMA=%d -> New=%d, Smoothed=%d%s\n",
+                  rawSensorValue, smoothedSensorValue, newBrightness, brightness,
+                  atBoundary ? " (boundary)" : "");
+  } else {
 #ifdef DEBUG_LOGGING_ENABLED
-      debugLogJson("updateAutoBrightness", "Brightness not updated (threshold)", "D", "{\"newBrightness\":%d,\"smoothedBrightness\":%d,\"currentBrightness\":%d,\"diff\":%d}", newBrightness, smoothedBrightness, brightness, smoothedDiff);
+    debugLogJson("updateAutoBrightness", "Brightness not updated (threshold)", "D", "{\"newBrightness\":%d,\"smoothedBrightness\":%d,\"currentBrightness\":%d,\"diff\":%d}", newBrightness, smoothedBrightness, brightness, smoothedDiff);
 #endif
-    }
   }
-
-  // Neues Sampling für den nächsten Zyklus starten
-  startLightSensorSampling();
 }
 
 // Forward declaration
 bool applyEffect(uint8_t idx);
 
-// Hilfsfunktion: Effekt-Index per Name finden
+// Hilfsfunktion: Effekt-Index per Name finden (Hash-Lookup, siehe EffectRegistry.h)
+int8_t findEffectIndexByName(const char* name, size_t len) {
+  return EffectRegistry::find(EFFECT_HASH, EFFECTS, name, len);
+}
+
 int8_t findEffectIndexByName(const char* name) {
-  for (uint8_t i = 0; i < effectCount; i++) {
-    if (strcasecmp(effects[i]->name, name) == 0) return (int8_t)i;
-  }
-  return -1;
+  return findEffectIndexByName(name, strlen(name));
+}
+
+const char* effectName(uint8_t idx) {
+  return EFFECTS[idx].name;
 }
 
-// MQTT Callback für eingehende Steuerbefehle
+// MQTT Callback für eingehende Steuerbefehle (Verteilung siehe MqttDispatch.h)
 // Erwartetes Topic: <baseTopic>/cmd
 // Payload-Format: "key:value"
 //   display:on | display:off
 //   effect:<name>
 //   brightness:<0-1023>
 //   autobrightness:on | autobrightness:off
+// Oder mehrere Änderungen auf einmal als JSON-Objekt (wie POST /api/batch):
+//   {"brightness":300,"effect":"clock","display":true}
 void mqttCallback(char* topic, byte* payload, unsigned int length) {
-  String message = "";
-  message.reserve(length + 1);
-  for (unsigned int i = 0; i < length; i++) {
-    message += (char)payload[i];
+  TRACE_SCOPE("mqttCallback");
+  Metrics::mqttMessagesIn++;
+  MqttDispatch::handle(topic, payload, length);
+}
+
+// Zuletzt auf <baseTopic>/state/<feld> publizierte Werte (Delta-Modus).
+// Temperatur/Feuchte in Zehnteln: verglichen wird der gerundete Wert, formatiert
+// wird ohne Float-printf.
+const int16_t MQTT_TENTHS_NAN = INT16_MIN;
+struct MqttPublishedState {
+  bool display;
+  uint8_t effect;
+  uint16_t brightness;
+  bool autoBrightness;
+  int16_t tempTenths;
+  int16_t humiTenths;
+  uint16_t clockDur;
+  uint16_t tempDur;
+  uint16_t humiDur;
+  uint16_t ambientLight;
+} mqttPublished;
+
+// Umgebungslicht (LDR-Rohwert) für den State: alle MQTT_AMBIENT_INTERVAL_MS gelesen,
+// publiziert nur bei Änderung über MQTT_AMBIENT_HYSTERESIS
+const unsigned long MQTT_AMBIENT_INTERVAL_MS = 30000;
+const uint16_t MQTT_AMBIENT_HYSTERESIS = 8;
+uint16_t mqttAmbientLight = 0;
+unsigned long lastMqttAmbientRead = 0;
+
+void updateMqttAmbientLight(bool force) {
+  if (!force && timeDiff(millis(), lastMqttAmbientRead) < MQTT_AMBIENT_INTERVAL_MS) return;
+  lastMqttAmbientRead = millis();
+  uint16_t value = LightSensor::value();
+  if (force || abs((int)value - (int)mqttAmbientLight) > MQTT_AMBIENT_HYSTERESIS) {
+    mqttAmbientLight = value;
+    mqttStateDirty = true;  // Nur MQTT, Status-Poller lesen den Sensor selbst
   }
-  message.trim();
+}
 
-  Serial.printf("MQTT cmd on %s: %s\n", topic, message.c_str());
+int16_t toTenths(float v) {
+  return isnan(v) ? MQTT_TENTHS_NAN : (int16_t)lroundf(v * 10.0f);
+}
 
-  int colon = message.indexOf(':');
-  if (colon < 0) {
-    Serial.println("MQTT cmd: missing ':' separator, ignored");
+// "12.3", "-0.5" oder "null"
+void formatTenths(char* buf, size_t size, int16_t tenths) {
+  if (tenths == MQTT_TENTHS_NAN) {
+    strncpy(buf, "null", size);
     return;
   }
-  String key = message.substring(0, colon);
-  String value = message.substring(colon + 1);
-  key.toLowerCase();
-  key.trim();
-  value.trim();
-  String valueLower = value;
-  valueLower.toLowerCase();
+  int v = abs(tenths);
+  snprintf(buf, size, "%s%d.%d", tenths < 0 ? "-" : "", v / 10, v % 10);
+}
 
-  bool changed = false;
+// State-Nachrichten gehen über die Ausgangs-Queue (retained, QoS 1) und
+// überstehen so auch eine Broker-Unterbrechung. topic ist relativ zum Base-Topic.
+bool publishMqttRetained(const char* topic, const char* payload) {
+  return MqttQueue::push(topic, (const uint8_t*)payload, strlen(payload),
+                         MqttQueue::FLAG_RETAIN | MqttQueue::FLAG_QOS1);
+}
 
-  if (key == "display") {
-    bool newState = (valueLower == "on" || valueLower == "true" || valueLower == "1");
-    if (newState != displayEnabled) {
-      displayEnabled = newState;
-      if (displayEnabled) {
-        analogWrite(PIN_ENABLE, PWM_MAX - brightness);
-      } else {
-        analogWrite(PIN_ENABLE, PWM_MAX);
-      }
-      Serial.printf("MQTT: display -> %s\n", displayEnabled ? "ON" : "OFF");
-      changed = true;
-    }
-  } else if (key == "effect") {
-    int8_t idx = findEffectIndexByName(value.c_str());
-    if (idx >= 0) {
-      applyEffect((uint8_t)idx);
-      Serial.printf("MQTT: effect -> %s\n", currentEffect->name);
-      changed = true;
-    } else {
-      Serial.printf("MQTT: unknown effect '%s'\n", value.c_str());
-    }
-  } else if (key == "brightness") {
-    int b = value.toInt();
-    if (b >= 0 && b <= PWM_MAX) {
-      brightness = (uint16_t)b;
-      analogWrite(PIN_ENABLE, PWM_MAX - brightness);
-      if (autoBrightnessEnabled) {
-        autoBrightnessEnabled = false;
-        Serial.println("Auto-Brightness disabled (manual MQTT brightness)");
-      }
-      persistBrightnessToStorage();
-      Serial.printf("MQTT: brightness -> %d\n", brightness);
-      changed = true;
-    }
-  } else if (key == "autobrightness") {
-    bool newState = (valueLower == "on" || valueLower == "true" || valueLower == "1");
-    if (newState != autoBrightnessEnabled) {
-      autoBrightnessEnabled = newState;
-      persistBrightnessToStorage();
-      Serial.printf("MQTT: autobrightness -> %s\n", autoBrightnessEnabled ? "ON" : "OFF");
-      changed = true;
-    }
-  } else if (key == "temp") {
-    float v = value.toFloat();
-    if (v >= -40.0f && v <= 80.0f) {
-      g_sensorTemp = v;
-      Serial.printf("MQTT: temp -> %.1f\n", g_sensorTemp);
-      changed = true;
-    }
-  } else if (key == "humi") {
-    float v = value.toFloat();
-    if (v >= 0.0f && v <= 100.0f) {
-      g_sensorHumi = v;
-      Serial.printf("MQTT: humi -> %.1f\n", g_sensorHumi);
-      changed = true;
-    }
-  } else if (key == "clockdur") {
-    int v = value.toInt();
-    if (v >= 1 && v <= 3600) {
-      g_clockDur = (uint16_t)v;
-      persistSlideConfig();
-      Serial.printf("MQTT: clockdur -> %d\n", g_clockDur);
-      changed = true;
-    }
-  } else if (key == "tempdur") {
-    int v = value.toInt();
-    if (v >= 1 && v <= 3600) {
-      g_tempDur = (uint16_t)v;
-      persistSlideConfig();
-      Serial.printf("MQTT: tempdur -> %d\n", g_tempDur);
-      changed = true;
-    }
-  } else if (key == "humidur") {
-    int v = value.toInt();
-    if (v >= 1 && v <= 3600) {
-      g_humiDur = (uint16_t)v;
-      persistSlideConfig();
-      Serial.printf("MQTT: humidur -> %d\n", g_humiDur);
-      changed = true;
-    }
+bool publishMqttField(const char* field, const char* value) {
+  char topic[24];
+  snprintf(topic, sizeof(topic), "state/%s", field);
+  return publishMqttRetained(topic, value);
+}
+
+// Sender für MqttQueue::process(): QoS 1 schreibt der AckClient selbst, QoS 0 PubSubClient
+bool sendQueuedMqtt(const MqttQueue::Record& r, bool dup) {
+  char prefix[INPUT_MQTT_TOPIC_MAX + 2];
+  snprintf(prefix, sizeof(prefix), "%s/", mqttBaseTopic);
+  bool published;
+  if (r.flags & MqttQueue::FLAG_QOS1) {
+    published = mqttAckClient.writePublish(prefix, r, dup);
   } else {
-    Serial.printf("MQTT: unknown key '%s'\n", key.c_str());
+    char topic[INPUT_MQTT_TOPIC_MAX + 2 + 0xFF];
+    snprintf(topic, sizeof(topic), "%s%.*s", prefix, (int)r.topicLen, r.topic());
+    published = mqttClient.publish(topic, r.payload(), r.payloadLen, r.flags & MqttQueue::FLAG_RETAIN);
   }
-
-  if (changed) {
-    mqttStateDirty = true;
+  if (!published) return false;
+  Metrics::mqttMessagesOut++;
+  if (bootFirstMqttPublishMs == 0) {
+    bootFirstMqttPublishMs = millis();
+    Serial.printf("[MQTT] First publish %lums after boot\n", bootFirstMqttPublishMs);
   }
+  return true;
 }
 
-// State als JSON auf <baseTopic>/state publishen (retained)
-void publishMqttState() {
-  if (!mqttEnabled || !mqttClient.connected() || strlen(mqttBaseTopic) == 0) {
-    return;
-  }
-  char stateTopic[INPUT_MQTT_TOPIC_MAX + 8];
-  snprintf(stateTopic, sizeof(stateTopic), "%s/state", mqttBaseTopic);
-
+// Ganzes Dokument auf <baseTopic>/state
+void publishMqttStateJson() {
   char tempStr[12];
   char humiStr[12];
-  if (isnan(g_sensorTemp)) {
-    strncpy(tempStr, "null", sizeof(tempStr));
-  } else {
-    snprintf(tempStr, sizeof(tempStr), "%.1f", g_sensorTemp);
-  }
-  if (isnan(g_sensorHumi)) {
-    strncpy(humiStr, "null", sizeof(humiStr));
-  } else {
-    snprintf(humiStr, sizeof(humiStr), "%.1f", g_sensorHumi);
-  }
+  formatTenths(tempStr, sizeof(tempStr), toTenths(g_sensorTemp));
+  formatTenths(humiStr, sizeof(humiStr), toTenths(g_sensorHumi));
 
   char payload[256];
   snprintf(payload, sizeof(payload),
     "{\"display\":%s,\"effect\":\"%s\",\"brightness\":%d,\"autoBrightness\":%s,"
-    "\"sensorTemp\":%s,\"sensorHumi\":%s,\"clockDur\":%u,\"tempDur\":%u,\"humiDur\":%u}",
+    "\"sensorTemp\":%s,\"sensorHumi\":%s,\"clockDur\":%u,\"tempDur\":%u,\"humiDur\":%u,\"ambientLight\":%u}",
     displayEnabled ? "true" : "false",
-    currentEffect ? currentEffect->name : "",
+    EFFECTS[currentEffectIndex].name,
     brightness,
     autoBrightnessEnabled ? "true" : "false",
     tempStr, humiStr,
-    g_clockDur, g_tempDur, g_humiDur);
-  mqttClient.publish(stateTopic, payload, true);
+    g_clockDur, g_tempDur, g_humiDur, mqttAmbientLight);
+  if (!publishMqttRetained("state", payload)) mqttStateDirty = true;
+}
+
+// Nur geänderte Felder (full: alle) auf <baseTopic>/state/<feld>. Fehlgeschlagene
+// Felder bleiben als geändert stehen und werden beim nächsten Mal wiederholt.
+void publishMqttStateDelta(bool full) {
+  MqttPublishedState& p = mqttPublished;
+  char value[24];
+  bool failed = false;
+
+  if (full || p.display != displayEnabled) {
+    if (publishMqttField("display", displayEnabled ? "true" : "false")) p.display = displayEnabled; else failed = true;
+  }
+  if (full || p.effect != currentEffectIndex) {
+    if (publishMqttField("effect", EFFECTS[currentEffectIndex].name)) p.effect = currentEffectIndex; else failed = true;
+  }
+  if (full || p.brightness != brightness) {
+    snprintf(value, sizeof(value), "%u", brightness);
+    if (publishMqttField("brightness", value)) p.brightness = brightness; else failed = true;
+  }
+  if (full || p.autoBrightness != autoBrightnessEnabled) {
+    if (publishMqttField("autoBrightness", autoBrightnessEnabled ? "true" : "false")) p.autoBrightness = autoBrightnessEnabled; else failed = true;
+  }
+  int16_t temp = toTenths(g_sensorTemp);
+  if (full || p.tempTenths != temp) {
+    formatTenths(value, sizeof(value), temp);
+    if (publishMqttField("sensorTemp", value)) p.tempTenths = temp; else failed = true;
+  }
+  int16_t humi = toTenths(g_sensorHumi);
+  if (full || p.humiTenths != humi) {
+    formatTenths(value, sizeof(value), humi);
+    if (publishMqttField("sensorHumi", value)) p.humiTenths = humi; else failed = true;
+  }
+  if (full || p.clockDur != g_clockDur) {
+    snprintf(value, sizeof(value), "%u", g_clockDur);
+    if (publishMqttField("clockDur", value)) p.clockDur = g_clockDur; else failed = true;
+  }
+  if (full || p.tempDur != g_tempDur) {
+    snprintf(value, sizeof(value), "%u", g_tempDur);
+    if (publishMqttField("tempDur", value)) p.tempDur = g_tempDur; else failed = true;
+  }
+  if (full || p.humiDur != g_humiDur) {
+    snprintf(value, sizeof(value), "%u", g_humiDur);
+    if (publishMqttField("humiDur", value)) p.humiDur = g_humiDur; else failed = true;
+  }
+  if (full || p.ambientLight != mqttAmbientLight) {
+    snprintf(value, sizeof(value), "%u", mqttAmbientLight);
+    if (publishMqttField("ambientLight", value)) p.ambientLight = mqttAmbientLight; else failed = true;
+  }
+  if (failed) {
+    // Snapshot unvollständig → beim nächsten Versuch wieder alles
+    if (full) mqttStateSnapshot = true;
+    mqttStateDirty = true;
+  }
+}
+
+// State publishen (retained): JSON auf <baseTopic>/state oder, im Delta-Modus,
+// geänderte Felder auf <baseTopic>/state/<feld>
+// Läuft auch ohne Verbindung: der State wird in MqttQueue gepuffert
+void publishMqttState() {
+  if (!mqttEnabled || strlen(mqttBaseTopic) == 0) {
+    return;
+  }
+  bool full = mqttStateSnapshot;
   mqttStateDirty = false;
+  mqttStateSnapshot = false;
+  lastMqttStatePublishMs = millis();
+  if (mqttDeltaState) {
+    publishMqttStateDelta(full);
+  } else {
+    publishMqttStateJson();
+  }
+}
+
+// Änderungen innerhalb von mqttMinIntervalMs werden zu einem Publish zusammengefasst
+// (z.B. Auto-Brightness-Rampe, temp:-Serien); der Snapshot nach dem Connect sofort
+bool mqttStatePublishDue() {
+  return mqttStateDirty &&
+         (mqttStateSnapshot || timeDiff(millis(), lastMqttStatePublishMs) >= mqttMinIntervalMs);
+}
+
+// === Home Assistant MQTT-Discovery ===
+// Gesendet nach dem Connect, wenn sich Inhalt (Base-Topic, State-Modus, Effektliste,
+// Firmware) seit dem letzten Senden in diesem Boot geändert hat, und immer auf die
+// Birth-Message von Home Assistant ("online" auf homeassistant/status). Die Configs
+// sind retained, ein Broker-Reconnect allein sendet sie also nicht erneut.
+uint32_t haDiscoveryHash() {
+  uint32_t h = EffectRegistry::hash(mqttBaseTopic, strlen(mqttBaseTopic), mqttDeltaState ? 1 : 0);
+  h = EffectRegistry::hash(EFFECT_LIST_JSON.text, strlen(EFFECT_LIST_JSON.text), h);
+  h = EffectRegistry::hash(FIRMWARE_VERSION, strlen(FIRMWARE_VERSION), h);
+  return h ? h : 1;
+}
+
+void haDiscoveryNodeId(char* buf, size_t size) {
+  snprintf(buf, size, "obegraensad_%06x", ESP.getChipId());
+}
+
+// Alle Configs publishen (remove: leere Payload löscht die Entitäten in HA)
+bool publishHaDiscovery(bool remove) {
+  char uid[24];
+  char name[BUFFER_SIZE_HOSTNAME];
+  haDiscoveryNodeId(uid, sizeof(uid));
+  snprintf(name, sizeof(name), "IkeaClock-%x", ESP.getChipId());
+  HaDiscovery::Context ctx = {mqttBaseTopic, uid, name, FIRMWARE_VERSION, EFFECT_LIST_JSON.text, mqttDeltaState};
+
+  char topic[96];
+  for (uint8_t i = 0; i < HaDiscovery::ENTITY_COUNT; i++) {
+    const HaDiscovery::Entity& e = HaDiscovery::ENTITIES[i];
+    snprintf(topic, sizeof(topic), "%s/%s/%s/%s/config", HaDiscovery::PREFIX, e.component, uid, e.object);
+    bool ok;
+    if (remove) {
+      ok = mqttClient.publish(topic, "", true);
+    } else {
+      size_t len = HaDiscovery::expand(e.config, ctx, nullptr);
+      ok = mqttClient.beginPublish(topic, len, true);
+      if (ok) {
+        HaDiscovery::expand(e.config, ctx, &mqttClient);
+        ok = mqttClient.endPublish() == 1;
+      }
+    }
+    if (!ok) {
+      Serial.printf("[MQTT] Discovery publish failed: %s\n", topic);
+      return false;
+    }
+    Metrics::mqttMessagesOut++;
+  }
+  Serial.printf("[MQTT] Home Assistant discovery %s (%u entities)\n", remove ? "removed" : "published", HaDiscovery::ENTITY_COUNT);
+  return true;
+}
+
+// Aus loop(): ausstehende Discovery senden bzw. entfernen
+void handleHaDiscovery() {
+  if (haDiscoveryRemove) {
+    if (haDiscoverySentHash == 0 || publishHaDiscovery(true)) {
+      haDiscoveryRemove = false;
+      haDiscoverySentHash = 0;
+    }
+    return;
+  }
+  if (!haDiscoveryPending || !mqttDiscovery) {
+    haDiscoveryPending = false;
+    return;
+  }
+  if (publishHaDiscovery(false)) {
+    haDiscoveryPending = false;
+    haDiscoverySentHash = haDiscoveryHash();
+  }
+}
+
+// === Non-blocking MQTT-Connect ===
+// Ablauf (polled aus loop(), nie länger als wenige ms pro Aufruf):
+//   1. DNS: Broker-Hostname asynchron via lwIP auflösen (Ergebnis mit TTL gecacht,
+//      IP-Literale werden direkt übernommen)
+//   2. TCP-Probe: non-blocking Connect mit AsyncClient — scheitert der Broker hier,
+//      blockiert nichts und der Backoff greift
+//   3. Handshake: erst wenn der Broker-Port nachweislich erreichbar ist, führt
+//      PubSubClient CONNECT/CONNACK gegen die aufgelöste IP durch (Socket-Timeout
+//      MQTT_HANDSHAKE_TIMEOUT, im LAN typischerweise wenige ms)
+enum MqttConnectState : uint8_t {
+  MQTT_CONN_IDLE = 0,
+  MQTT_CONN_RESOLVING,
+  MQTT_CONN_PROBING
+};
+
+const unsigned long MQTT_DNS_TIMEOUT = 5000;         // Max. Wartezeit auf DNS-Antwort
+const unsigned long MQTT_DNS_CACHE_TTL = 600000;     // Aufgelöste Broker-IP 10 Minuten cachen
+const unsigned long MQTT_PROBE_TIMEOUT = 3000;       // Max. Wartezeit auf TCP-Connect
+const uint16_t MQTT_HANDSHAKE_TIMEOUT = 1;           // CONNACK-Timeout in Sekunden (PubSubClient)
+const unsigned long MQTT_TCP_CONNECT_TIMEOUT = 1000; // WiFiClient-Connect nach erfolgreicher Probe
+
+MqttConnectState mqttConnectState = MQTT_CONN_IDLE;
+unsigned long mqttConnectStateStartMs = 0;
+unsigned long mqttConnectStartMs = 0;
+
+// DNS-Cache für den Broker-Hostnamen
+char mqttDnsHost[INPUT_MQTT_SERVER_MAX] = "";
+IPAddress mqttDnsIp;
+unsigned long mqttDnsResolvedMs = 0;
+bool mqttDnsValid = false;
+uint8_t mqttDnsGeneration = 0;           // Verwirft verspätete Callbacks abgebrochener Lookups
+volatile bool mqttDnsDone = false;       // Gesetzt im lwIP-Callback
+volatile uint32_t mqttDnsResult = 0;     // 0 = nicht gefunden
+
+// TCP-Probe (Callbacks laufen im lwIP-Kontext — dort nur Flags setzen)
+AsyncClient mqttProbeClient;
+enum MqttProbeResult : uint8_t { MQTT_PROBE_PENDING = 0, MQTT_PROBE_OK, MQTT_PROBE_FAILED };
+volatile uint8_t mqttProbeResult = MQTT_PROBE_PENDING;
+
+void mqttDnsFoundCallback(const char* name, const ip_addr_t* ipaddr, void* arg) {
+  if ((uint8_t)(uintptr_t)arg != mqttDnsGeneration) {
+    return; // Lookup wurde inzwischen abgebrochen
+  }
+  mqttDnsResult = ipaddr ? (uint32_t)IPAddress(ipaddr) : 0;
+  mqttDnsDone = true;
+}
+
+void setupMqttProbeClient() {
+  // Nicht im Callback schließen: close(true) bricht den pcb ab, während lwIP
+  // noch den Connect-Callback abarbeitet — das macht pollMqttConnect()
+  mqttProbeClient.onConnect([](void*, AsyncClient*) {
+    mqttProbeResult = MQTT_PROBE_OK;
+  });
+  mqttProbeClient.onError([](void*, AsyncClient*, int8_t) {
+    mqttProbeResult = MQTT_PROBE_FAILED;
+  });
+  mqttProbeClient.onDisconnect([](void*, AsyncClient*) {
+    if (mqttProbeResult == MQTT_PROBE_PENDING) {
+      mqttProbeResult = MQTT_PROBE_FAILED;
+    }
+  });
 }
 
-// MQTT Verbindung aufbauen/wiederherstellen
-bool reconnectMQTT() {
+// Bricht einen laufenden Connect-Versuch ab (z.B. nach Konfigurationsänderung)
+void resetMqttConnect() {
+  if (mqttConnectState == MQTT_CONN_PROBING) {
+    mqttProbeClient.close(true);
+  }
+  mqttDnsGeneration++;
+  mqttConnectState = MQTT_CONN_IDLE;
+}
+
+void mqttConnectFailed(const char* stage) {
+  Serial.printf("MQTT connection failed (%s), next retry in %lu ms\n", stage, mqttReconnectBackoff);
+  debugLogJson("pollMqttConnect", "MQTT connect failed", "C", "{\"stage\":\"%s\",\"duration\":%lu,\"nextBackoff\":%lu}",
+               stage, timeDiff(millis(), mqttConnectStartMs), mqttReconnectBackoff);
+  // Exponential Backoff erhöhen
+  mqttReconnectBackoff *= MQTT_BACKOFF_MULTIPLIER;
+  if (mqttReconnectBackoff > MQTT_MAX_BACKOFF) {
+    mqttReconnectBackoff = MQTT_MAX_BACKOFF;
+  }
+  mqttConnectState = MQTT_CONN_IDLE;
+}
+
+void startMqttProbe() {
+  mqttProbeResult = MQTT_PROBE_PENDING;
+  mqttConnectState = MQTT_CONN_PROBING;
+  mqttConnectStateStartMs = millis();
+  if (!mqttProbeClient.connect(mqttDnsIp, mqttPort)) {
+    mqttProbeResult = MQTT_PROBE_FAILED;
+  }
+}
+
+// Startet einen Connect-Versuch: DNS (Cache/Literal/async) und danach die TCP-Probe
+void startMqttConnect() {
+  if (!mqttEnabled || strlen(mqttServer) == 0 || mqttConnectState != MQTT_CONN_IDLE) {
+    return;
+  }
+  mqttConnectStartMs = millis();
+  Serial.printf("Attempting MQTT connection to %s:%d...\n", mqttServer, mqttPort);
+
+  IPAddress literal;
+  if (literal.fromString(mqttServer)) {
+    mqttDnsIp = literal;
+    startMqttProbe();
+    return;
+  }
+  if (mqttDnsValid && strcmp(mqttDnsHost, mqttServer) == 0 &&
+      timeDiff(millis(), mqttDnsResolvedMs) < MQTT_DNS_CACHE_TTL) {
+    startMqttProbe();
+    return;
+  }
+
+  strncpy(mqttDnsHost, mqttServer, sizeof(mqttDnsHost) - 1);
+  mqttDnsHost[sizeof(mqttDnsHost) - 1] = '\0';
+  mqttDnsValid = false;
+  mqttDnsDone = false;
+  mqttDnsGeneration++;
+  mqttConnectState = MQTT_CONN_RESOLVING;
+  mqttConnectStateStartMs = millis();
+
+  ip_addr_t addr;
+  err_t err = dns_gethostbyname(mqttDnsHost, &addr, mqttDnsFoundCallback, (void*)(uintptr_t)mqttDnsGeneration);
+  if (err == ERR_OK) {
+    // Treffer im lwIP-Cache — sofort weiter
+    mqttDnsResult = (uint32_t)IPAddress(&addr);
+    mqttDnsDone = true;
+  } else if (err != ERR_INPROGRESS) {
+    mqttConnectFailed("dns");
+  }
+}
+
+// Letzter Schritt: MQTT CONNECT/CONNACK über PubSubClient gegen die aufgelöste IP
+bool completeMqttConnect() {
 #ifdef DEBUG_LOGGING_ENABLED
   unsigned long reconnectStart = millis();
   int freeHeapBefore = ESP.getFreeHeap();
@@ -944,55 +1163,38 @@ bool reconnectMQTT() {
   if (SPIFFS.exists("/")) {
     File logFile = SPIFFS.open("/debug.log", "a");
     if (logFile) {
-      logFile.printf("{\"id\":\"mqtt_start_%lu\",\"timestamp\":%lu,\"location\":\"reconnectMQTT\",\"message\":\"MQTT reconnect start\",\"data\":{\"freeHeap\":%d,\"maxFreeBlock\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
+      logFile.printf("{\"id\":\"mqtt_start_%lu\",\"timestamp\":%lu,\"location\":\"completeMqttConnect\",\"message\":\"MQTT reconnect start\",\"data\":{\"freeHeap\":%d,\"maxFreeBlock\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
                      millis(), millis(), freeHeapBefore, maxFreeBlockBefore);
       logFile.close();
     }
   }
 #endif
-  
-  if (!mqttEnabled || strlen(mqttServer) == 0) {
-    return false;
-  }
-
-  if (mqttClient.connected()) {
-    return true;
-  }
-
-  Serial.printf("Attempting MQTT connection to %s:%d...\n", mqttServer, mqttPort);
 
   // Client-ID generieren (optimiert)
   char clientIdBuf[BUFFER_SIZE_CLIENT_ID];
   snprintf(clientIdBuf, sizeof(clientIdBuf), "IkeaClock-%x", ESP.getChipId());
-  String clientId = String(clientIdBuf);
 
-  // Socket-Timeout setzen (für non-blocking Connect)
-  mqttClient.setSocketTimeout(MQTT_CONNECT_TIMEOUT / 1000); // in Sekunden
+  // Aufgelöste IP verwenden — PubSubClient würde sonst selbst (blockierend) auflösen
+  mqttClient.setServer(mqttDnsIp, mqttPort);
+  mqttClient.setSocketTimeout(MQTT_HANDSHAKE_TIMEOUT);
+  espClient.setTimeout(MQTT_TCP_CONNECT_TIMEOUT);
   
   bool connected = false;
   unsigned long connectStart = millis();
   
   // Kritische Operation: MQTT-Connect
-  strncpy(lastOperation, "reconnectMQTT", sizeof(lastOperation) - 1);
-  lastOperation[sizeof(lastOperation) - 1] = '\0';
-  debugLogJson("reconnectMQTT", "MQTT connect start", "C", "{\"server\":\"%s\",\"port\":%d,\"freeHeap\":%d}", mqttServer, mqttPort, ESP.getFreeHeap());
+  setLastOperation("reconnectMQTT");
+  debugLogJson("completeMqttConnect", "MQTT connect start", "C", "{\"server\":\"%s\",\"port\":%d,\"freeHeap\":%d}", mqttServer, mqttPort, ESP.getFreeHeap());
   
-  ESP.wdtFeed(); // Watchdog vor blockierender Operation füttern
+  ESP.wdtFeed(); // Watchdog vor Handshake füttern
   if (strlen(mqttUser) > 0) {
-    connected = mqttClient.connect(clientId.c_str(), mqttUser, mqttPassword);
+    connected = mqttClient.connect(clientIdBuf, mqttUser, mqttPassword);
   } else {
-    connected = mqttClient.connect(clientId.c_str());
+    connected = mqttClient.connect(clientIdBuf);
   }
-  ESP.wdtFeed(); // Watchdog nach blockierender Operation füttern
-  
-  debugLogJson("reconnectMQTT", connected ? "MQTT connect success" : "MQTT connect failed", "C", "{\"rc\":%d,\"duration\":%lu}", mqttClient.state(), millis() - connectStart);
+  ESP.wdtFeed(); // Watchdog nach Handshake füttern
   
-  // Prüfe ob Connect zu lange gedauert hat (Fallback)
-  unsigned long connectDuration = millis() - connectStart;
-  if (connectDuration > MQTT_CONNECT_TIMEOUT) {
-    Serial.printf("MQTT connect timeout after %lu ms\n", connectDuration);
-    connected = false;
-  }
+  debugLogJson("completeMqttConnect", connected ? "MQTT connect success" : "MQTT connect failed", "C", "{\"rc\":%d,\"duration\":%lu}", mqttClient.state(), millis() - connectStart);
 
 #ifdef DEBUG_LOGGING_ENABLED
   unsigned long reconnectDuration = millis() - reconnectStart;
@@ -1001,7 +1203,8 @@ bool reconnectMQTT() {
 #endif
   
   if (connected) {
-    Serial.println("MQTT connected!");
+    Serial.printf("MQTT connected! (%lu ms incl. DNS/probe)\n", timeDiff(millis(), mqttConnectStartMs));
+    Metrics::mqttConnects++;
     // Backoff zurücksetzen bei erfolgreicher Verbindung
     mqttReconnectBackoff = 1000;
     // Command-Topic abonnieren: <baseTopic>/cmd
@@ -1010,175 +1213,808 @@ bool reconnectMQTT() {
       snprintf(cmdTopic, sizeof(cmdTopic), "%s/cmd", mqttBaseTopic);
       mqttClient.subscribe(cmdTopic);
       Serial.printf("Subscribed to: %s\n", cmdTopic);
+      snprintf(cmdTopic, sizeof(cmdTopic), "%s/frame", mqttBaseTopic);
+      mqttClient.subscribe(cmdTopic);
     }
-    // Initialen State publishen
-    mqttStateDirty = true;
+    if (mqttDiscovery) {
+      mqttClient.subscribe(HaDiscovery::STATUS_TOPIC);
+      if (haDiscoverySentHash != haDiscoveryHash()) haDiscoveryPending = true;
+    }
+    // Unbestätigte QoS-1-Nachrichten aus der alten Session erneut senden
+    MqttQueue::resetInflight();
+    updateMqttAmbientLight(true);
+    // Initialen State publishen (vollständig, auch im Delta-Modus)
+    mqttStateSnapshot = true;
+    markStateChanged();
 #ifdef DEBUG_LOGGING_ENABLED
     if (SPIFFS.exists("/")) {
       File logFile = SPIFFS.open("/debug.log", "a");
       if (logFile) {
-        logFile.printf("{\"id\":\"mqtt_success_%lu\",\"timestamp\":%lu,\"location\":\"reconnectMQTT\",\"message\":\"MQTT reconnect success\",\"data\":{\"duration\":%lu,\"freeHeapBefore\":%d,\"freeHeapAfter\":%d,\"maxFreeBlockBefore\":%d,\"maxFreeBlockAfter\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
+        logFile.printf("{\"id\":\"mqtt_success_%lu\",\"timestamp\":%lu,\"location\":\"completeMqttConnect\",\"message\":\"MQTT reconnect success\",\"data\":{\"duration\":%lu,\"freeHeapBefore\":%d,\"freeHeapAfter\":%d,\"maxFreeBlockBefore\":%d,\"maxFreeBlockAfter\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
                        millis(), millis(), reconnectDuration, freeHeapBefore, freeHeapAfter, maxFreeBlockBefore, maxFreeBlockAfter);
         logFile.close();
       }
     }
 #endif
     return true;
-  } else {
-    Serial.printf("MQTT connection failed, rc=%d, next retry in %lu ms\n", mqttClient.state(), mqttReconnectBackoff);
-    // Exponential Backoff erhöhen
-    mqttReconnectBackoff *= MQTT_BACKOFF_MULTIPLIER;
-    if (mqttReconnectBackoff > MQTT_MAX_BACKOFF) {
-      mqttReconnectBackoff = MQTT_MAX_BACKOFF;
-    }
+  }
+
+  Serial.printf("MQTT handshake failed, rc=%d\n", mqttClient.state());
 #ifdef DEBUG_LOGGING_ENABLED
-    if (SPIFFS.exists("/")) {
-      File logFile = SPIFFS.open("/debug.log", "a");
-      if (logFile) {
-        logFile.printf("{\"id\":\"mqtt_failed_%lu\",\"timestamp\":%lu,\"location\":\"reconnectMQTT\",\"message\":\"MQTT reconnect failed\",\"data\":{\"duration\":%lu,\"rc\":%d,\"nextBackoff\":%lu,\"freeHeapBefore\":%d,\"freeHeapAfter\":%d,\"maxFreeBlockBefore\":%d,\"maxFreeBlockAfter\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
-                       millis(), millis(), reconnectDuration, mqttClient.state(), mqttReconnectBackoff, freeHeapBefore, freeHeapAfter, maxFreeBlockBefore, maxFreeBlockAfter);
-        logFile.close();
-      }
+  if (SPIFFS.exists("/")) {
+    File logFile = SPIFFS.open("/debug.log", "a");
+    if (logFile) {
+      logFile.printf("{\"id\":\"mqtt_failed_%lu\",\"timestamp\":%lu,\"location\":\"completeMqttConnect\",\"message\":\"MQTT reconnect failed\",\"data\":{\"duration\":%lu,\"rc\":%d,\"nextBackoff\":%lu,\"freeHeapBefore\":%d,\"freeHeapAfter\":%d,\"maxFreeBlockBefore\":%d,\"maxFreeBlockAfter\":%d},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"C\"}\n",
+                     millis(), millis(), reconnectDuration, mqttClient.state(), mqttReconnectBackoff, freeHeapBefore, freeHeapAfter, maxFreeBlockBefore, maxFreeBlockAfter);
+      logFile.close();
     }
+  }
 #endif
-    return false;
+  return false;
+}
+
+// Treibt den Connect-Zustandsautomaten voran (jeder Aufruf kehrt sofort zurück).
+// Gibt true zurück, wenn ein Versuch in diesem Aufruf abgeschlossen wurde.
+bool pollMqttConnect() {
+  switch (mqttConnectState) {
+    case MQTT_CONN_IDLE:
+      return false;
+
+    case MQTT_CONN_RESOLVING:
+      if (mqttDnsDone) {
+        if (mqttDnsResult == 0) {
+          mqttConnectFailed("dns");
+          return true;
+        }
+        mqttDnsIp = IPAddress(mqttDnsResult);
+        mqttDnsResolvedMs = millis();
+        mqttDnsValid = true;
+        Serial.printf("MQTT broker %s resolved to %s\n", mqttDnsHost, mqttDnsIp.toString().c_str());
+        startMqttProbe();
+      } else if (timeDiff(millis(), mqttConnectStateStartMs) > MQTT_DNS_TIMEOUT) {
+        mqttDnsGeneration++;
+        mqttConnectFailed("dns timeout");
+        return true;
+      }
+      return false;
+
+    case MQTT_CONN_PROBING:
+      if (mqttProbeResult == MQTT_PROBE_OK) {
+        mqttProbeClient.close(true);  // Probe erfüllt, PubSubClient verbindet selbst
+        mqttConnectState = MQTT_CONN_IDLE;
+        if (!completeMqttConnect()) {
+          mqttConnectFailed("handshake");
+        }
+        return true;
+      }
+      if (mqttProbeResult == MQTT_PROBE_FAILED ||
+          timeDiff(millis(), mqttConnectStateStartMs) > MQTT_PROBE_TIMEOUT) {
+        mqttProbeClient.close(true);
+        mqttDnsValid = false; // IP evtl. veraltet — beim nächsten Versuch neu auflösen
+        mqttConnectFailed(mqttProbeResult == MQTT_PROBE_FAILED ? "tcp" : "tcp timeout");
+        return true;
+      }
+      return false;
   }
+  return false;
 }
 
 // Rate-Limiting Prüfung für API-Endpoints
-bool checkRateLimit() {
-  unsigned long now = millis();
-  unsigned long timeSinceLastWindow = timeDiff(now, apiRateLimit.lastRequest);
-  
-  if (timeSinceLastWindow > RATE_LIMIT_WINDOW) {
-    // Neues Zeitfenster, Counter zurücksetzen
-    apiRateLimit.requestCount = 1;
-    apiRateLimit.lastRequest = now;
+// Nimmt ein Token aus dem Bucket des aufrufenden Clients. Bei Ablehnung wird
+// Retry-After gesetzt; der Aufrufer antwortet dann mit 429.
+bool checkRateLimit(RateLimiter::Class cls) {
+  uint16_t retryAfter = RateLimiter::take((uint32_t)server.remoteIP(), cls, millis());
+  if (retryAfter == 0) {
     return true;
+  }
+  char value[8];
+  snprintf(value, sizeof(value), "%u", retryAfter);
+  server.sendHeader("Retry-After", value);
+  return false;
+}
+
+// Web-UI: gzip-komprimiert aus dem Flash (tools/gen_web_gz.py), mit starkem ETag
+// aus Firmware-Version + HTML-Hash. Ein Reload mit passendem If-None-Match bekommt
+// 304 ohne Body; Clients ohne gzip-Support bekommen das unkomprimierte HTML.
+static_assert(sizeof(WEB_INTERFACE_HTML) - 1 == WEB_INTERFACE_HTML_LEN,
+              "WebInterfaceGz.h ist veraltet: python3 tools/gen_web_gz.py ausfuehren");
+const char WEB_INTERFACE_ETAG[] = "\"" FIRMWARE_VERSION "-" WEB_INTERFACE_HASH "\"";
+
+void handleRoot() {
+  server.sendHeader("ETag", WEB_INTERFACE_ETAG);
+  // no-cache = immer revalidieren (304), damit nach einem OTA-Update sofort die neue UI kommt
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("If-None-Match") == WEB_INTERFACE_ETAG) {
+    server.send(304);
+    return;
+  }
+  if (server.header("Accept-Encoding").indexOf("gzip") >= 0) {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (PGM_P)WEB_INTERFACE_HTML_GZ, WEB_INTERFACE_HTML_GZ_LEN);
   } else {
-    // Innerhalb des Zeitfensters
-    apiRateLimit.requestCount++;
-    if (apiRateLimit.requestCount > RATE_LIMIT_MAX_REQUESTS) {
-      return false; // Rate-Limit überschritten
+    server.send_P(200, "text/html", WEB_INTERFACE_HTML);
+  }
+}
+
+// Gestreamte JSON-Antwort (chunked): Der JsonWriter leert seinen kleinen Puffer
+// direkt in den TCP-Sendepuffer. Nach dem Header kann kein Fehlerstatus mehr
+// gesendet werden — Prüfungen (Rate-Limit etc.) also vorher erledigen.
+// Sink für JsonWriter/CborWriter: ein HTTP-Chunk
+void sendChunk(const char* data, size_t len) {
+  server.sendContent(data, len);
+}
+
+JsonWriter beginJsonStream(char* chunk, size_t size) {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+  return JsonWriter(chunk, size, sendChunk);
+}
+
+void endJsonStream(JsonWriter& w) {
+  w.flush();
+  server.sendContent(""); // Chunked-Ende
+}
+
+// Uhrzeit für Status/Events im eingestellten 12/24h-Format
+void formatStatusTime(char* buf, size_t size) {
+  time_t now = time(nullptr);
+  struct tm *t = localtime(&now);
+  if (!t) {
+    strncpy(buf, "--:--:--", size);
+    buf[size - 1] = '\0';
+    return;
+  }
+  int displayHour = formatHourForDisplay(t->tm_hour);
+  if (use24HourFormat) {
+    snprintf(buf, size, "%02d:%02d:%02d", displayHour, t->tm_min, t->tm_sec);
+  } else {
+    snprintf(buf, size, "%02d:%02d:%02d %s", displayHour, t->tm_min, t->tm_sec, t->tm_hour >= 12 ? " PM" : " AM");
+  }
+}
+
+// --- Kompakter Binärstatus (CBOR) ---
+// Für Poller (HA-Integration, Monitoring): Integer-Keys statt Feldnamen, jedes
+// Feld nur einmal (keine Alias-Namen), nur die angefragten Gruppen. Die Keys
+// sind Teil der API (README) — nur anhängen, nie umnummerieren.
+// Keys < 24 kosten in CBOR ein Byte: dort liegen die häufig gepollten Felder.
+enum StatusKey : uint8_t {
+  SK_GENERATION = 0,
+  SK_TIME = 1,
+  SK_EFFECT = 2,              // Index in EFFECTS[]
+  SK_EFFECT_NAME = 3,
+  SK_DISPLAY = 4,
+  SK_BRIGHTNESS = 5,
+  SK_AUTO_BRIGHTNESS = 6,
+  SK_SENSOR_VALUE = 7,
+  SK_MIN_BRIGHTNESS = 8,
+  SK_MAX_BRIGHTNESS = 9,
+  SK_SENSOR_MIN = 10,
+  SK_SENSOR_MAX = 11,
+  SK_SENSOR_TEMP = 12,
+  SK_SENSOR_HUMI = 13,
+  SK_MQTT_CONNECTED = 14,
+  SK_USE_24H = 15,
+  SK_TZ = 16,
+  SK_CLOCK_DUR = 17,
+  SK_TEMP_DUR = 18,
+  SK_HUMI_DUR = 19,
+  SK_AVAILABLE_EFFECTS = 20,
+  SK_MQTT_ENABLED = 24,
+  SK_MQTT_SERVER = 25,
+  SK_MQTT_PORT = 26,
+  SK_MQTT_TOPIC = 27,
+  SK_FIRMWARE = 32,
+  SK_HOSTNAME = 33,
+  SK_IP = 34,
+  SK_OTA_ENABLED = 35,
+  SK_RESTART_COUNT = 36,
+  SK_LAST_RESET_REASON = 37,
+  SK_LAST_UPTIME = 38,
+  SK_LAST_HEAP = 39,
+  SK_LAST_OPERATION = 40,
+  SK_LOCAL_SENSOR = 41,
+  SK_WIFI_CONNECT_MS = 42,
+  SK_FIRST_MQTT_PUBLISH_MS = 43,
+  SK_WIFI_FAST_CONNECT = 44,
+  SK_CONFIG_STORE = 45,
+  SK_EEPROM_COMMITS = 48,
+  SK_EEPROM_WRITE_REQUESTS = 49,
+  SK_EEPROM_SKIPPED = 50,
+  SK_EEPROM_FAILURES = 51,
+  SK_EEPROM_PENDING = 52,
+  SK_CONFIG_LOG_BYTES = 53,
+  SK_CONFIG_LOG_COMPACTIONS = 54,
+  SK_HTTP_REQUESTS = 55,
+  SK_HTTP_REJECTED = 56,
+  SK_HTTP_CONNECTIONS = 57,
+  SK_HTTP_PEAK_CONNECTIONS = 58,
+  SK_RATE_LIMITED_READS = 59,
+  SK_RATE_LIMITED_WRITES = 60,
+  SK_RATE_LIMIT_EVICTIONS = 61,
+  SK_HTTP_KEEPALIVE_REUSES = 62,
+  SK_HTTP_PIPELINED = 63,
+  SK_MQTT_DELTA_STATE = 64,
+  SK_MQTT_MIN_INTERVAL = 65,
+  SK_MQTT_DISCOVERY = 66,
+  SK_HTTP_KEEPALIVE_EVICTED = 67
+};
+
+// Gruppen für ?fields= (Bit-Position = Index in STATUS_GROUP_NAMES)
+enum StatusGroup : uint16_t {
+  STATUS_TIME       = 1 << 0,
+  STATUS_EFFECT     = 1 << 1,
+  STATUS_EFFECTS    = 1 << 2,
+  STATUS_DISPLAY    = 1 << 3,
+  STATUS_BRIGHTNESS = 1 << 4,
+  STATUS_SENSORS    = 1 << 5,
+  STATUS_CLOCK      = 1 << 6,
+  STATUS_MQTT       = 1 << 7,
+  STATUS_SYSTEM     = 1 << 8,
+  STATUS_STATS      = 1 << 9,
+  STATUS_ALL        = (1 << 10) - 1
+};
+const char* const STATUS_GROUP_NAMES[] = {
+  "time", "effect", "effects", "display", "brightness", "sensors", "clock", "mqtt", "system", "stats"
+};
+const uint8_t STATUS_GROUP_COUNT = sizeof(STATUS_GROUP_NAMES) / sizeof(STATUS_GROUP_NAMES[0]);
+
+// "display,brightness" → Bitmaske, 0 bei unbekanntem Gruppennamen
+uint16_t parseStatusGroups(const char* list) {
+  uint16_t groups = 0;
+  while (*list) {
+    const char* end = strchr(list, ',');
+    size_t len = end ? (size_t)(end - list) : strlen(list);
+    bool found = false;
+    for (uint8_t i = 0; i < STATUS_GROUP_COUNT && !found; i++) {
+      if (strlen(STATUS_GROUP_NAMES[i]) == len && strncmp(STATUS_GROUP_NAMES[i], list, len) == 0) {
+        groups |= 1 << i;
+        found = true;
+      }
+    }
+    if (!found && len > 0) return 0;
+    list += len;
+    if (*list == ',') list++;
+  }
+  return groups;
+}
+
+bool wantsCborStatus() {
+  if (server.hasArg("format")) return server.arg("format") == "cbor";
+  return server.header("Accept").indexOf("application/cbor") >= 0;
+}
+
+// ?fields=<gruppen> wählt die Gruppen (Default: alle). ?since=<generation>
+// liefert 304 ohne Body, solange sich Einstellungen und Zustand (Display,
+// Effekt, Helligkeit, MQTT-Verbindung) nicht geändert haben — Uhrzeit,
+// Sensorwerte und Zähler erhöhen die Generation nicht.
+void handleStatusCbor() {
+  uint16_t groups = STATUS_ALL;
+  if (server.hasArg("fields")) {
+    groups = parseStatusGroups(server.arg("fields").c_str());
+    if (groups == 0) {
+      server.send(400, "application/json", "{\"error\":\"Unknown field group\"}");
+      return;
     }
-    return true;
   }
-}
+  if (server.hasArg("since") &&
+      strtoul(server.arg("since").c_str(), nullptr, 10) == statusGeneration) {
+    server.send(304);
+    return;
+  }
 
-void handleRoot() {
-  server.send_P(200, "text/html", WEB_INTERFACE_HTML);
+  uint8_t chunk[BUFFER_SIZE_JSON_CHUNK];
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/cbor", "");
+  CborWriter w(chunk, sizeof(chunk), sendChunk);
+  w.beginMap();
+  w.addUInt(SK_GENERATION, statusGeneration);
+  if (groups & STATUS_TIME) {
+    char buf[BUFFER_SIZE_TIME];
+    formatStatusTime(buf, sizeof(buf));
+    w.addString(SK_TIME, buf);
+  }
+  if (groups & STATUS_EFFECT) {
+    w.addUInt(SK_EFFECT, currentEffectIndex);
+    w.addString(SK_EFFECT_NAME, EFFECTS[currentEffectIndex].name);
+  }
+  if (groups & STATUS_EFFECTS) {
+    w.beginArray(SK_AVAILABLE_EFFECTS);
+    for (uint8_t i = 0; i < effectCount; i++) w.writeString(EFFECTS[i].name);
+    w.endArray();
+  }
+  if (groups & STATUS_DISPLAY) {
+    w.addBool(SK_DISPLAY, displayEnabled);
+  }
+  if (groups & STATUS_BRIGHTNESS) {
+    w.addUInt(SK_BRIGHTNESS, brightness);
+    w.addBool(SK_AUTO_BRIGHTNESS, autoBrightnessEnabled);
+    w.addUInt(SK_SENSOR_VALUE, LightSensor::value());
+    w.addUInt(SK_MIN_BRIGHTNESS, minBrightness);
+    w.addUInt(SK_MAX_BRIGHTNESS, maxBrightness);
+    w.addUInt(SK_SENSOR_MIN, sensorMin);
+    w.addUInt(SK_SENSOR_MAX, sensorMax);
+  }
+  if (groups & STATUS_SENSORS) {
+    w.addFloat(SK_SENSOR_TEMP, g_sensorTemp);
+    w.addFloat(SK_SENSOR_HUMI, g_sensorHumi);
+    w.addString(SK_LOCAL_SENSOR, LOCAL_SENSOR_NAME);
+  }
+  if (groups & STATUS_CLOCK) {
+    w.addBool(SK_USE_24H, use24HourFormat);
+    w.addString(SK_TZ, tzString);
+    w.addUInt(SK_CLOCK_DUR, g_clockDur);
+    w.addUInt(SK_TEMP_DUR, g_tempDur);
+    w.addUInt(SK_HUMI_DUR, g_humiDur);
+  }
+  if (groups & STATUS_MQTT) {
+    w.addBool(SK_MQTT_CONNECTED, mqttClient.connected());
+    w.addBool(SK_MQTT_ENABLED, mqttEnabled);
+    w.addString(SK_MQTT_SERVER, mqttServer);
+    w.addUInt(SK_MQTT_PORT, mqttPort);
+    w.addString(SK_MQTT_TOPIC, mqttBaseTopic);
+    w.addBool(SK_MQTT_DELTA_STATE, mqttDeltaState);
+    w.addUInt(SK_MQTT_MIN_INTERVAL, mqttMinIntervalMs);
+    w.addBool(SK_MQTT_DISCOVERY, mqttDiscovery);
+  }
+  if (groups & STATUS_SYSTEM) {
+    char hostname[BUFFER_SIZE_HOSTNAME];
+    snprintf(hostname, sizeof(hostname), "IkeaClock-%x", ESP.getChipId());
+    char ipAddress[16];
+    IPAddress ip = WiFi.localIP();
+    snprintf(ipAddress, sizeof(ipAddress), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    w.addString(SK_FIRMWARE, FIRMWARE_VERSION);
+    w.addString(SK_HOSTNAME, hostname);
+    w.addString(SK_IP, ipAddress);
+    w.addBool(SK_OTA_ENABLED, WiFi.status() == WL_CONNECTED);
+    w.addUInt(SK_RESTART_COUNT, restartCount);
+    w.addString(SK_LAST_RESET_REASON, lastResetReason);
+    w.addUInt(SK_LAST_UPTIME, lastUptimeBeforeRestart);
+    w.addUInt(SK_LAST_HEAP, lastHeapBeforeRestart);
+    w.addString(SK_LAST_OPERATION, lastOperationBeforeRestart);
+    w.addUInt(SK_WIFI_CONNECT_MS, bootWifiConnectedMs);
+    w.addUInt(SK_FIRST_MQTT_PUBLISH_MS, bootFirstMqttPublishMs);
+    w.addBool(SK_WIFI_FAST_CONNECT, wifiFastConnectUsed);
+    w.addString(SK_CONFIG_STORE, ConfigLog::mounted ? "log" : "eeprom");
+  }
+  if (groups & STATUS_STATS) {
+    w.addUInt(SK_EEPROM_COMMITS, EepromWriteBack::commits);
+    w.addUInt(SK_EEPROM_WRITE_REQUESTS, EepromWriteBack::requests);
+    w.addUInt(SK_EEPROM_SKIPPED, EepromWriteBack::skipped);
+    w.addUInt(SK_EEPROM_FAILURES, EepromWriteBack::failures);
+    w.addUInt(SK_EEPROM_PENDING, EepromWriteBack::dirtyBytes());
+    w.addUInt(SK_CONFIG_LOG_BYTES, ConfigLog::mounted ? ConfigLog::writeOffset : 0);
+    w.addUInt(SK_CONFIG_LOG_COMPACTIONS, ConfigLog::compactions);
+    w.addUInt(SK_HTTP_REQUESTS, server.requests);
+    w.addUInt(SK_HTTP_REJECTED, server.rejected);
+    w.addUInt(SK_HTTP_CONNECTIONS, server.activeConnections());
+    w.addUInt(SK_HTTP_PEAK_CONNECTIONS, server.peakConnections);
+    w.addUInt(SK_RATE_LIMITED_READS, RateLimiter::rejected[RateLimiter::READ]);
+    w.addUInt(SK_RATE_LIMITED_WRITES, RateLimiter::rejected[RateLimiter::WRITE]);
+    w.addUInt(SK_RATE_LIMIT_EVICTIONS, RateLimiter::evictions);
+    w.addUInt(SK_HTTP_KEEPALIVE_REUSES, server.keepAliveReuses);
+    w.addUInt(SK_HTTP_PIPELINED, server.pipelined);
+    w.addUInt(SK_HTTP_KEEPALIVE_EVICTED, server.keepAliveEvicted);
+  }
+  w.endMap();
+  w.flush();
+  server.sendContent(""); // Chunked-Ende
 }
 
 void handleStatus() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::READ)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
-  time_t now = time(nullptr);
-  struct tm *t = localtime(&now);
-  char buf[16];
-  int displayHour = t ? formatHourForDisplay(t->tm_hour) : 0;
-  const char* suffix = (!use24HourFormat && t) ? (t->tm_hour >= 12 ? " PM" : " AM") : "";
-  if (t) {
-    if (use24HourFormat) {
-      snprintf(buf, sizeof(buf), "%02d:%02d:%02d", displayHour, t->tm_min, t->tm_sec);
-    } else {
-      snprintf(buf, sizeof(buf), "%02d:%02d:%02d %s", displayHour, t->tm_min, t->tm_sec, suffix);
-    }
-  } else {
-    strncpy(buf, "--:--:--", sizeof(buf));
-    buf[sizeof(buf) - 1] = '\0';
+  if (wantsCborStatus()) {
+    handleStatusCbor();
+    return;
   }
-  uint16_t sensorValue = analogRead(LIGHT_SENSOR_PIN);
-  const char* hourFormatStr = use24HourFormat ? "24h" : "12h";
-  
-  // JSON mit snprintf für bessere Performance (statt String-Konkatenation)
-  // Buffer erweitert für Effekt-Liste und HA-Kompatibilität
-  char json[BUFFER_SIZE_JSON_STATUS];
-  String ipAddress = WiFi.localIP().toString();
-  
-  // Effekt-Liste als JSON-Array erstellen
-  String effectList = "[";
-  for (uint8_t i = 0; i < effectCount; i++) {
-    if (i > 0) effectList += ",";
-    effectList += "\"";
-    effectList += effects[i]->name;
-    effectList += "\"";
-  }
-  effectList += "]";
-  
+  char buf[16];
+  formatStatusTime(buf, sizeof(buf));
+  uint16_t sensorValue = LightSensor::value();
+
   // Dynamischer Hostname basierend auf Chip-ID (eindeutig pro Gerät)
   char hostname[BUFFER_SIZE_HOSTNAME];
   snprintf(hostname, sizeof(hostname), "IkeaClock-%x", ESP.getChipId());
-  
-  // Formatiere Uptime und Heap vor Restart für Web-Interface
-  uint16_t uptimeHours = 0;
-  uint16_t uptimeMinutes = 0;
-  uint16_t heapKB = 0;
-  
-  if (lastUptimeBeforeRestart > 0) {
-    uptimeHours = lastUptimeBeforeRestart / 3600000; // Millisekunden zu Stunden
-    uptimeMinutes = (lastUptimeBeforeRestart % 3600000) / 60000; // Rest zu Minuten
+  char ipAddress[16];
+  IPAddress ip = WiFi.localIP();
+  snprintf(ipAddress, sizeof(ipAddress), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+
+  // JSON-Response mit beiden Feldnamen (alte für Web-Interface, Aliase für HA-Integration).
+  // Konfigurationsfelder kommen aus CONFIG_SCHEMA (FLAG_STATUS). Gestreamt (chunked),
+  // daher keine Größengrenze und nur BUFFER_SIZE_JSON_CHUNK Bytes auf dem Stack.
+  char chunk[BUFFER_SIZE_JSON_CHUNK];
+  JsonWriter w = beginJsonStream(chunk, sizeof(chunk));
+  w.beginObject();
+  w.addString("time", buf);
+  w.addString("effect", EFFECTS[currentEffectIndex].name);
+  w.addString("currentEffect", EFFECTS[currentEffectIndex].name);
+  ConfigSchema::serialize(w, CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, FLAG_STATUS);
+  w.addString("hourFormat", use24HourFormat ? "24h" : "12h");
+  w.addUInt("sensorValue", sensorValue);
+  w.addBool("mqttConnected", mqttClient.connected());
+  w.addBool("displayEnabled", displayEnabled);
+  w.addRaw("availableEffects", EFFECT_LIST_JSON.text);
+  w.addFloat("sensorTemp", g_sensorTemp);
+  w.addFloat("sensorHumi", g_sensorHumi);
+  w.addBool("otaEnabled", WiFi.status() == WL_CONNECTED);
+  w.addString("otaHostname", hostname);
+  w.addString("ipAddress", ipAddress);
+  w.addString("firmwareVersion", FIRMWARE_VERSION);
+  w.addString("version", FIRMWARE_VERSION);
+
+  // Uptime und Heap vor Restart (zusätzlich formatiert für das Web-Interface)
+  w.addUInt("lastUptimeBeforeRestart", lastUptimeBeforeRestart);
+  w.addUInt("lastHeapBeforeRestart", lastHeapBeforeRestart);
+  w.addUInt("lastUptimeBeforeRestartHours", lastUptimeBeforeRestart / 3600000);
+  w.addUInt("lastUptimeBeforeRestartMinutes", (lastUptimeBeforeRestart % 3600000) / 60000);
+  w.addUInt("lastHeapBeforeRestartKB", lastHeapBeforeRestart / 1024);
+  w.addString("lastOperationBeforeRestart", lastOperationBeforeRestart);
+
+  w.addUInt("eepromCommits", EepromWriteBack::commits);
+  w.addUInt("eepromWriteRequests", EepromWriteBack::requests);
+  w.addUInt("eepromSkippedWrites", EepromWriteBack::skipped);
+  w.addUInt("eepromCommitFailures", EepromWriteBack::failures);
+  w.addUInt("eepromPendingBytes", EepromWriteBack::dirtyBytes());
+  w.addString("configStore", ConfigLog::mounted ? "log" : "eeprom");
+  w.addUInt("configLogBytesUsed", ConfigLog::mounted ? ConfigLog::writeOffset : 0);
+  w.addUInt("configLogCompactions", ConfigLog::compactions);
+  w.addUInt("wifiConnectMs", bootWifiConnectedMs);
+  w.addUInt("firstMqttPublishMs", bootFirstMqttPublishMs);
+  w.addBool("wifiFastConnect", wifiFastConnectUsed);
+  w.addUInt("httpRequests", server.requests);
+  w.addUInt("httpRejected", server.rejected);
+  w.addUInt("httpConnections", server.activeConnections());
+  w.addUInt("httpPeakConnections", server.peakConnections);
+  w.addUInt("rateLimitedReads", RateLimiter::rejected[RateLimiter::READ]);
+  w.addUInt("rateLimitedWrites", RateLimiter::rejected[RateLimiter::WRITE]);
+  w.addUInt("rateLimitEvictions", RateLimiter::evictions);
+  w.addUInt("httpKeepAliveReuses", server.keepAliveReuses);
+  w.addUInt("httpPipelined", server.pipelined);
+  w.addUInt("httpKeepAliveEvicted", server.keepAliveEvicted);
+  w.addString("localSensor", LOCAL_SENSOR_NAME);
+  w.addUInt("generation", statusGeneration);
+  w.endObject();
+  endJsonStream(w);
+}
+
+// === Server-Sent Events (/api/events) ===
+// Statt das Web-UI alle 2 s /api/status pollen zu lassen, werden nur geänderte
+// Live-Felder gepusht (event: status, data: JSON-Delta). Nach dem Verbinden gibt
+// es einmal alle Felder, danach nur Änderungen; alle SSE_KEEPALIVE_MS ein
+// Kommentar als Keep-Alive. Die Verbindung wird per server.beginStream()
+// übernommen und bleibt neben den normalen Requests offen.
+const uint8_t SSE_MAX_CLIENTS = 3;
+const unsigned long SSE_TICK_MS = 500;            // Änderungsprüfung
+const unsigned long SSE_SENSOR_INTERVAL = 2000;   // Sensorwert gedrosselt melden (Rauschen)
+const unsigned long SSE_KEEPALIVE_MS = 15000;
+const unsigned long SSE_RETRY_MS = 5000;          // Reconnect-Hinweis an den Browser
+
+struct SseClient {
+  AsyncHttpServer::StreamId stream = {0xFF, 0};
+  bool needsFull = false;  // Neu verbunden: nächstes Event enthält alle Felder
+};
+SseClient sseClients[SSE_MAX_CLIENTS];
+
+struct SseSnapshot {
+  char time[16];
+  uint8_t effect;
+  uint16_t brightness;
+  uint16_t sensorValue;
+  float sensorTemp;
+  float sensorHumi;
+  bool autoBrightness;
+  bool displayEnabled;
+  bool mqttConnected;
+};
+SseSnapshot sseCur;   // Aktueller Stand (in sseLoop() erfasst)
+SseSnapshot sseLast;  // Zuletzt gepushter Stand (gemeinsam für alle Clients)
+
+uint8_t sseClientCount() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (server.streamConnected(sseClients[i].stream)) n++;
   }
-  
-  if (lastHeapBeforeRestart > 0) {
-    heapKB = lastHeapBeforeRestart / 1024; // Bytes zu KB
+  return n;
+}
+
+void handleEvents() {
+  if (!checkRateLimit(RateLimiter::READ)) {
+    server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
+    return;
   }
-  
-  // SensorClock: Format-Strings für float-Werte (NaN -> "null")
-  char sensorTempStr[16];
-  char sensorHumiStr[16];
-  if (isnan(g_sensorTemp)) {
-    strncpy(sensorTempStr, "null", sizeof(sensorTempStr));
-  } else {
-    snprintf(sensorTempStr, sizeof(sensorTempStr), "%.1f", g_sensorTemp);
+  SseClient* slot = nullptr;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!server.streamConnected(sseClients[i].stream)) {
+      slot = &sseClients[i];
+      break;
+    }
   }
-  if (isnan(g_sensorHumi)) {
-    strncpy(sensorHumiStr, "null", sizeof(sensorHumiStr));
-  } else {
-    snprintf(sensorHumiStr, sizeof(sensorHumiStr), "%.1f", g_sensorHumi);
-  }
-
-  // JSON-Response mit beiden Feldnamen (alte für Web-Interface, neue für HA-Integration)
-  int jsonLen = snprintf(json, sizeof(json),
-    "{\"time\":\"%s\",\"effect\":\"%s\",\"currentEffect\":\"%s\",\"tz\":\"%s\",\"timezone\":\"%s\",\"hourFormat\":\"%s\",\"use24HourFormat\":%s,\"brightness\":%d,"
-    "\"autoBrightness\":%s,\"autoBrightnessEnabled\":%s,\"minBrightness\":%d,\"maxBrightness\":%d,"
-    "\"autoBrightnessMin\":%d,\"autoBrightnessMax\":%d,\"sensorMin\":%d,\"sensorMax\":%d,"
-    "\"autoBrightnessSensorMin\":%d,\"autoBrightnessSensorMax\":%d,\"sensorValue\":%d,"
-    "\"mqttEnabled\":%s,\"mqttConnected\":%s,\"mqttServer\":\"%s\","
-    "\"mqttPort\":%d,\"mqttBaseTopic\":\"%s\",\"mqttTopic\":\"%s\","
-    "\"displayEnabled\":%s,"
-    "\"availableEffects\":%s,"
-    "\"sensorTemp\":%s,\"sensorHumi\":%s,\"clockDur\":%u,\"tempDur\":%u,\"humiDur\":%u,"
-    "\"otaEnabled\":%s,\"otaHostname\":\"%s\",\"ipAddress\":\"%s\","
-    "\"firmwareVersion\":\"%s\",\"version\":\"%s\","
-    "\"restartCount\":%lu,\"lastResetReason\":\"%s\","
-    "\"lastUptimeBeforeRestart\":%lu,\"lastHeapBeforeRestart\":%u,"
-    "\"lastUptimeBeforeRestartHours\":%u,\"lastUptimeBeforeRestartMinutes\":%u,\"lastHeapBeforeRestartKB\":%u,"
-    "\"localSensor\":\"" LOCAL_SENSOR_NAME "\"}",
-    buf, currentEffect->name, currentEffect->name, tzString, tzString, hourFormatStr, use24HourFormat ? "true" : "false", brightness,
-    autoBrightnessEnabled ? "true" : "false", autoBrightnessEnabled ? "true" : "false", minBrightness, maxBrightness,
-    minBrightness, maxBrightness, sensorMin, sensorMax,
-    sensorMin, sensorMax, sensorValue,
-    mqttEnabled ? "true" : "false", mqttClient.connected() ? "true" : "false",
-    mqttServer, mqttPort, mqttBaseTopic, mqttBaseTopic,
-    displayEnabled ? "true" : "false",
-    effectList.c_str(),
-    sensorTempStr, sensorHumiStr, g_clockDur, g_tempDur, g_humiDur,
-    (WiFi.status() == WL_CONNECTED) ? "true" : "false", hostname, ipAddress.c_str(),
-    FIRMWARE_VERSION, FIRMWARE_VERSION,
-    restartCount, lastResetReason,
-    lastUptimeBeforeRestart, lastHeapBeforeRestart,
-    uptimeHours, uptimeMinutes, heapKB);
-  
-  // Prüfe ob snprintf erfolgreich war (Rückgabewert >= 0 und < sizeof(json))
-  if (jsonLen < 0 || jsonLen >= (int)sizeof(json)) {
-    // Buffer Overflow oder Fehler - sende Fehler-Response
-    server.send(500, "application/json", "{\"error\":\"Internal server error: JSON generation failed\"}");
+  if (!slot) {
+    // Web-UI fällt bei Fehler auf Polling zurück
+    server.send(503, "application/json", "{\"error\":\"Too many event streams\"}");
     return;
   }
-  
-  server.send(200, "application/json", json);
+  char header[192];
+  snprintf(header, sizeof(header),
+           "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+           "Connection: keep-alive\r\n\r\nretry: %lu\n\n", SSE_RETRY_MS);
+  slot->stream = server.beginStream(header);
+  slot->needsFull = true;
+  Serial.printf("[SSE] Client %s connected (%u/%u)\n",
+                server.remoteIP().toString().c_str(), sseClientCount(), SSE_MAX_CLIENTS);
+}
+
+bool sseFloatChanged(float a, float b) {
+  if (isnan(a) || isnan(b)) return isnan(a) != isnan(b);
+  return fabsf(a - b) >= 0.05f;
+}
+
+// Schreibt die Felder, die sich seit dem letzten Push geändert haben (alle bei full)
+void sseWriteFields(JsonWriter& w, bool full) {
+  const SseSnapshot& cur = sseCur;
+  const SseSnapshot& prev = sseLast;
+  if (full || strcmp(cur.time, prev.time) != 0) w.addString("time", cur.time);
+  if (full || cur.effect != prev.effect) w.addString("effect", EFFECTS[cur.effect].name);
+  if (full || cur.brightness != prev.brightness) w.addUInt("brightness", cur.brightness);
+  if (full || cur.autoBrightness != prev.autoBrightness) w.addBool("autoBrightness", cur.autoBrightness);
+  if (full || cur.displayEnabled != prev.displayEnabled) w.addBool("displayEnabled", cur.displayEnabled);
+  if (full || cur.mqttConnected != prev.mqttConnected) {
+    w.addBool("mqttConnected", cur.mqttConnected);
+    w.addBool("mqttEnabled", mqttEnabled);
+  }
+  if (full || cur.sensorValue != prev.sensorValue) w.addUInt("sensorValue", cur.sensorValue);
+  if (full || sseFloatChanged(cur.sensorTemp, prev.sensorTemp)) w.addFloat("sensorTemp", cur.sensorTemp);
+  if (full || sseFloatChanged(cur.sensorHumi, prev.sensorHumi)) w.addFloat("sensorHumi", cur.sensorHumi);
+}
+
+// Nicht blockierend: passt das Event nicht in den TCP-Sendepuffer, wird der
+// Client getrennt (Browser verbindet sich nach SSE_RETRY_MS neu und bekommt
+// dann wieder alle Felder).
+void sseSend(uint8_t idx, const char* data, size_t len) {
+  SseClient& c = sseClients[idx];
+  if (server.streamSpace(c.stream) < len) {
+    Serial.println("[SSE] Client too slow, dropping");
+    server.streamClose(c.stream);
+    return;
+  }
+  server.streamWrite(c.stream, data, len);
+}
+
+// Baut "event: status\ndata: {...}\n\n" in buf; 0 wenn keine Felder
+size_t sseBuildEvent(char* buf, size_t size, bool full) {
+  static const char PREFIX[] = "event: status\ndata: ";
+  const size_t prefixLen = sizeof(PREFIX) - 1;
+  JsonWriter w(buf + prefixLen, size - prefixLen - 2);
+  w.beginObject();
+  sseWriteFields(w, full);
+  w.endObject();
+  if (!w.ok() || w.length() <= 2) return 0;
+  memcpy(buf, PREFIX, prefixLen);
+  size_t len = prefixLen + w.length();
+  buf[len++] = '\n';
+  buf[len++] = '\n';
+  return len;
+}
+
+void sseLoop() {
+  static unsigned long lastTick = 0;
+  static unsigned long lastKeepAlive = 0;
+  static unsigned long lastSensorRead = 0;
+  static uint16_t sensorValue = 0;
+  unsigned long now = millis();
+  if (timeDiff(now, lastTick) < SSE_TICK_MS) return;
+  lastTick = now;
+
+  bool anyClient = false;
+  bool anyFull = false;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!server.streamConnected(sseClients[i].stream)) continue;
+    anyClient = true;
+    anyFull |= sseClients[i].needsFull;
+  }
+  if (!anyClient) return;
+
+  if (anyFull || timeDiff(now, lastSensorRead) >= SSE_SENSOR_INTERVAL) {
+    sensorValue = LightSensor::value();
+    lastSensorRead = now;
+  }
+
+  SseSnapshot& cur = sseCur;
+  formatStatusTime(cur.time, sizeof(cur.time));
+  cur.effect = currentEffectIndex;
+  cur.brightness = brightness;
+  cur.sensorValue = sensorValue;
+  cur.sensorTemp = g_sensorTemp;
+  cur.sensorHumi = g_sensorHumi;
+  cur.autoBrightness = autoBrightnessEnabled;
+  cur.displayEnabled = displayEnabled;
+  cur.mqttConnected = mqttClient.connected();
+
+  char event[BUFFER_SIZE_JSON_MEDIUM];
+  size_t deltaLen = sseBuildEvent(event, sizeof(event), false);
+  bool sent = false;
+  for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+    SseClient& c = sseClients[i];
+    if (!server.streamConnected(c.stream) || c.needsFull || deltaLen == 0) continue;
+    sseSend(i, event, deltaLen);
+    sent = true;
+  }
+  if (anyFull) {
+    size_t fullLen = sseBuildEvent(event, sizeof(event), true);
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+      SseClient& c = sseClients[i];
+      if (!server.streamConnected(c.stream) || !c.needsFull) continue;
+      sseSend(i, event, fullLen);
+      c.needsFull = false;
+    }
+    sent = true;
+  }
+  sseLast = sseCur;
+
+  if (sent) {
+    lastKeepAlive = now;
+  } else if (timeDiff(now, lastKeepAlive) >= SSE_KEEPALIVE_MS) {
+    static const char KEEPALIVE[] = ": keep-alive\n\n";
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++) {
+      if (server.streamConnected(sseClients[i].stream)) sseSend(i, KEEPALIVE, sizeof(KEEPALIVE) - 1);
+    }
+    lastKeepAlive = now;
+  }
+}
+
+// Laufzeit-Profil pro Subsystem (min/avg/max + log2-Histogramm in µs)
+// Wird gestreamt (chunked), damit kein großer JSON-Buffer nötig ist.
+// ?reset=1 setzt die Statistik nach dem Senden zurück.
+void handlePerf() {
+  if (!checkRateLimit(RateLimiter::READ)) {
+    server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
+    return;
+  }
+  char buf[BUFFER_SIZE_JSON_MEDIUM];
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+  snprintf(buf, sizeof(buf), "{\"unit\":\"us\",\"window\":%lu,\"buckets\":\"log2\",\"sections\":{",
+           timeDiff(millis(), Perf::resetAtMs));
+  server.sendContent(buf);
+  for (uint8_t i = 0; i < PERF_SECTION_COUNT; i++) {
+    const Perf::Stat& st = Perf::stats[i];
+    uint32_t avg = st.count > 0 ? (uint32_t)(st.totalUs / st.count) : 0;
+    int len = snprintf(buf, sizeof(buf), "%s\"%s\":{\"n\":%u,\"min\":%u,\"avg\":%u,\"max\":%u,\"h\":[",
+                       i > 0 ? "," : "", Perf::SECTION_NAMES[i], st.count,
+                       st.count > 0 ? st.minUs : 0, avg, st.maxUs);
+    for (uint8_t b = 0; b < Perf::HIST_BUCKETS && len > 0 && len < (int)sizeof(buf); b++) {
+      len += snprintf(buf + len, sizeof(buf) - len, b > 0 ? ",%u" : "%u", st.hist[b]);
+    }
+    if (len > 0 && len < (int)sizeof(buf)) {
+      snprintf(buf + len, sizeof(buf) - len, "]}");
+    }
+    server.sendContent(buf);
+  }
+  server.sendContent("}}");
+  server.sendContent(""); // Chunked-Ende
+  if (server.hasArg("reset") && server.arg("reset") == "1") {
+    Perf::reset();
+  }
+}
+
+// Prometheus-Textformat (Version 0.0.4). Zeilenweise gestreamt: RAM-Bedarf nur
+// der Chunk-Puffer, egal wie viele Routen/Sektionen es gibt.
+void handleMetrics() {
+  if (!checkRateLimit(RateLimiter::READ)) {
+    server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
+    return;
+  }
+  char chunk[BUFFER_SIZE_JSON_CHUNK];
+  char labels[64];
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+  Metrics::Writer m(chunk, sizeof(chunk), sendChunk);
+
+  m.family("obegraensad_uptime_seconds", "gauge", "Time since boot");
+  m.sample("obegraensad_uptime_seconds", nullptr, (uint32_t)(millis() / 1000));
+  m.family("obegraensad_heap_free_bytes", "gauge", "Free heap");
+  m.sample("obegraensad_heap_free_bytes", nullptr, ESP.getFreeHeap());
+  m.family("obegraensad_heap_max_free_block_bytes", "gauge", "Largest free heap block");
+  m.sample("obegraensad_heap_max_free_block_bytes", nullptr, ESP.getMaxFreeBlockSize());
+
+  // Rendering
+  m.family("obegraensad_loop_iterations_total", "counter", "loop() iterations");
+  m.sample("obegraensad_loop_iterations_total", nullptr, Metrics::loopIterations);
+  m.family("obegraensad_frames_rendered_total", "counter", "Frames drawn and shifted out");
+  m.sample("obegraensad_frames_rendered_total", nullptr, Metrics::framesRendered);
+  m.family("obegraensad_frames_skipped_total", "counter", "50 ms frame slots missed because loop() was late");
+  m.sample("obegraensad_frames_skipped_total", nullptr, Metrics::framesSkipped);
+  m.family("obegraensad_spi_bytes_total", "counter", "Bytes shifted out to the LED matrix");
+  m.sample("obegraensad_spi_bytes_total", nullptr, spiBytesWritten);
+  m.family("obegraensad_display_enabled", "gauge", "Display on (1) or off (0)");
+  m.sample("obegraensad_display_enabled", nullptr, (uint32_t)displayEnabled);
+  m.family("obegraensad_brightness", "gauge", "PWM brightness 0-1023");
+  m.sample("obegraensad_brightness", nullptr, (uint32_t)brightness);
+
+  // Loop-Dauer als Histogramm (Perf-Buckets: Bucket i = [2^i, 2^(i+1)) µs)
+  const Perf::Stat& loopStat = Perf::stats[PERF_LOOP];
+  m.family("obegraensad_loop_duration_seconds", "histogram", "Duration of one loop() iteration");
+  uint32_t cumulative = 0;
+  for (uint8_t b = 0; b < Perf::HIST_BUCKETS; b++) {
+    cumulative += loopStat.hist[b];
+    if (b + 1 < Perf::HIST_BUCKETS) {
+      snprintf(labels, sizeof(labels), "le=\"%.6f\"", (double)(2UL << b) / 1e6);
+    } else {
+      snprintf(labels, sizeof(labels), "le=\"+Inf\"");
+    }
+    m.sample("obegraensad_loop_duration_seconds_bucket", labels, cumulative);
+  }
+  m.sample("obegraensad_loop_duration_seconds_sum", nullptr, (double)loopStat.totalUs / 1e6);
+  m.sample("obegraensad_loop_duration_seconds_count", nullptr, loopStat.count);
+
+  m.family("obegraensad_section_seconds_total", "counter", "Time spent per subsystem");
+  for (uint8_t i = 0; i < PERF_SECTION_COUNT; i++) {
+    snprintf(labels, sizeof(labels), "section=\"%s\"", Perf::SECTION_NAMES[i]);
+    m.sample("obegraensad_section_seconds_total", labels, (double)Perf::stats[i].totalUs / 1e6);
+  }
+
+  // Netzwerk
+  m.family("obegraensad_wifi_reconnects_total", "counter", "WiFi reconnects after a lost connection");
+  m.sample("obegraensad_wifi_reconnects_total", nullptr, Metrics::wifiReconnects);
+  m.family("obegraensad_mqtt_connected", "gauge", "MQTT broker connection up (1) or down (0)");
+  m.sample("obegraensad_mqtt_connected", nullptr, (uint32_t)mqttClient.connected());
+  m.family("obegraensad_mqtt_connects_total", "counter", "Successful MQTT connects (including the first)");
+  m.sample("obegraensad_mqtt_connects_total", nullptr, Metrics::mqttConnects);
+  m.family("obegraensad_mqtt_messages_received_total", "counter", "MQTT commands received");
+  m.sample("obegraensad_mqtt_messages_received_total", nullptr, Metrics::mqttMessagesIn);
+  m.family("obegraensad_mqtt_frames_received_total", "counter", "Frames received on <base>/frame");
+  m.sample("obegraensad_mqtt_frames_received_total", nullptr, MqttFrames::received);
+  m.family("obegraensad_mqtt_frames_rejected_total", "counter", "Messages on <base>/frame with an invalid length");
+  m.sample("obegraensad_mqtt_frames_rejected_total", nullptr, MqttFrames::rejected);
+  m.family("obegraensad_mqtt_messages_sent_total", "counter", "MQTT messages published");
+  m.sample("obegraensad_mqtt_messages_sent_total", nullptr, Metrics::mqttMessagesOut);
+  m.family("obegraensad_mqtt_queue_length", "gauge", "Outbound MQTT messages waiting for send or PUBACK");
+  m.sample("obegraensad_mqtt_queue_length", nullptr, (uint32_t)MqttQueue::length());
+  m.family("obegraensad_mqtt_queue_bytes", "gauge", "Outbound MQTT queue bytes in use");
+  m.sample("obegraensad_mqtt_queue_bytes", nullptr, (uint32_t)MqttQueue::used);
+  m.family("obegraensad_mqtt_queue_enqueued_total", "counter", "Messages added to the outbound MQTT queue");
+  m.sample("obegraensad_mqtt_queue_enqueued_total", nullptr, MqttQueue::queued);
+  m.family("obegraensad_mqtt_queue_dropped_total", "counter", "Oldest queued MQTT messages dropped because the queue was full");
+  m.sample("obegraensad_mqtt_queue_dropped_total", nullptr, MqttQueue::dropped);
+  m.family("obegraensad_mqtt_queue_retries_total", "counter", "QoS 1 publishes resent after no PUBACK");
+  m.sample("obegraensad_mqtt_queue_retries_total", nullptr, MqttQueue::retries);
+  m.family("obegraensad_mqtt_queue_acked_total", "counter", "QoS 1 publishes acknowledged by the broker");
+  m.sample("obegraensad_mqtt_queue_acked_total", nullptr, MqttQueue::acked);
+
+  // HTTP
+  m.family("obegraensad_http_requests_total", "counter", "HTTP requests per route");
+  for (uint8_t i = 0; i < server.routeCount(); i++) {
+    snprintf(labels, sizeof(labels), "route=\"%s\"", server.routeUri(i));
+    m.sample("obegraensad_http_requests_total", labels, server.routeHits(i));
+  }
+  m.sample("obegraensad_http_requests_total", "route=\"(unmatched)\"", server.unmatched);
+  m.family("obegraensad_http_responses_total", "counter", "HTTP responses per status class");
+  for (uint8_t c = 1; c <= 5; c++) {
+    snprintf(labels, sizeof(labels), "code=\"%uxx\"", c);
+    m.sample("obegraensad_http_responses_total", labels, server.responses[c]);
+  }
+  m.family("obegraensad_http_rejected_connections_total", "counter", "Connections refused because all slots were busy");
+  m.sample("obegraensad_http_rejected_connections_total", nullptr, server.rejected);
+  m.family("obegraensad_http_keepalive_reuses_total", "counter", "Requests served on an already open keep-alive connection");
+  m.sample("obegraensad_http_keepalive_reuses_total", nullptr, server.keepAliveReuses);
+  m.family("obegraensad_http_pipelined_total", "counter", "Requests received while the previous response was still in progress");
+  m.sample("obegraensad_http_pipelined_total", nullptr, server.pipelined);
+  m.family("obegraensad_http_keepalive_evicted_total", "counter", "Idle keep-alive connections closed to make room for a new client");
+  m.sample("obegraensad_http_keepalive_evicted_total", nullptr, server.keepAliveEvicted);
+  m.family("obegraensad_rate_limited_total", "counter", "Requests rejected by the per-IP rate limiter");
+  m.sample("obegraensad_rate_limited_total", "class=\"read\"", RateLimiter::rejected[RateLimiter::READ]);
+  m.sample("obegraensad_rate_limited_total", "class=\"write\"", RateLimiter::rejected[RateLimiter::WRITE]);
+
+  // Konfigurationsspeicher
+  m.family("obegraensad_eeprom_commits_total", "counter", "Config commits to flash");
+  m.sample("obegraensad_eeprom_commits_total", nullptr, EepromWriteBack::commits);
+  m.family("obegraensad_eeprom_commit_failures_total", "counter", "Failed config commits");
+  m.sample("obegraensad_eeprom_commit_failures_total", nullptr, EepromWriteBack::failures);
+
+  m.flush();
+  server.sendContent(""); // Chunked-Ende
 }
 
 // Prüft ob ein POSIX-TZ-String grundlegend gültig aussieht.
@@ -1195,7 +2031,7 @@ bool isValidTzString(const char* tz) {
 }
 
 void handleSetTimezone() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1226,7 +2062,7 @@ void handleSetTimezone() {
 }
 
 void handleSetClockFormat() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1259,7 +2095,7 @@ void handleSetClockFormat() {
 }
 
 void handleSetBrightness() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1274,7 +2110,7 @@ void handleSetBrightness() {
     }
 
     persistBrightnessToStorage();
-    mqttStateDirty = true;
+    markStateChanged();
     char json[BUFFER_SIZE_JSON_SMALL / 2];
     snprintf(json, sizeof(json), "{\"brightness\":%d}", brightness);
     server.send(200, "application/json", json);
@@ -1283,8 +2119,22 @@ void handleSetBrightness() {
   }
 }
 
+// Sicherstellen dass min < max (automatische Korrektur ungültiger Werte)
+void normalizeBrightnessRanges() {
+  if (minBrightness > maxBrightness) {
+    uint16_t temp = minBrightness;
+    minBrightness = maxBrightness;
+    maxBrightness = temp;
+  }
+  if (sensorMin > sensorMax) {
+    uint16_t temp = sensorMin;
+    sensorMin = sensorMax;
+    sensorMax = temp;
+  }
+}
+
 void handleSetAutoBrightness() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1306,20 +2156,9 @@ void handleSetAutoBrightness() {
     sensorMax = constrain(server.arg("sensorMax").toInt(), 0, PWM_MAX);
   }
 
-  // Sicherstellen dass min < max (automatische Korrektur ungültiger Werte)
-  if (minBrightness > maxBrightness) {
-    uint16_t temp = minBrightness;
-    minBrightness = maxBrightness;
-    maxBrightness = temp;
-  }
-  if (sensorMin > sensorMax) {
-    uint16_t temp = sensorMin;
-    sensorMin = sensorMax;
-    sensorMax = temp;
-  }
-
+  normalizeBrightnessRanges();
   persistBrightnessToStorage();
-  mqttStateDirty = true;
+  markStateChanged();
 
   // JSON-Response erstellen
     char json[BUFFER_SIZE_JSON_MEDIUM];
@@ -1329,7 +2168,7 @@ void handleSetAutoBrightness() {
 }
 
 void handleSetMqtt() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1382,25 +2221,49 @@ void handleSetMqtt() {
     }
     copyServerArgToBuffer(topicArg, mqttBaseTopic, sizeof(mqttBaseTopic));
   }
+  if (server.hasArg("deltaState")) {
+    String val = server.arg("deltaState");
+    bool delta = (val == "true" || val == "1");
+    if (delta != mqttDeltaState) {
+      mqttDeltaState = delta;
+      mqttStateSnapshot = true;  // Neues Format vollständig publishen
+      markStateChanged();
+    }
+  }
+  if (server.hasArg("discovery")) {
+    String val = server.arg("discovery");
+    bool discovery = (val == "true" || val == "1");
+    if (!discovery && mqttDiscovery) haDiscoveryRemove = true;
+    mqttDiscovery = discovery;
+  }
+  if (server.hasArg("minInterval")) {
+    long interval = server.arg("minInterval").toInt();
+    if (interval < 0 || interval > 60000) {
+      server.send(400, "application/json", "{\"error\":\"minInterval must be 0-60000 ms\"}");
+      return;
+    }
+    mqttMinIntervalMs = (uint16_t)interval;
+  }
 
   persistMqttToStorage();
 
   // MQTT neu konfigurieren wenn aktiviert
   if (mqttEnabled && strlen(mqttServer) > 0) {
+    resetMqttConnect();
     mqttClient.disconnect();
-    mqttClient.setServer(mqttServer, mqttPort);
     mqttClient.setCallback(mqttCallback);
     Serial.println("MQTT configuration updated, will reconnect...");
   }
 
     char json[BUFFER_SIZE_JSON_LARGE];
-  snprintf(json, sizeof(json), "{\"mqttEnabled\":%s,\"mqttServer\":\"%s\",\"mqttPort\":%d,\"mqttBaseTopic\":\"%s\"}",
-           mqttEnabled ? "true" : "false", mqttServer, mqttPort, mqttBaseTopic);
+  snprintf(json, sizeof(json), "{\"mqttEnabled\":%s,\"mqttServer\":\"%s\",\"mqttPort\":%d,\"mqttBaseTopic\":\"%s\",\"mqttDeltaState\":%s,\"mqttMinInterval\":%u,\"mqttDiscovery\":%s}",
+           mqttEnabled ? "true" : "false", mqttServer, mqttPort, mqttBaseTopic,
+           mqttDeltaState ? "true" : "false", mqttMinIntervalMs, mqttDiscovery ? "true" : "false");
   server.send(200, "application/json", json);
 }
 
 void handleResetRestartCount() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1414,7 +2277,7 @@ void handleResetRestartCount() {
 }
 
 void handleSetDisplay() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1434,7 +2297,7 @@ void handleSetDisplay() {
       Serial.println("Display DISABLED via API");
     }
 
-    mqttStateDirty = true;
+    markStateChanged();
 
     char json[BUFFER_SIZE_JSON_SMALL];
     snprintf(json, sizeof(json), "{\"displayEnabled\":%s}",
@@ -1446,7 +2309,7 @@ void handleSetDisplay() {
 }
 
 void handleSetSensorData() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1471,7 +2334,7 @@ void handleSetSensorData() {
 }
 
 void handleSetSlideConfig() {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
@@ -1500,21 +2363,20 @@ bool applyEffect(uint8_t idx) {
     return false;
   }
   currentEffectIndex = idx;
-  currentEffect = effects[currentEffectIndex];
+  currentEffect = EFFECTS[currentEffectIndex].effect;
   currentEffect->init();
   yield();
   return true;
 }
 
 void selectEffect(uint8_t idx) {
-  if (!checkRateLimit()) {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
     server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
     return;
   }
   bool ok = applyEffect(idx);
-  if (ok) mqttStateDirty = true;
-  WiFiClient client = server.client();
-  if (!client || !client.connected()) {
+  if (ok) markStateChanged();
+  if (!server.clientConnected()) {
     Serial.printf("selectEffect(%u) called without active HTTP client (ok=%d)\n", idx, ok);
     return;
   }
@@ -1524,7 +2386,7 @@ void selectEffect(uint8_t idx) {
     return;
   }
   char json[128];
-  snprintf(json, sizeof(json), "{\"effect\":\"%s\"}", currentEffect->name);
+  snprintf(json, sizeof(json), "{\"effect\":\"%s\"}", EFFECTS[currentEffectIndex].name);
   server.send(200, "application/json", json);
 }
 
@@ -1532,6 +2394,92 @@ void nextEffect() {
   applyEffect((currentEffectIndex + 1) % effectCount);
   }
 
+// --- Batch-Änderungen (POST /api/batch, MQTT-JSON) ---
+// Prüfen und Vormerken siehe Batch.h; übernommen wird in loop() an der
+// nächsten Frame-Grenze (applyPendingBatch()).
+static_assert(Batch::STRING_POOL >= EEPROM_TZ_STRING_LEN + 32, "Batch-Stringpool zu klein für tz");
+Batch::Pending<CONFIG_SCHEMA_COUNT> pendingBatch = {};
+
+// Gibt nullptr oder einen Fehlertext zurück; errorField zeigt dann auf den
+// betroffenen Key
+const char* stageBatch(const char* json, size_t len, const char* source, const char*& errorField) {
+  return Batch::stage(CONFIG_SCHEMA, pendingBatch, json, len, source, errorField);
+}
+
+// Übernimmt den vorgemerkten Batch (aus loop() direkt vor dem Zeichnen des Frames)
+void applyPendingBatch() {
+  Batch::Pending<CONFIG_SCHEMA_COUNT>& b = pendingBatch;
+  if (!b.pending) return;
+  b.pending = false;
+
+  uint8_t groups = 0;
+  bool brightnessSet = false;
+  bool autoBrightnessSet = false;
+  bool tzSet = false;
+  for (uint8_t i = 0; i < CONFIG_SCHEMA_COUNT; i++) {
+    if (!b.staged[i].present) continue;
+    const Field& f = CONFIG_SCHEMA[i];
+    groups |= f.group;
+    if (f.ptr == &brightness) brightnessSet = true;
+    if (f.ptr == &autoBrightnessEnabled) autoBrightnessSet = true;
+    if (f.ptr == tzString) tzSet = true;
+  }
+  ConfigSchema::applyStaged(CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, b.staged);
+
+  // Manuelle Helligkeit schaltet Auto-Brightness ab (wie /api/setBrightness),
+  // außer der Batch setzt autoBrightness selbst
+  if (brightnessSet && !autoBrightnessSet && autoBrightnessEnabled) {
+    autoBrightnessEnabled = false;
+    Serial.println("Auto-Brightness disabled due to manual brightness change");
+  }
+  normalizeBrightnessRanges();
+  if (tzSet) setupTimezone();
+  if (b.effect >= 0) applyEffect((uint8_t)b.effect);
+  if (!isnan(b.temp)) g_sensorTemp = b.temp;
+  if (!isnan(b.humi)) g_sensorHumi = b.humi;
+  if (b.display >= 0) displayEnabled = b.display == 1;
+  if (b.display >= 0 || brightnessSet) {
+    if (!displayEnabled) {
+      analogWrite(PIN_ENABLE, PWM_MAX);
+    } else if (!autoBrightnessEnabled) {
+      analogWrite(PIN_ENABLE, PWM_MAX - brightness);
+    }
+  }
+
+  if (groups) persistConfigGroups(groups, b.source);
+  markStateChanged();
+  Serial.printf("[Batch] %u change(s) applied (%s)\n", b.count, b.source);
+}
+
+void handleBatch() {
+  if (!checkRateLimit(RateLimiter::WRITE)) {
+    server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
+    return;
+  }
+  if (!server.hasArg("plain")) {
+    server.send(400, "application/json", "{\"error\":\"Missing JSON data\"}");
+    return;
+  }
+  const String& body = server.arg("plain");
+  const char* errorField = nullptr;
+  const char* error = stageBatch(body.c_str(), body.length(), "batch", errorField);
+  char json[BUFFER_SIZE_JSON_SMALL];
+  JsonWriter w(json, sizeof(json));
+  w.beginObject();
+  if (error) {
+    w.addString("error", error);
+    if (errorField) w.addString("field", errorField);
+    w.endObject();
+    server.send(400, "application/json", json);
+    return;
+  }
+  // Übernahme folgt im selben Loop-Durchlauf vor dem nächsten Frame
+  w.addBool("ok", true);
+  w.addUInt("changes", pendingBatch.count);
+  w.endObject();
+  server.send(200, "application/json", json);
+}
+
 void startAnimation() {
   uint8_t frame[32];
   clearFrame(frame, sizeof(frame));
@@ -1574,23 +2522,90 @@ const char *wifiStatusToString(uint8_t status) {
   }
 }
 
-bool setupWiFi() {
-  WiFi.mode(WIFI_STA);
+// Startet den Verbindungsaufbau. Liegt eine gültige Konfiguration im RTC-Memory,
+// wird direkt mit Kanal/BSSID assoziiert (kein Scan) und die IP statisch gesetzt
+// (kein DHCP). Gibt true zurück, wenn der Cache benutzt wurde.
+bool beginWiFi() {
+  RtcState::WifiConfig cfg;
+  if (RtcState::read(RtcState::WIFI_SLOT, cfg) && cfg.channel >= 1 && cfg.channel <= 14) {
+    wifiStaticIpUsed = cfg.ip != 0 && cfg.fastConnects < WIFI_MAX_FAST_CONNECTS;
+    if (wifiStaticIpUsed) {
+      WiFi.config(IPAddress(cfg.ip), IPAddress(cfg.gateway), IPAddress(cfg.subnet), IPAddress(cfg.dns));
+    } else {
+      WiFi.config(0U, 0U, 0U); // DHCP
+    }
+    WiFi.begin(ssid, password, cfg.channel, cfg.bssid);
+    wifiFastConnectUsed = true;
+    return true;
+  }
+  wifiStaticIpUsed = false;
+  WiFi.config(0U, 0U, 0U);
   WiFi.begin(ssid, password);
+  wifiFastConnectUsed = false;
+  return false;
+}
 
-  Serial.print("Connecting to WiFi");
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
+// Merkt sich die aktuelle Verbindung für den nächsten Boot/Reconnect
+void saveWiFiToRtc() {
+  RtcState::WifiConfig prev;
+  uint8_t fastConnects = 0;
+  if (wifiStaticIpUsed && RtcState::read(RtcState::WIFI_SLOT, prev)) {
+    fastConnects = prev.fastConnects < 255 ? prev.fastConnects + 1 : 255;
+  }
+
+  RtcState::WifiConfig cfg;
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.ip = (uint32_t)WiFi.localIP();
+  cfg.gateway = (uint32_t)WiFi.gatewayIP();
+  cfg.subnet = (uint32_t)WiFi.subnetMask();
+  cfg.dns = (uint32_t)WiFi.dnsIP(0);
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid) {
+    memcpy(cfg.bssid, bssid, sizeof(cfg.bssid));
+  }
+  cfg.channel = WiFi.channel();
+  cfg.fastConnects = fastConnects;
+  RtcState::write(RtcState::WIFI_SLOT, cfg);
+}
+
+// Gecachte Konfiguration verwerfen — nächster Versuch macht einen vollen Scan
+void forgetWiFiRtc() {
+  RtcState::invalidate<RtcState::WifiConfig>(RtcState::WIFI_SLOT);
+  wifiFastConnectUsed = false;
+  wifiStaticIpUsed = false;
+}
+
+bool setupWiFi() {
+  WiFi.persistent(false); // Kanal/BSSID wechseln je nach Versuch — nicht jedes Mal ins Flash schreiben
+  WiFi.mode(WIFI_STA);
+  bool fast = beginWiFi();
+
+  Serial.print(fast ? "Connecting to WiFi (cached channel/BSSID)" : "Connecting to WiFi");
+  unsigned long startMs = millis();
+  unsigned long lastDotMs = startMs;
+  while (WiFi.status() != WL_CONNECTED && timeDiff(millis(), startMs) < WIFI_BOOT_CONNECT_TIMEOUT) {
+    if (fast && timeDiff(millis(), startMs) > WIFI_FAST_CONNECT_TIMEOUT) {
+      Serial.print(" cached config failed, scanning");
+      forgetWiFiRtc();
+      WiFi.disconnect();
+      beginWiFi();
+      fast = false;
+    }
+    if (timeDiff(millis(), lastDotMs) >= 500) {
+      Serial.print(".");
+      lastDotMs = millis();
+    }
+    delay(20);
     yield();
     ESP.wdtFeed();
   }
 
   wl_status_t status = WiFi.status();
   if (status == WL_CONNECTED) {
-    Serial.printf("\nConnected! IP: %s\n", WiFi.localIP().toString().c_str());
+    bootWifiConnectedMs = millis();
+    saveWiFiToRtc();
+    Serial.printf("\nConnected! IP: %s (%lums after boot, %s)\n", WiFi.localIP().toString().c_str(),
+                  bootWifiConnectedMs, wifiFastConnectUsed ? "fast" : "scan");
     Serial.printf("Free heap after WiFi: %d bytes\n", ESP.getFreeHeap());
     return true;
   }
@@ -1638,126 +2653,153 @@ void setupTimezone() {
   }
 }
 
-void setupNTP() {
-  // WICHTIG: configTime() speichert möglicherweise nur die Pointer, nicht die Strings
-  // Daher müssen wir sicherstellen, dass die Pointer während der gesamten Laufzeit gültig bleiben
-  // Lösung: Statische char-Arrays verwenden, die während der gesamten Laufzeit existieren
-  static char ntp1[64] = {0};
-  static char ntp2[64] = {0};
-  
-  // Validierung: Prüfe ob Strings gültig sind, sonst verwende Standard-Server
-  const char* server1;
-  const char* server2;
-  
-  // Prüfe ob Strings gültig sind (nicht leer und nicht nur Whitespace)
-  if (strlen(ntpServer1) > 0 && strlen(ntpServer1) < EEPROM_NTP_SERVER_LEN) {
-    server1 = ntpServer1;
+// Non-blocking NTP-Synchronisation als Zustandsautomat
+// startNtpSync() stößt den Sync an, pollNtpSync() wird in jedem loop() aufgerufen.
+// Ablauf: Server der Reihe nach probieren (je NTP_SERVER_TIMEOUT), danach alle
+// konfigurierten Server parallel an den SNTP-Client übergeben und bis
+// NTP_FALLBACK_TIMEOUT warten. Kein delay() — Rendering und Webserver laufen weiter.
+enum NtpSyncState : uint8_t {
+  NTP_SYNC_IDLE = 0,     // Kein Sync aktiv
+  NTP_SYNC_TRY_SERVER,   // Einzelner Server wird probiert
+  NTP_SYNC_FALLBACK,     // Alle Server gleichzeitig, warte auf erste Antwort
+  NTP_SYNC_DONE,         // Zeit erfolgreich gesetzt
+  NTP_SYNC_FAILED        // Timeout — SNTP-Client versucht es im Hintergrund weiter
+};
+
+const unsigned long NTP_SERVER_TIMEOUT = 2000;    // Pro Server
+const unsigned long NTP_FALLBACK_TIMEOUT = 10000; // Abschließendes Warten mit allen Servern
+const uint8_t NTP_SERVER_CANDIDATES = 4;
+
+NtpSyncState ntpSyncState = NTP_SYNC_IDLE;
+uint8_t ntpServerIndex = 0;
+unsigned long ntpStateStartMs = 0;
+volatile bool ntpTimeReceived = false; // Gesetzt vom settimeofday-Callback des SNTP-Clients
+
+// WICHTIG: configTime() speichert möglicherweise nur die Pointer, nicht die Strings.
+// Daher statische Kopien, die während der gesamten Laufzeit gültig bleiben.
+char ntpSyncServer1[64] = {0};
+char ntpSyncServer2[64] = {0};
+const char* ntpSyncCandidates[NTP_SERVER_CANDIDATES] = {ntpSyncServer1, ntpSyncServer2, "pool.ntp.org", "time.nist.gov"};
+
+bool ntpSyncInProgress() {
+  return ntpSyncState == NTP_SYNC_TRY_SERVER || ntpSyncState == NTP_SYNC_FALLBACK;
+}
+
+// Gibt UTC- und Lokalzeit nach erfolgreichem Sync aus
+void logNtpTime() {
+  time_t now = time(nullptr);
+  struct tm *utcPtr = gmtime(&now);
+  if (!utcPtr) return;
+  struct tm utc = *utcPtr; // Kopie: gmtime() und localtime() teilen sich einen statischen Buffer
+  struct tm *local = localtime(&now);
+  if (local) {
+    Serial.printf("[NTP] UTC time:   %04d-%02d-%02d %02d:%02d:%02d\n",
+                  utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday,
+                  utc.tm_hour, utc.tm_min, utc.tm_sec);
+    Serial.printf("[NTP] Local time: %04d-%02d-%02d %02d:%02d:%02d (TZ: %s, diff: %d hours)\n",
+                  local->tm_year + 1900, local->tm_mon + 1, local->tm_mday,
+                  local->tm_hour, local->tm_min, local->tm_sec, tzString,
+                  local->tm_hour - utc.tm_hour);
+
+    // Warnung wenn Zeitzone nicht angewendet wird
+    if (local->tm_hour == utc.tm_hour && local->tm_min == utc.tm_min) {
+      Serial.println("[WARNING] Zeitzone wird nicht angewendet! TZ-String möglicherweise fehlerhaft.");
+      Serial.printf("[WARNING] Erwartete Differenz: 1 Stunde (Winter) oder 2 Stunden (Sommer)\n");
+    }
+  }
+}
+
+// Übergibt den aktuellen Kandidaten an den SNTP-Client
+void ntpTryServer(uint8_t idx) {
+  TRACE_SCOPE("ntpTryServer");
+  ntpServerIndex = idx;
+  ntpStateStartMs = millis();
+  ntpTimeReceived = false;
+  Serial.printf("[NTP] Versuche Sync mit %s...\n", ntpSyncCandidates[idx]);
+  // ESP8266 Arduino-Core: configTime(tz, server) setzt TZ und NTP atomar
+  // und überlebt Sync-Zyklen — zuverlässiger als setenv+configTime getrennt.
+  configTime(tzString, ntpSyncCandidates[idx]);
+  setenv("TZ", tzString, 1);
+  tzset();
+}
+
+void ntpSyncFinished(bool success) {
+  if (success) {
+    ntpSyncState = NTP_SYNC_DONE;
+    // Zeitzone nach dem Sync erneut setzen (configTime() kann die TZ-Variable überschreiben)
+    setenv("TZ", tzString, 1);
+    tzset();
+    Serial.println("[NTP] Sync successful!");
+    logNtpTime();
   } else {
+    ntpSyncState = NTP_SYNC_FAILED;
+    Serial.println("[NTP] Sync failed, continuing anyway (SNTP retries in background)...");
+  }
+  debugLogJson("pollNtpSync", success ? "NTP sync done" : "NTP sync failed", "C",
+               "{\"server\":%u,\"freeHeap\":%d}", ntpServerIndex, ESP.getFreeHeap());
+}
+
+void startNtpSync() {
+  // Validierung: Prüfe ob Strings gültig sind, sonst verwende Standard-Server
+  const char* server1 = ntpServer1;
+  const char* server2 = ntpServer2;
+  if (strlen(ntpServer1) == 0 || strlen(ntpServer1) >= EEPROM_NTP_SERVER_LEN) {
     server1 = "pool.ntp.org";
     Serial.println("Warning: ntpServer1 invalid, using default");
   }
-  
-  if (strlen(ntpServer2) > 0 && strlen(ntpServer2) < EEPROM_NTP_SERVER_LEN) {
-    server2 = ntpServer2;
-  } else {
+  if (strlen(ntpServer2) == 0 || strlen(ntpServer2) >= EEPROM_NTP_SERVER_LEN) {
     server2 = "time.nist.gov";
     Serial.println("Warning: ntpServer2 invalid, using default");
   }
-  
-  // Arrays zuerst mit Null-Bytes füllen (Sicherheit)
-  memset(ntp1, 0, sizeof(ntp1));
-  memset(ntp2, 0, sizeof(ntp2));
-  
-  // Strings in statische Arrays kopieren (bleiben während der gesamten Laufzeit gültig)
-  strncpy(ntp1, server1, sizeof(ntp1) - 1);
-  ntp1[sizeof(ntp1) - 1] = '\0';
-  strncpy(ntp2, server2, sizeof(ntp2) - 1);
-  ntp2[sizeof(ntp2) - 1] = '\0';
-  
-  Serial.printf("NTP servers: '%s', '%s'\n", ntp1, ntp2);
-  Serial.printf("Original strings - ntpServer1 length=%zu, ntpServer2 length=%zu\n", strlen(ntpServer1), strlen(ntpServer2));
-  
-  // Versuche mehrere NTP-Server nacheinander
-  const char* ntpServers[] = {ntp1, ntp2, "pool.ntp.org", "time.nist.gov"};
-  bool syncSuccess = false;
-  
-  for (int i = 0; i < 4; i++) {
-    if (strlen(ntpServers[i]) > 0) {
-      Serial.printf("[NTP] Versuche Sync mit %s...\n", ntpServers[i]);
-      // ESP8266 Arduino-Core: configTime(tz, server) setzt TZ und NTP atomar
-      // und überlebt Sync-Zyklen — zuverlässiger als setenv+configTime getrennt.
-      configTime(tzString, ntpServers[i]);
-      setenv("TZ", tzString, 1);
-      tzset();
-      
-      // Warte kurz und prüfe ob Sync erfolgreich
-      delay(2000);
-      yield();
-      ESP.wdtFeed();
-      
-      time_t testTime = time(nullptr);
-      if (isTimeValid(testTime)) {
-        Serial.printf("[NTP] Sync erfolgreich mit %s\n", ntpServers[i]);
-        syncSuccess = true;
-        break;
-      } else {
-        Serial.printf("[NTP] Sync mit %s fehlgeschlagen\n", ntpServers[i]);
-      }
-    }
+  strncpy(ntpSyncServer1, server1, sizeof(ntpSyncServer1) - 1);
+  ntpSyncServer1[sizeof(ntpSyncServer1) - 1] = '\0';
+  strncpy(ntpSyncServer2, server2, sizeof(ntpSyncServer2) - 1);
+  ntpSyncServer2[sizeof(ntpSyncServer2) - 1] = '\0';
+
+  Serial.printf("NTP servers: '%s', '%s'\n", ntpSyncServer1, ntpSyncServer2);
+  ntpSyncState = NTP_SYNC_TRY_SERVER;
+  ntpTryServer(0);
+}
+
+void pollNtpSync() {
+  if (!ntpSyncInProgress()) {
+    return;
   }
-  
-  if (!syncSuccess) {
-    // Fallback: Verwende beide Server gleichzeitig (mit TZ-String)
-    configTime(tzString, ntp1, ntp2);
-    setenv("TZ", tzString, 1);
-    tzset();
+  if (WiFi.status() != WL_CONNECTED) {
+    // Abbruch — loop() startet nach dem Reconnect einen neuen Sync
+    ntpSyncState = NTP_SYNC_IDLE;
+    return;
   }
 
-  Serial.print("Waiting for NTP sync");
-  int attempts = 0;
-  while (time(nullptr) < 100000 && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    yield();
-    attempts++;
-    ESP.wdtFeed();
+  // Erfolg erst, wenn der SNTP-Client tatsächlich eine Zeit gesetzt hat — sonst würde
+  // ein Resync mit noch gültiger alter Zeit sofort als erfolgreich gelten.
+  // Jedes configTime() stößt eine neue SNTP-Anfrage an, der Callback kommt also zuverlässig.
+  if (ntpTimeReceived && isTimeValid(time(nullptr))) {
+    Serial.printf("[NTP] Sync erfolgreich mit %s\n",
+                  ntpSyncState == NTP_SYNC_TRY_SERVER ? ntpSyncCandidates[ntpServerIndex] : "fallback");
+    ntpSyncFinished(true);
+    return;
   }
 
-  if (time(nullptr) < 100000) {
-    Serial.println("\nNTP sync failed, continuing anyway...");
-  } else {
-    Serial.println("\nNTP sync successful!");
-    
-    // Zeitzone ERNEUT setzen nach NTP-Sync (wichtig!)
-    // configTime() kann die TZ-Variable überschreiben, daher setzen wir sie explizit erneut
-    // WICHTIG: Mehrfach setzen, da ESP8266 manchmal mehrere Versuche benötigt
-    for (int retry = 0; retry < 3; retry++) {
-      setenv("TZ", tzString, 1);
-      tzset();
-      delay(100); // Kurze Pause zwischen Versuchen
-      yield();
+  unsigned long elapsed = timeDiff(millis(), ntpStateStartMs);
+  if (ntpSyncState == NTP_SYNC_TRY_SERVER) {
+    if (elapsed < NTP_SERVER_TIMEOUT) {
+      return;
     }
-    
-    // Debug: UTC und lokale Zeit ausgeben
-    time_t now = time(nullptr);
-    delay(500); // Warte kurz, damit tzset() wirksam wird
-    struct tm *utc = gmtime(&now);
-    struct tm *local = localtime(&now);
-    if (utc && local) {
-      Serial.printf("[NTP] UTC time:   %04d-%02d-%02d %02d:%02d:%02d\n",
-                    utc->tm_year + 1900, utc->tm_mon + 1, utc->tm_mday,
-                    utc->tm_hour, utc->tm_min, utc->tm_sec);
-      Serial.printf("[NTP] Local time: %04d-%02d-%02d %02d:%02d:%02d (TZ: %s, diff: %d hours)\n",
-                    local->tm_year + 1900, local->tm_mon + 1, local->tm_mday,
-                    local->tm_hour, local->tm_min, local->tm_sec, tzString,
-                    local->tm_hour - utc->tm_hour);
-      
-      // Warnung wenn Zeitzone nicht angewendet wird
-      if (local->tm_hour == utc->tm_hour && local->tm_min == utc->tm_min) {
-        Serial.println("[WARNING] Zeitzone wird nicht angewendet! TZ-String möglicherweise fehlerhaft.");
-        Serial.printf("[WARNING] Erwartete Differenz: 1 Stunde (Winter) oder 2 Stunden (Sommer)\n");
-      }
+    Serial.printf("[NTP] Sync mit %s fehlgeschlagen\n", ntpSyncCandidates[ntpServerIndex]);
+    if (ntpServerIndex + 1 < NTP_SERVER_CANDIDATES) {
+      ntpTryServer(ntpServerIndex + 1);
+      return;
     }
+    // Fallback: Verwende beide Server gleichzeitig (mit TZ-String)
+    ntpSyncState = NTP_SYNC_FALLBACK;
+    ntpStateStartMs = millis();
+    configTime(tzString, ntpSyncServer1, ntpSyncServer2);
+    setenv("TZ", tzString, 1);
+    tzset();
+    Serial.println("[NTP] Waiting for NTP sync (fallback)...");
+  } else if (elapsed >= NTP_FALLBACK_TIMEOUT) {
+    ntpSyncFinished(false);
   }
 }
 
@@ -1783,50 +2825,13 @@ void checkNtpSync() {
   // Prüfe nur, ob die Zeit grundsätzlich plausibel ist (z.B. nach RTC-Verlust).
   if (currentTime < 100000) {
     Serial.println("[NTP_CHECK] Zeit ungültig, erzwinge erneutes Setup...");
-    ntpConfigured = false; // Triggert setupNTP() im nächsten loop()
-  }
-}
-
-// JSON-Parsing Helpers für handleRestore() — kein ArduinoJson nötig
-static int extractJsonInt(const String& json, const char* key, int defaultVal) {
-  String search = String("\"") + key + "\":";
-  int pos = json.indexOf(search);
-  if (pos < 0) return defaultVal;
-  int start = pos + search.length();
-  while (start < (int)json.length() && json[start] == ' ') start++;
-  int end = start;
-  if (end < (int)json.length() && json[end] == '-') end++;
-  while (end < (int)json.length() && isDigit(json[end])) end++;
-  if (end == start) return defaultVal;
-  return json.substring(start, end).toInt();
-}
-
-static bool extractJsonBool(const String& json, const char* key, bool defaultVal) {
-  String search = String("\"") + key + "\":";
-  int pos = json.indexOf(search);
-  if (pos < 0) return defaultVal;
-  int start = pos + search.length();
-  while (start < (int)json.length() && json[start] == ' ') start++;
-  if (json.substring(start, start + 4) == "true")  return true;
-  if (json.substring(start, start + 5) == "false") return false;
-  return defaultVal;
-}
-
-static bool extractJsonStr(const String& json, const char* key, char* buf, size_t bufSize) {
-  String search = String("\"") + key + "\":\"";
-  int pos = json.indexOf(search);
-  if (pos < 0) return false;
-  int start = pos + search.length();
-  int end = json.indexOf('"', start);
-  if (end < 0) return false;
-  int len = min((int)(end - start), (int)(bufSize - 1));
-  json.substring(start, start + len).toCharArray(buf, bufSize);
-  buf[bufSize - 1] = '\0';
-  return true;
+    ntpConfigured = false; // Triggert startNtpSync() im nächsten loop()
+  }
 }
 
 void setup() {
   Serial.begin(115200);
+  Perf::reset();
   Serial.printf("Starting up... Free heap: %d bytes\n", ESP.getFreeHeap());
   system_set_os_print(1); // Debug-Ausgaben aktivieren
 
@@ -1871,16 +2876,24 @@ void setup() {
   // Dies stellt sicher, dass lastOperation, lastUptimeBeforeRestart und lastHeapBeforeRestart
   // bereits geladen sind, wenn das Restart-Log geschrieben wird
   EEPROM.begin(EEPROM_SIZE);
-  loadBrightnessFromStorage();
+  bool configLogAvailable = mountConfigStore();
+  loadConfigFromStorage();
+  if (configLogAvailable && !ConfigLog::mounted) {
+    migrateToConfigLog();
+  }
+  loadRestartDiagFromRtc();
   
+  // SNTP meldet jede gesetzte Zeit — Grundlage für den non-blocking NTP-Sync
+  settimeofday_cb([]() { ntpTimeReceived = true; });
+
   // Zeitzone setzen (nach dem Laden aus EEPROM)
   setupTimezone();
   
-  // Uptime und Heap vor Restart wurden bereits in loadBrightnessFromStorage() geladen
-  // Diese Werte stammen vom letzten Lauf vor dem Restart
+  // Uptime, Heap und letzte Operation vor Restart wurden bereits in
+  // loadRestartDiagFromRtc() geladen (Werte vom letzten Lauf vor dem Restart)
   
   // Automatisches Restart-Logging (immer aktiv, unabhängig von DEBUG_LOGGING_ENABLED)
-  // WICHTIG: Wird NACH loadBrightnessFromStorage() aufgerufen, damit lastOperation etc. verfügbar sind
+  // WICHTIG: Wird NACH loadConfigFromStorage() aufgerufen, damit lastOperation etc. verfügbar sind
   if (spiffsOk) {
     logRestart();
     String resetReason = ESP.getResetReason();
@@ -1918,12 +2931,14 @@ void setup() {
 #endif // DEBUG_LOGGING_ENABLED
   
   // Restart-Counter erhöhen und aktuellen Reset-Grund speichern
-  // (wird bereits in loadBrightnessFromStorage() geladen, falls vorhanden)
+  // (wird bereits in loadConfigFromStorage() geladen, falls vorhanden)
   restartCount++;
   String resetReasonStr = ESP.getResetReason();
   strncpy(lastResetReason, resetReasonStr.c_str(), sizeof(lastResetReason) - 1);
   lastResetReason[sizeof(lastResetReason) - 1] = '\0';
   persistRestartInfo();
+  // Sofort committen: bei einer Crash-Schleife soll jeder Boot gezählt werden
+  flushEEPROM("boot");
   
   // Exception-Handler registrieren (falls ESP8266 unterstützt)
   // Dies hilft bei der Diagnose von Crashes
@@ -1943,8 +2958,8 @@ void setup() {
   ESP.wdtFeed(); // Watchdog nach WiFi-Setup füttern
   ntpConfigured = wifiConnected;
   if (wifiConnected) {
-    setupNTP();
-    ESP.wdtFeed(); // Watchdog nach NTP-Setup füttern
+    // NTP läuft asynchron weiter (pollNtpSync() in loop())
+    startNtpSync();
     
     // Dynamischer Hostname basierend auf Chip-ID (eindeutig pro Gerät)
     char hostname[BUFFER_SIZE_HOSTNAME];
@@ -1962,6 +2977,7 @@ void setup() {
         type = "filesystem";
       }
       Serial.println("Start updating " + type);
+      flushEEPROM("ota");
       // Display ausschalten während Update
       analogWrite(PIN_ENABLE, PWM_MAX);
     });
@@ -2018,6 +3034,7 @@ void setup() {
 
   server.on("/", handleRoot);
   server.on("/api/status", handleStatus);
+  server.on("/api/events", handleEvents);
   server.on("/api/setTimezone", handleSetTimezone);
   server.on("/api/setClockFormat", handleSetClockFormat);
   server.on("/api/setBrightness", handleSetBrightness);
@@ -2027,20 +3044,28 @@ void setup() {
   server.on("/api/setSensorData",  handleSetSensorData);
   server.on("/api/setSlideConfig", handleSetSlideConfig);
   server.on("/api/resetRestartCount", handleResetRestartCount);
-  server.on("/effect/snake", []() { selectEffect(0); });
-  server.on("/effect/clock", []() { selectEffect(1); });
-  server.on("/effect/rain", []() { selectEffect(2); });
-  server.on("/effect/bounce", []() { selectEffect(3); });
-  server.on("/effect/stars", []() { selectEffect(4); });
-  server.on("/effect/lines", []() { selectEffect(5); });
-  server.on("/effect/pulse", []() { selectEffect(6); });
-  server.on("/effect/waves", []() { selectEffect(7); });
-  server.on("/effect/spiral", []() { selectEffect(8); });
-  server.on("/effect/fire", []() { selectEffect(9); });
-  server.on("/effect/plasma", []() { selectEffect(10); });
-  server.on("/effect/ripple", []() { selectEffect(11); });
-  server.on("/effect/sandclock",    []() { selectEffect(12); });
-  server.on("/effect/sensorclock", []() { selectEffect(13); });
+  server.on("/api/batch", HTTP_POST, handleBatch);
+  server.on("/api/perf", handlePerf);
+  server.on("/metrics", handleMetrics);
+#ifdef TRACE_ENABLED
+  // Trace-Export im Chrome Trace Format (chrome://tracing / ui.perfetto.dev)
+  server.on("/api/trace", []() {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Content-Disposition", "attachment; filename=\"ikeaclock-trace.json\"");
+    server.send(200, "application/json", "");
+    Trace::exportChromeJson([](const char* chunk) { server.sendContent(chunk); });
+    server.sendContent(""); // Chunked-Ende
+    if (server.hasArg("clear") && server.arg("clear") == "1") {
+      Trace::clear();
+    }
+  });
+#endif
+  // /effect/<name> — eine Route für alle Effekte der Registry
+  server.on("/effect/*", []() {
+    String name = server.pathArg();
+    int8_t idx = findEffectIndexByName(name.c_str());
+    selectEffect(idx < 0 ? effectCount : (uint8_t)idx);
+  });
   server.on("/api/debuglog", []() {
     if (!SPIFFS.exists("/")) {
       server.send(503, "text/plain", "SPIFFS not available");
@@ -2048,8 +3073,7 @@ void setup() {
     }
     File logFile = SPIFFS.open("/debug.log", "r");
     if (logFile) {
-      server.streamFile(logFile, "application/x-ndjson");
-      logFile.close();
+      server.streamFile(logFile, "application/x-ndjson");  // Server schließt die Datei nach dem Senden
     } else {
       server.send(404, "text/plain", "Debug log not found");
     }
@@ -2057,38 +3081,29 @@ void setup() {
   
   // Backup-Endpoint: Export aller Konfiguration als JSON
   server.on("/api/backup", []() {
-    if (!checkRateLimit()) {
+    if (!checkRateLimit(RateLimiter::READ)) {
       server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
       return;
     }
     
-    // Erstelle JSON mit allen Konfigurationsdaten
-    char json[BUFFER_SIZE_JSON_BACKUP];
-    time_t now = time(nullptr);
-    snprintf(json, sizeof(json),
-      "{\"version\":%d,\"timestamp\":%lu,\"checksum\":%d,"
-      "\"config\":{"
-      "\"brightness\":%d,\"autoBrightness\":%s,"
-      "\"minBrightness\":%d,\"maxBrightness\":%d,"
-      "\"sensorMin\":%d,\"sensorMax\":%d,"
-      "\"mqttEnabled\":%s,\"mqttServer\":\"%s\",\"mqttPort\":%d,"
-      "\"mqttUser\":\"%s\",\"mqttBaseTopic\":\"%s\","
-      "\"tz\":\"%s\",\"hourFormat\":\"%s\",\"use24HourFormat\":%s,\"ntpServer1\":\"%s\",\"ntpServer2\":\"%s\""
-      "}}",
-      EEPROM_VERSION, (unsigned long)now, calculateEEPROMChecksum(),
-      brightness, autoBrightnessEnabled ? "true" : "false",
-      minBrightness, maxBrightness,
-      sensorMin, sensorMax,
-      mqttEnabled ? "true" : "false", mqttServer, mqttPort,
-      mqttUser, mqttBaseTopic,
-      tzString, use24HourFormat ? "24h" : "12h", use24HourFormat ? "true" : "false", ntpServer1, ntpServer2);
-    
-    server.send(200, "application/json", json);
+    // Erstelle JSON mit allen Konfigurationsdaten (Felder mit FLAG_BACKUP aus CONFIG_SCHEMA)
+    char chunk[BUFFER_SIZE_JSON_CHUNK];
+    JsonWriter w = beginJsonStream(chunk, sizeof(chunk));
+    w.beginObject();
+    w.addUInt("version", EEPROM_VERSION);
+    w.addUInt("timestamp", (unsigned long)time(nullptr));
+    w.addUInt("checksum", configChecksum());
+    w.beginObject("config");
+    ConfigSchema::serialize(w, CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, FLAG_BACKUP);
+    w.addString("hourFormat", use24HourFormat ? "24h" : "12h");
+    w.endObject();
+    w.endObject();
+    endJsonStream(w);
   });
   
   // Restore-Endpoint: Import Konfiguration aus JSON
   server.on("/api/restore", HTTP_POST, []() {
-    if (!checkRateLimit()) {
+    if (!checkRateLimit(RateLimiter::WRITE)) {
       server.send(429, "application/json", "{\"error\":\"Too many requests\"}");
       return;
     }
@@ -2098,108 +3113,43 @@ void setup() {
       return;
     }
     
-    String jsonData = server.arg("plain");
-    
-    // Einfaches JSON-Parsing (ohne Bibliothek)
-    // Suche nach Version
-    int versionPos = jsonData.indexOf("\"version\":");
-    if (versionPos < 0) {
-      server.send(400, "application/json", "{\"error\":\"Invalid backup format: missing version\"}");
-      return;
-    }
-    
-    // Extrahiere Version
-    int versionStart = jsonData.indexOf(":", versionPos) + 1;
-    int versionEnd = jsonData.indexOf(",", versionStart);
-    if (versionEnd < 0) versionEnd = jsonData.indexOf("}", versionStart);
-    int version = jsonData.substring(versionStart, versionEnd).toInt();
-    
-    if (version != EEPROM_VERSION) {
-      server.send(400, "application/json", "{\"error\":\"Backup version mismatch\"}");
-      return;
-    }
-    
-    // Extrahiere config-Objekt (vereinfacht)
-    int configStart = jsonData.indexOf("\"config\":{");
-    if (configStart < 0) {
-      server.send(400, "application/json", "{\"error\":\"Invalid backup format: missing config\"}");
-      return;
-    }
-    
-    // 1. Felder extrahieren
-    int  newBrightness     = extractJsonInt (jsonData, "brightness",      brightness);
-    bool newAutoBrightness = extractJsonBool(jsonData, "autoBrightness",  autoBrightnessEnabled);
-    int  newMinBrightness  = extractJsonInt (jsonData, "minBrightness",   minBrightness);
-    int  newMaxBrightness  = extractJsonInt (jsonData, "maxBrightness",   maxBrightness);
-    int  newSensorMin      = extractJsonInt (jsonData, "sensorMin",       sensorMin);
-    int  newSensorMax      = extractJsonInt (jsonData, "sensorMax",       sensorMax);
-    bool newMqttEnabled    = extractJsonBool(jsonData, "mqttEnabled",     mqttEnabled);
-    bool newUse24h         = extractJsonBool(jsonData, "use24HourFormat", use24HourFormat);
-    int  newMqttPort       = extractJsonInt (jsonData, "mqttPort",        mqttPort);
-
-    char newMqttServer[INPUT_MQTT_SERVER_MAX] = "";
-    char newMqttUser  [INPUT_MQTT_USER_MAX]   = "";
-    char newMqttTopic [INPUT_MQTT_TOPIC_MAX]  = "";
-    char newTz        [INPUT_TZ_MAX]          = "";
-    char newNtp1      [INPUT_NTP_SERVER_MAX]  = "";
-    char newNtp2      [INPUT_NTP_SERVER_MAX]  = "";
-    bool mqttServerFound = extractJsonStr(jsonData, "mqttServer",    newMqttServer, sizeof(newMqttServer));
-    bool mqttUserFound   = extractJsonStr(jsonData, "mqttUser",      newMqttUser,   sizeof(newMqttUser));
-    extractJsonStr(jsonData, "mqttBaseTopic", newMqttTopic,  sizeof(newMqttTopic));
-    extractJsonStr(jsonData, "tz",            newTz,         sizeof(newTz));
-    extractJsonStr(jsonData, "ntpServer1",    newNtp1,       sizeof(newNtp1));
-    extractJsonStr(jsonData, "ntpServer2",    newNtp2,       sizeof(newNtp2));
-
-    // 2. Validieren
-    newBrightness    = constrain(newBrightness,    0, (int)PWM_MAX);
-    newMinBrightness = constrain(newMinBrightness, 0, (int)PWM_MAX);
-    newMaxBrightness = constrain(newMaxBrightness, 0, (int)PWM_MAX);
-    newSensorMin     = constrain(newSensorMin,     0, (int)PWM_MAX);
-    newSensorMax     = constrain(newSensorMax,     0, (int)PWM_MAX);
-    newMqttPort      = (newMqttPort > 0 && newMqttPort <= 65535) ? newMqttPort : (int)MQTT_PORT_DEFAULT;
-
-    if (strlen(newMqttTopic) > 0 && !isValidMqttBaseTopic(newMqttTopic)) {
-      server.send(400, "application/json", "{\"error\":\"Invalid MQTT topic in backup\"}");
-      return;
-    }
-    if (strlen(newTz) > 0 && !isValidTzString(newTz)) {
-      server.send(400, "application/json", "{\"error\":\"Invalid TZ string in backup\"}");
+    // 1. Ein Durchlauf über das JSON, alle Felder laut Schema prüfen
+    const String& jsonData = server.arg("plain");
+    ConfigSchema::Staged staged[CONFIG_SCHEMA_COUNT];
+    ConfigSchema::RestoreResult result = ConfigSchema::parseRestore(
+      jsonData.c_str(), jsonData.length(), CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, staged);
+    if (result.ok && result.version != EEPROM_VERSION) {
+      result = {false, result.version, "Backup version mismatch", nullptr};
+    }
+    if (!result.ok) {
+      char json[BUFFER_SIZE_JSON_SMALL];
+      JsonWriter w(json, sizeof(json));
+      w.beginObject();
+      w.addString("error", result.error);
+      if (result.errorField) w.addString("field", result.errorField);
+      w.endObject();
+      server.send(400, "application/json", json);
       return;
     }
 
-    // 3. Globals setzen
-    brightness            = (uint16_t)newBrightness;
-    autoBrightnessEnabled = newAutoBrightness;
-    minBrightness         = (uint16_t)newMinBrightness;
-    maxBrightness         = (uint16_t)newMaxBrightness;
-    sensorMin             = (uint16_t)newSensorMin;
-    sensorMax             = (uint16_t)newSensorMax;
-    mqttEnabled           = newMqttEnabled;
-    use24HourFormat       = newUse24h;
-    mqttPort              = (uint16_t)newMqttPort;
-    if (mqttServerFound)          { strncpy(mqttServer,   newMqttServer, sizeof(mqttServer)   - 1); mqttServer  [sizeof(mqttServer)   - 1] = '\0'; }
-    if (mqttUserFound)            { strncpy(mqttUser,     newMqttUser,   sizeof(mqttUser)     - 1); mqttUser    [sizeof(mqttUser)     - 1] = '\0'; }
-    if (strlen(newMqttTopic)  > 0) { strncpy(mqttBaseTopic,newMqttTopic,  sizeof(mqttBaseTopic)- 1); mqttBaseTopic[sizeof(mqttBaseTopic)- 1] = '\0'; }
-    if (strlen(newTz)         > 0) { strncpy(tzString,     newTz,         sizeof(tzString)     - 1); tzString    [sizeof(tzString)     - 1] = '\0'; }
-    if (strlen(newNtp1) > 0 && strchr(newNtp1, '.') != nullptr) { strncpy(ntpServer1, newNtp1, sizeof(ntpServer1) - 1); ntpServer1[sizeof(ntpServer1) - 1] = '\0'; }
-    if (strlen(newNtp2) > 0 && strchr(newNtp2, '.') != nullptr) { strncpy(ntpServer2, newNtp2, sizeof(ntpServer2) - 1); ntpServer2[sizeof(ntpServer2) - 1] = '\0'; }
-
-    // 4. Persistieren
-    persistBrightnessToStorage();
-    persistMqttToStorage();
-    persistNtpToStorage();
+    // 2. Globals setzen (erst nach erfolgreicher Prüfung aller Felder)
+    ConfigSchema::applyStaged(CONFIG_SCHEMA, CONFIG_SCHEMA_COUNT, staged);
+
+    // 3. Persistieren
+    persistConfigGroups(GROUP_BRIGHTNESS | GROUP_MQTT | GROUP_NTP | GROUP_SLIDES, "restore");
+    flushEEPROM("restore");
 
-    // 5. Runtime anwenden
+    // 4. Runtime anwenden
     analogWrite(PIN_ENABLE, PWM_MAX - brightness);
     setupTimezone();
     ntpConfigured = false;
     if (mqttEnabled && strlen(mqttServer) > 0) {
+      resetMqttConnect();
       mqttClient.disconnect();
-      mqttClient.setServer(mqttServer, mqttPort);
       mqttClient.setCallback(mqttCallback);
     }
 
-    // 6. Antworten und neu starten
+    // 5. Antworten und neu starten
     server.send(200, "application/json",
       "{\"status\":\"ok\",\"message\":\"Settings restored, rebooting...\"}");
     delay(500);
@@ -2213,8 +3163,9 @@ void setup() {
   }
 
   // MQTT initialisieren falls konfiguriert
+  setupMqttProbeClient();
+  mqttClient.setBufferSize(MQTT_BUFFER_SIZE);
   if (mqttEnabled && strlen(mqttServer) > 0) {
-    mqttClient.setServer(mqttServer, mqttPort);
     mqttClient.setCallback(mqttCallback);
     Serial.printf("MQTT enabled, server: %s:%d, baseTopic: %s\n",
                   mqttServer, mqttPort, mqttBaseTopic);
@@ -2223,6 +3174,7 @@ void setup() {
   }
 
   LocalSensor::begin();
+  LightSensor::begin(LIGHT_SENSOR_PIN);
   applyEffect(currentEffectIndex);
 }
 
@@ -2235,6 +3187,9 @@ void loop() {
   static unsigned long lastMqttReconnect = 0;
   static unsigned long lastWatchdogFeed = 0;
   static unsigned long loopCount = 0;
+  uint32_t loopStartUs = micros();
+  TRACE_SCOPE("loop");
+  Metrics::loopIterations++;
   
 #ifdef DEBUG_LOGGING_ENABLED
   static unsigned long lastLoopStart = 0;
@@ -2293,24 +3248,45 @@ void loop() {
   }
 #endif
 
-  server.handleClient();
+  {
+    PERF_SCOPE(PERF_HTTP);
+    TRACE_SCOPE("handleClient");
+    server.handleClient();
+    sseLoop();
+  }
   yield();
-  LocalSensor::update();
+  {
+    PERF_SCOPE(PERF_SENSOR);
+    LocalSensor::update();
+  }
 
   // ArduinoOTA Handler (muss regelmäßig aufgerufen werden)
   if (WiFi.status() == WL_CONNECTED) {
-    ArduinoOTA.handle();
+    {
+      PERF_SCOPE(PERF_OTA);
+      ArduinoOTA.handle();
+    }
     // mDNS Handler (muss regelmäßig aufgerufen werden)
+    PERF_SCOPE(PERF_MDNS);
     MDNS.update();
   }
   yield();
 
   // MQTT Loop (muss regelmäßig aufgerufen werden)
   if (mqttEnabled) {
+    PERF_SCOPE(PERF_MQTT);
     mqttClient.loop();
-    if (mqttStateDirty && mqttClient.connected()) {
+    if (mqttStatePublishDue()) {
       publishMqttState();
     }
+    if (mqttClient.connected()) {
+      handleHaDiscovery();
+      updateMqttAmbientLight(false);
+      if (timeDiff(millis(), lastMqttQueueProcessMs) >= MQTT_QUEUE_INTERVAL_MS) {
+        lastMqttQueueProcessMs = millis();
+        MqttQueue::process(sendQueuedMqtt);
+      }
+    }
   }
 
   {
@@ -2325,8 +3301,21 @@ void loop() {
         if (wifiStatus == WL_CONNECTED) {
           wifiReconnecting = false;
           wifiReconnectBackoff = 5000;
-          Serial.printf("[WiFi] Reconnected! IP: %s\n", WiFi.localIP().toString().c_str());
+          Metrics::wifiReconnects++;
+          Serial.printf("[WiFi] Reconnected! IP: %s (%s)\n", WiFi.localIP().toString().c_str(),
+                        wifiFastConnectUsed ? "fast" : "scan");
+          saveWiFiToRtc();
+          if (bootWifiConnectedMs == 0) {
+            bootWifiConnectedMs = millis();
+          }
           ntpConfigured = false;
+        } else if (wifiFastConnectUsed && timeDiff(millis(), wifiReconnectStartMs) > WIFI_FAST_CONNECT_TIMEOUT) {
+          // Gecachter Kanal/BSSID passt nicht mehr (AP gewechselt?) — sofort voller Scan
+          Serial.println("[WiFi] Cached channel/BSSID failed, scanning...");
+          forgetWiFiRtc();
+          WiFi.disconnect();
+          beginWiFi();
+          wifiReconnectStartMs = millis();
         } else if (timeDiff(millis(), wifiReconnectStartMs) > WIFI_RECONNECT_VERIFY_TIMEOUT) {
           wifiReconnecting = false;
           wifiReconnectBackoff = min(wifiReconnectBackoff * 2UL, WIFI_RECONNECT_MAX_BACKOFF);
@@ -2335,12 +3324,11 @@ void loop() {
         }
       } else if (wifiStatus != WL_CONNECTED) {
         Serial.println("[WiFi] Connection lost, starting reconnect...");
-        strncpy(lastOperation, "WiFi.begin", sizeof(lastOperation) - 1);
-        lastOperation[sizeof(lastOperation) - 1] = '\0';
+        setLastOperation("WiFi.begin");
         serverStarted = false;
         ntpConfigured = false;
         ESP.wdtFeed();
-        WiFi.begin(ssid, password);
+        beginWiFi();
         wifiReconnecting = true;
         wifiReconnectStartMs = millis();
       }
@@ -2356,26 +3344,13 @@ void loop() {
   }
 
   if (!ntpConfigured && WiFi.status() == WL_CONNECTED) {
-    // Kritische Operation: NTP-Setup
-    strncpy(lastOperation, "setupNTP", sizeof(lastOperation) - 1);
-    lastOperation[sizeof(lastOperation) - 1] = '\0';
-    debugLogJson("loop", "NTP setup start", "C", "{\"freeHeap\":%d}", ESP.getFreeHeap());
-    
-#ifdef DEBUG_LOGGING_ENABLED
-    unsigned long ntpStart = millis();
-    int freeHeapBefore = ESP.getFreeHeap();
-    int maxFreeBlockBefore = ESP.getMaxFreeBlockSize();
-#endif
-    setupNTP();
-#ifdef DEBUG_LOGGING_ENABLED
-    unsigned long ntpDuration = millis() - ntpStart;
-    int freeHeapAfter = ESP.getFreeHeap();
-    int maxFreeBlockAfter = ESP.getMaxFreeBlockSize();
-    debugLogJson("loop", "NTP setup end", "C", "{\"duration\":%lu,\"freeHeapBefore\":%d,\"freeHeapAfter\":%d}", 
-                 ntpDuration, freeHeapBefore, freeHeapAfter);
-#endif
+    // Kritische Operation: NTP-Setup (läuft asynchron über pollNtpSync())
+    setLastOperation("setupNTP");
+    debugLogJson("loop", "NTP sync start", "C", "{\"freeHeap\":%d}", ESP.getFreeHeap());
+    startNtpSync();
     ntpConfigured = true;
   }
+  pollNtpSync();
 
   // Regelmäßiger NTP-Zeit-Check (alle 1 Stunde)
   static unsigned long lastNtpCheck = 0;
@@ -2394,28 +3369,26 @@ void loop() {
     lastFullNtpSync = millis();
   }
 
-  // Uptime und Heap-Status alle 30 Sekunden in EEPROM speichern (nur wenn sich signifikant ändert)
+  // EEPROM Write-Back: Commit erst nach Ruhezeit (siehe EepromWriteBack.h)
+  if (EepromWriteBack::commitDue()) {
+    flushEEPROM("write-back");
+  }
+
+  // Uptime und Heap-Status alle 10 Sekunden im RTC-Memory aktualisieren
+  // (kein Flash-Commit mehr — der Wert vor einem Crash ist damit höchstens 10 s alt)
   static unsigned long lastUptimeHeapSave = 0;
-  if (timeDiff(millis(), lastUptimeHeapSave) >= 30000) {
-    unsigned long currentUptime = millis();
-    uint32_t currentHeap = ESP.getFreeHeap();
-    
-    // Speichern wenn:
-    // 1. Beim ersten Mal (Werte noch 0) - immer speichern
-    // 2. Uptime sich signifikant geändert hat (mehr als 1 Minute)
-    // 3. Heap sich um mehr als 1KB geändert hat
-    if (lastUptimeBeforeRestart == 0 || 
-        abs((long)(currentUptime - lastUptimeBeforeRestart)) > 60000 || 
-        abs((long)(currentHeap - lastHeapBeforeRestart)) > 1024) {
-      persistUptimeHeapStatus();
-    }
+  if (timeDiff(millis(), lastUptimeHeapSave) >= 10000) {
+    persistUptimeHeapStatus();
     lastUptimeHeapSave = millis();
   }
 
   // MQTT Reconnection mit Exponential Backoff
   if (mqttEnabled && !mqttClient.connected() && WiFi.status() == WL_CONNECTED) {
-    if (timeDiff(millis(), lastMqttReconnect) >= mqttReconnectBackoff) {
-      reconnectMQTT();
+    if (mqttConnectState == MQTT_CONN_IDLE && timeDiff(millis(), lastMqttReconnect) >= mqttReconnectBackoff) {
+      startMqttConnect();
+      lastMqttReconnect = millis();
+    }
+    if (pollMqttConnect()) {
       lastMqttReconnect = millis();
     }
   }
@@ -2430,15 +3403,30 @@ void loop() {
   }
 
   // Frame nur zeichnen wenn Display aktiviert ist
-  if (timeDiff(millis(), lastFrameUpdate) > 50) {
+  unsigned long sinceFrame = timeDiff(millis(), lastFrameUpdate);
+  if (sinceFrame > 50 || MqttFrames::fresh) {
+    // Batch-Änderungen gesammelt an der Frame-Grenze übernehmen
+    applyPendingBatch();
+    // Jeder weitere volle 50-ms-Slot seit dem letzten Frame wurde verpasst
+    if (lastFrameUpdate != 0 && sinceFrame >= 100 && !MqttFrames::fresh) {
+      Metrics::framesSkipped += sinceFrame / 50 - 1;
+    }
     if (displayEnabled) {
 #ifdef DEBUG_LOGGING_ENABLED
       unsigned long frameStart = millis();
 #endif
       uint8_t frame[32];
       clearFrame(frame, sizeof(frame));
-      currentEffect->draw(frame);
-      shiftOutBuffer(frame, sizeof(frame));
+      {
+        PERF_SCOPE(PERF_DRAW);
+        TRACE_SCOPE("draw");
+        if (!MqttFrames::draw(frame)) currentEffect->draw(frame);
+      }
+      {
+        PERF_SCOPE(PERF_SHIFT);
+        shiftOutBuffer(frame, sizeof(frame));
+      }
+      Metrics::framesRendered++;
 #ifdef DEBUG_LOGGING_ENABLED
       unsigned long frameDuration = millis() - frameStart;
       if (frameDuration > 30) { // Nur loggen wenn langsam
@@ -2447,6 +3435,7 @@ void loop() {
 #endif
     }
     lastFrameUpdate = millis();
+    MqttFrames::fresh = false;
   }
 
   if (timeDiff(millis(), lastStatusPrint) > 60000) {
@@ -2472,15 +3461,10 @@ void loop() {
     lastStatusPrint = millis();
   }
 
-  // VERBESSERT: Auto-Brightness mit non-blocking Sampling
-  // Wird jetzt in jedem Loop-Durchlauf verarbeitet statt blockierend
-  if (autoBrightnessEnabled && displayEnabled) {
-    // processLightSensorSample() ist non-blocking und gibt false zurück solange sampling läuft
-    processLightSensorSample();
-  }
-
-  // Nur einen neuen Sample-Zyklus starten wenn der vorherige abgeschlossen ist
+  // Auto-Brightness: der Sensor wird per Ticker gesampelt (LightSensor.h),
+  // hier nur den gefilterten Wert auswerten
   if (timeDiff(millis(), lastBrightnessUpdate) > AUTO_BRIGHTNESS_UPDATE_INTERVAL) {
+    PERF_SCOPE(PERF_BRIGHTNESS);
     updateAutoBrightness();
     lastBrightnessUpdate = millis();
   }
@@ -2520,6 +3504,12 @@ void loop() {
           Serial.println("[SCHEDULED_RESTART] Zeit nicht synchronisiert, Restart übersprungen");
         }
         
+        // Kein NTP-Sync darf laufen
+        if (ntpSyncInProgress()) {
+          safeToRestart = false;
+          Serial.println("[SCHEDULED_RESTART] NTP-Sync läuft, Restart übersprungen");
+        }
+
         // Keine kritische Operation darf laufen
         if (strlen(lastOperation) > 0) {
           // Prüfe ob kritische Operation (EEPROM, NTP, etc.)
@@ -2535,8 +3525,9 @@ void loop() {
           Serial.printf("[SCHEDULED_RESTART] Bedingter Restart um 2:00 AM - Heap: %d bytes, Uptime: %lu Tage\n", 
                         freeHeap, uptimeDays);
           
-          // Uptime und Heap vor Restart speichern
+          // Uptime und Heap vor Restart speichern, ausstehende Konfiguration committen
           persistUptimeHeapStatus();
+          flushEEPROM("restart");
           
           // Kurze Verzögerung für Serial-Output
           delay(1000);
@@ -2549,6 +3540,8 @@ void loop() {
     lastScheduledRestartCheck = millis();
   }
 
+  Perf::record(PERF_LOOP, micros() - loopStartUs);
+
   yield();
   delay(1);
 }
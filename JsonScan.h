@@ -0,0 +1,220 @@
+// JsonScan.h — Einmaliger, allokationsfreier JSON-Scan (ohne ArduinoJson)
+//
+// forEach() läuft genau einmal über den Text und ruft für jedes Key/Value-Paar
+// in einem Objekt den Callback auf — auch in verschachtelten Objekten (depth
+// 1 = oberste Ebene). Werte werden nicht kopiert: Token zeigt in den Quelltext.
+// Strings zeigen auf den Inhalt zwischen den Anführungszeichen (Escapes noch
+// enthalten, siehe unescape()).
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef JSON_SCAN_H
+#define JSON_SCAN_H
+
+#include <Arduino.h>
+
+namespace JsonScan {
+
+  enum ValueType : uint8_t {
+    JSON_STRING,
+    JSON_NUMBER,
+    JSON_BOOL,
+    JSON_NULL,
+    JSON_OBJECT,   // value/valueLen umfassen das ganze Objekt inkl. Klammern
+    JSON_ARRAY
+  };
+
+  struct Token {
+    const char* key;
+    uint16_t keyLen;
+    const char* value;
+    uint16_t valueLen;
+    ValueType type;
+    uint8_t depth;
+  };
+
+  const uint8_t MAX_DEPTH = 8;
+
+  inline bool keyEquals(const Token& t, const char* key) {
+    return strlen(key) == t.keyLen && memcmp(t.key, key, t.keyLen) == 0;
+  }
+
+  inline bool toLong(const Token& t, long& out) {
+    if (t.type != JSON_NUMBER) return false;
+    char tmp[16];
+    uint16_t n = t.valueLen < sizeof(tmp) - 1 ? t.valueLen : sizeof(tmp) - 1;
+    memcpy(tmp, t.value, n);
+    tmp[n] = '\0';
+    char* end;
+    out = strtol(tmp, &end, 10);
+    return end != tmp;
+  }
+
+  inline bool toFloat(const Token& t, float& out) {
+    if (t.type != JSON_NUMBER) return false;
+    char tmp[24];
+    uint16_t n = t.valueLen < sizeof(tmp) - 1 ? t.valueLen : sizeof(tmp) - 1;
+    memcpy(tmp, t.value, n);
+    tmp[n] = '\0';
+    char* end;
+    out = strtof(tmp, &end);
+    return end != tmp;
+  }
+
+  inline bool toBool(const Token& t, bool& out) {
+    if (t.type != JSON_BOOL) return false;
+    out = t.value[0] == 't';
+    return true;
+  }
+
+  // Kopiert einen String-Wert ohne Escapes nach dst (immer null-terminiert).
+  // \uXXXX außerhalb von ASCII wird zu '?'. Gibt false zurück, wenn dst zu klein ist.
+  inline bool unescape(const char* src, uint16_t len, char* dst, size_t dstSize) {
+    size_t o = 0;
+    for (uint16_t i = 0; i < len; i++) {
+      char c = src[i];
+      if (c == '\\' && i + 1 < len) {
+        char e = src[++i];
+        switch (e) {
+          case 'n': c = '\n'; break;
+          case 'r': c = '\r'; break;
+          case 't': c = '\t'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'u': {
+            unsigned v = 0;
+            for (uint8_t k = 0; k < 4 && i + 1 < len; k++) {
+              char h = src[++i];
+              v = (v << 4) | (isDigit(h) ? h - '0' : ((h | 0x20) - 'a' + 10));
+            }
+            c = v < 0x80 ? (char)v : '?';
+            break;
+          }
+          default: c = e;  // \" \\ \/
+        }
+      }
+      if (o + 1 >= dstSize) {
+        dst[o] = '\0';
+        return false;
+      }
+      dst[o++] = c;
+    }
+    dst[o] = '\0';
+    return true;
+  }
+
+  namespace detail {
+    inline const char* skipWs(const char* p, const char* end) {
+      while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+      return p;
+    }
+
+    // p zeigt auf '"' — gibt Zeiger hinter das schließende '"' zurück (nullptr bei Fehler)
+    inline const char* skipString(const char* p, const char* end) {
+      for (p++; p < end; p++) {
+        if (*p == '\\') { p++; continue; }
+        if (*p == '"') return p + 1;
+      }
+      return nullptr;
+    }
+
+    template <typename Callback>
+    const char* parseValue(const char* p, const char* end, uint8_t depth, Token* parent, Callback& cb);
+
+    template <typename Callback>
+    const char* parseObject(const char* p, const char* end, uint8_t depth, Callback& cb) {
+      p = skipWs(p + 1, end);
+      if (p < end && *p == '}') return p + 1;
+      while (p < end) {
+        if (*p != '"') return nullptr;
+        const char* keyEnd = skipString(p, end);
+        if (!keyEnd) return nullptr;
+        Token t;
+        t.key = p + 1;
+        t.keyLen = keyEnd - p - 2;
+        t.depth = depth;
+        p = skipWs(keyEnd, end);
+        if (p >= end || *p != ':') return nullptr;
+        p = parseValue(skipWs(p + 1, end), end, depth, &t, cb);
+        if (!p) return nullptr;
+        p = skipWs(p, end);
+        if (p < end && *p == ',') { p = skipWs(p + 1, end); continue; }
+        if (p < end && *p == '}') return p + 1;
+        return nullptr;
+      }
+      return nullptr;
+    }
+
+    template <typename Callback>
+    const char* parseArray(const char* p, const char* end, uint8_t depth, Callback& cb) {
+      p = skipWs(p + 1, end);
+      if (p < end && *p == ']') return p + 1;
+      while (p < end) {
+        p = parseValue(p, end, depth, nullptr, cb);
+        if (!p) return nullptr;
+        p = skipWs(p, end);
+        if (p < end && *p == ',') { p = skipWs(p + 1, end); continue; }
+        if (p < end && *p == ']') return p + 1;
+        return nullptr;
+      }
+      return nullptr;
+    }
+
+    // parent != nullptr: Wert gehört zu einem Key → nach dem Parsen Callback
+    template <typename Callback>
+    const char* parseValue(const char* p, const char* end, uint8_t depth, Token* parent, Callback& cb) {
+      if (p >= end) return nullptr;
+      const char* start = p;
+      ValueType type;
+      if (*p == '{' || *p == '[') {
+        if (depth >= MAX_DEPTH) return nullptr;
+        type = *p == '{' ? JSON_OBJECT : JSON_ARRAY;
+        p = type == JSON_OBJECT ? parseObject(p, end, depth + 1, cb) : parseArray(p, end, depth + 1, cb);
+      } else if (*p == '"') {
+        type = JSON_STRING;
+        p = skipString(p, end);
+      } else if (end - p >= 4 && memcmp(p, "true", 4) == 0) {
+        type = JSON_BOOL;
+        p += 4;
+      } else if (end - p >= 5 && memcmp(p, "false", 5) == 0) {
+        type = JSON_BOOL;
+        p += 5;
+      } else if (end - p >= 4 && memcmp(p, "null", 4) == 0) {
+        type = JSON_NULL;
+        p += 4;
+      } else if (*p == '-' || isDigit(*p)) {
+        type = JSON_NUMBER;
+        p++;
+        while (p < end && (isDigit(*p) || *p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-')) p++;
+      } else {
+        return nullptr;
+      }
+      if (!p) return nullptr;
+      if (parent) {
+        parent->type = type;
+        if (type == JSON_STRING) {
+          parent->value = start + 1;
+          parent->valueLen = p - start - 2;
+        } else {
+          parent->value = start;
+          parent->valueLen = p - start;
+        }
+        cb(*parent);
+      }
+      return p;
+    }
+  }  // namespace detail
+
+  // Scannt ein JSON-Dokument (Objekt oder Array auf oberster Ebene).
+  // Gibt false bei Syntaxfehlern zurück (bis dahin gemeldete Tokens bleiben gültig).
+  template <typename Callback>
+  bool forEach(const char* json, size_t len, Callback cb) {
+    const char* end = json + len;
+    const char* p = detail::skipWs(json, end);
+    if (p >= end || (*p != '{' && *p != '[')) return false;
+    p = detail::parseValue(p, end, 0, nullptr, cb);
+    return p != nullptr && detail::skipWs(p, end) == end;
+  }
+
+}  // namespace JsonScan
+
+#endif  // JSON_SCAN_H
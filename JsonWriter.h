@@ -0,0 +1,185 @@
+// JsonWriter.h — Kleiner JSON-Serializer ohne Heap (ersetzt große snprintf-Formatstrings)
+//
+// Schreibt in einen festen Puffer. Strings werden korrekt escaped, NaN wird zu null.
+// Ohne Sink: läuft der Puffer über, wird weiteres Schreiben ignoriert und ok()
+// liefert false. Mit Sink (Streaming): ein voller Puffer wird an den Sink
+// übergeben (z.B. HTTP-Chunk) und wiederverwendet — die Ausgabegröße ist damit
+// unbegrenzt, der RAM-Bedarf bleibt bei der Puffergröße. Am Ende flush() aufrufen.
+//
+// Verwendung:
+//   char buf[256];
+//   JsonWriter w(buf, sizeof(buf));
+//   w.beginObject();
+//   w.addString("effect", currentEffect->name);
+//   w.addInt("brightness", brightness);
+//   w.endObject();
+//   if (w.ok()) server.send(200, "application/json", w.c_str());
+//
+// Streaming:
+//   JsonWriter w(buf, sizeof(buf), [](const char* data, size_t len) { server.sendContent(data, len); });
+//   ...
+//   w.flush();
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+class JsonWriter {
+ public:
+  typedef void (*Sink)(const char* data, size_t len);
+
+  JsonWriter(char* buf, size_t capacity, Sink sink = nullptr)
+    : _buf(buf), _cap(capacity), _len(0), _depth(0), _needComma(0), _overflow(false), _sink(sink) {
+    if (_cap > 0) _buf[0] = '\0';
+  }
+
+  // Streaming: gepufferte Ausgabe an den Sink übergeben
+  void flush() {
+    if (!_sink || _len == 0) return;
+    _sink(_buf, _len);
+    _len = 0;
+    _buf[0] = '\0';
+  }
+
+  bool ok() const { return !_overflow; }
+  size_t length() const { return _len; }
+  const char* c_str() const { return _buf; }
+
+  // key = nullptr für Array-Elemente
+  void beginObject(const char* key = nullptr) { open(key, '{'); }
+  void endObject() { close('}'); }
+  void beginArray(const char* key = nullptr) { open(key, '['); }
+  void endArray() { close(']'); }
+
+  void addString(const char* key, const char* value) {
+    prefix(key);
+    writeQuoted(value ? value : "");
+  }
+
+  void addBool(const char* key, bool value) {
+    prefix(key);
+    write(value ? "true" : "false");
+  }
+
+  void addInt(const char* key, long value) {
+    char tmp[12];
+    snprintf(tmp, sizeof(tmp), "%ld", value);
+    prefix(key);
+    write(tmp);
+  }
+
+  void addUInt(const char* key, unsigned long value) {
+    char tmp[12];
+    snprintf(tmp, sizeof(tmp), "%lu", value);
+    prefix(key);
+    write(tmp);
+  }
+
+  // NaN/Inf → null
+  void addFloat(const char* key, float value, uint8_t decimals = 1) {
+    prefix(key);
+    if (isnan(value) || isinf(value)) {
+      write("null");
+      return;
+    }
+    char tmp[20];
+    snprintf(tmp, sizeof(tmp), "%.*f", decimals, value);
+    write(tmp);
+  }
+
+  void addNull(const char* key) {
+    prefix(key);
+    write("null");
+  }
+
+  // Bereits gültiges JSON (z.B. vorgefertigte Arrays) unverändert einfügen
+  void addRaw(const char* key, const char* json) {
+    prefix(key);
+    write(json);
+  }
+
+ private:
+  char* _buf;
+  size_t _cap;
+  size_t _len;
+  uint8_t _depth;
+  uint32_t _needComma;   // Bit pro Verschachtelungsebene
+  bool _overflow;
+  Sink _sink;
+
+  void write(const char* s, size_t n) {
+    if (_overflow) return;
+    if (_len + n >= _cap) {
+      if (!_sink) {
+        _overflow = true;
+        return;
+      }
+      flush();
+      if (n >= _cap) {
+        _sink(s, n);  // Größer als der Puffer: direkt durchreichen
+        return;
+      }
+    }
+    memcpy(_buf + _len, s, n);
+    _len += n;
+    _buf[_len] = '\0';
+  }
+
+  void write(const char* s) { write(s, strlen(s)); }
+
+  void writeChar(char c) { write(&c, 1); }
+
+  void writeQuoted(const char* s) {
+    writeChar('"');
+    const char* run = s;
+    for (const char* p = s; *p; p++) {
+      unsigned char c = (unsigned char)*p;
+      if (c != '"' && c != '\\' && c >= 0x20) continue;
+      write(run, p - run);
+      run = p + 1;
+      switch (c) {
+        case '"':  write("\\\""); break;
+        case '\\': write("\\\\"); break;
+        case '\n': write("\\n"); break;
+        case '\r': write("\\r"); break;
+        case '\t': write("\\t"); break;
+        default: {
+          char esc[7];
+          snprintf(esc, sizeof(esc), "\\u%04x", c);
+          write(esc);
+        }
+      }
+    }
+    write(run, strlen(run));
+    writeChar('"');
+  }
+
+  void prefix(const char* key) {
+    uint32_t bit = 1UL << _depth;
+    if (_needComma & bit) writeChar(',');
+    _needComma |= bit;
+    if (key) {
+      writeQuoted(key);
+      writeChar(':');
+    }
+  }
+
+  void open(const char* key, char bracket) {
+    if (_depth > 0 || key) {
+      prefix(key);
+    }
+    writeChar(bracket);
+    if (_depth < 31) _depth++;
+    _needComma &= ~(1UL << _depth);
+  }
+
+  void close(char bracket) {
+    _needComma &= ~(1UL << _depth);
+    if (_depth > 0) _depth--;
+    writeChar(bracket);
+  }
+};
+
+#endif  // JSON_WRITER_H
@@ -0,0 +1,94 @@
+// LightSensor.h — Timer-gesteuertes Lichtsensor-Sampling mit Median-Filter
+//
+// Ein Ticker liest den ADC im festen Takt (INTERVAL_MS) in einen kleinen Ring.
+// Nach jedem Sample wird der Median über die letzten WINDOW Werte gebildet und
+// zwischengespeichert — kurze Spitzen (TV-Blitze, Schaltvorgänge) bis zur halben
+// Fensterlänge fallen so komplett heraus. Alle Leser (Auto-Brightness, Status,
+// SSE, MQTT) nehmen value(); außerhalb des Tickers gibt es kein analogRead()
+// mehr, das mit WiFi konkurrieren könnte.
+//
+// Die Ticker-Callbacks laufen auf dem ESP8266 im SDK-Timer-Kontext (kein
+// Hardware-Interrupt), analogRead() ist dort erlaubt.
+//
+// Ema: Exponential Moving Average in Q8-Festkomma (8 Nachkommabits), ohne Float.
+//   alpha ist in 1/256 angegeben (20 ≈ 0,08).
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef LIGHT_SENSOR_H
+#define LIGHT_SENSOR_H
+
+#include <Arduino.h>
+#include <Ticker.h>
+
+namespace LightSensor {
+
+  const uint16_t INTERVAL_MS = 100;   // 10 ADC-Reads/s — weit unter der Rate, ab der WiFi leidet
+  const uint8_t WINDOW = 9;           // Median über 0,9 s, filtert Spitzen bis 0,4 s
+
+  inline Ticker ticker;
+  inline uint8_t pin = A0;
+  inline volatile uint16_t ring[WINDOW];
+  inline volatile uint8_t pos = 0;
+  inline volatile uint8_t filled = 0;
+  inline volatile uint16_t raw = 0;      // Letzter ADC-Wert
+  inline volatile uint16_t median = 0;   // Gefilterter Wert
+  inline volatile uint32_t samples = 0;
+
+  inline uint16_t medianOf(const volatile uint16_t* values, uint8_t n) {
+    uint16_t sorted[WINDOW];
+    for (uint8_t i = 0; i < n; i++) {
+      uint16_t v = values[i];
+      uint8_t j = i;
+      for (; j > 0 && sorted[j - 1] > v; j--) sorted[j] = sorted[j - 1];
+      sorted[j] = v;
+    }
+    return sorted[n / 2];
+  }
+
+  inline void sample() {
+    uint16_t v = analogRead(pin);
+    raw = v;
+    ring[pos] = v;
+    pos = (pos + 1) % WINDOW;
+    if (filled < WINDOW) filled++;
+    median = medianOf(ring, filled);
+    samples++;
+  }
+
+  inline void begin(uint8_t adcPin) {
+    pin = adcPin;
+    sample();  // value() ist sofort gültig
+    ticker.attach_ms(INTERVAL_MS, sample);
+  }
+
+  inline uint16_t value() { return median; }
+
+  class Ema {
+   public:
+    explicit Ema(uint8_t alpha) : _alpha(alpha), _q8(0), _initialized(false) {}
+
+    // Neuer Wert rein, geglätteter (gerundeter) Wert raus
+    uint16_t update(uint16_t v) {
+      int32_t target = (int32_t)v << 8;
+      if (!_initialized) {
+        _q8 = target;
+        _initialized = true;
+      } else {
+        _q8 += ((target - _q8) * _alpha) >> 8;
+      }
+      return value();
+    }
+
+    uint16_t value() const { return (uint16_t)((_q8 + 128) >> 8); }
+    int32_t q8() const { return _q8; }
+    bool initialized() const { return _initialized; }
+
+   private:
+    uint8_t _alpha;
+    int32_t _q8;
+    bool _initialized;
+  };
+
+}  // namespace LightSensor
+
+#endif  // LIGHT_SENSOR_H
@@ -9,7 +9,7 @@
 // Externe Variablen für Restart-Diagnose (werden in IkeaObegraensad.ino definiert)
 extern unsigned long lastUptimeBeforeRestart;
 extern uint32_t lastHeapBeforeRestart;
-extern char lastOperation[];
+extern char lastOperationBeforeRestart[];
 
 // Funktion zum automatischen Speichern von Restart-Logs (immer aktiv)
 // Diese Funktion wird bei jedem Systemstart automatisch aufgerufen
@@ -32,7 +32,7 @@ void logRestart() {
     // Erweitertes Restart-Log mit Uptime/Heap vor Restart
     logFile.printf("{\"id\":\"restart_%lu\",\"timestamp\":%lu,\"location\":\"setup\",\"message\":\"System restart detected\",\"data\":{\"resetReason\":\"%s\",\"freeHeap\":%d,\"maxFreeBlock\":%d,\"uptime\":%lu,\"uptimeBeforeRestart\":%lu,\"heapBeforeRestart\":%u,\"lastOperation\":\"%s\"},\"sessionId\":\"debug-session\",\"runId\":\"run1\",\"hypothesisId\":\"A\"}\n",
                    uptime, uptime, resetReason.c_str(), freeHeap, maxFreeBlock, uptime, 
-                   uptimeBeforeRestart, heapBeforeRestart, lastOperation);
+                   uptimeBeforeRestart, heapBeforeRestart, lastOperationBeforeRestart);
     logFile.close();
   }
 }
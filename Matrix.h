@@ -66,10 +66,13 @@ inline void setPixel(uint8_t *buffer, uint8_t x, uint8_t y, bool on) {
   }
 }
 
+inline uint32_t spiBytesWritten = 0; // for /metrics
+
 inline void shiftOutBuffer(uint8_t *buffer, size_t size) {
   digitalWrite(PIN_ENABLE, HIGH);    // temporarily disable LEDs while shifting
   digitalWrite(PIN_LATCH, LOW);
   SPI.writeBytes(buffer, size);
+  spiBytesWritten += size;
   digitalWrite(PIN_LATCH, HIGH);
   analogWrite(PIN_ENABLE, 1023 - brightness); // restore with PWM for brightness control
 }
@@ -0,0 +1,95 @@
+// Metrics.h — Firmware-Zähler und Streaming-Writer für /metrics (Prometheus)
+//
+// Die Zähler laufen seit dem Boot nur hoch (Prometheus erkennt den Reset beim
+// Neustart selbst). Writer erzeugt das Text-Exposition-Format zeilenweise in
+// einen kleinen Puffer und gibt ihn über den Sink weiter (HTTP-Chunks) — der
+// komplette Text liegt nie im RAM.
+//
+// Verwendung:
+//   Metrics::Writer m(buf, sizeof(buf), sendChunk);
+//   m.family("obegraensad_frames_rendered_total", "counter", "Frames drawn");
+//   m.sample("obegraensad_frames_rendered_total", nullptr, Metrics::framesRendered);
+//   m.flush();
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+namespace Metrics {
+
+  inline uint32_t loopIterations = 0;
+  inline uint32_t framesRendered = 0;
+  inline uint32_t framesSkipped = 0;    // Verpasste Frame-Slots (loop() war zu langsam)
+  inline uint32_t mqttMessagesIn = 0;
+  inline uint32_t mqttMessagesOut = 0;
+  inline uint32_t mqttConnects = 0;     // Erfolgreiche Verbindungen inkl. der ersten
+  inline uint32_t wifiReconnects = 0;
+
+  class Writer {
+   public:
+    typedef void (*Sink)(const char* data, size_t len);
+
+    Writer(char* buf, size_t capacity, Sink sink)
+      : _buf(buf), _cap(capacity), _len(0), _sink(sink) {}
+
+    // # HELP und # TYPE vor den Samples einer Metrik
+    void family(const char* name, const char* type, const char* help) {
+      line("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    }
+
+    // labels ohne Klammern, z.B. "section=\"loop\"", oder nullptr
+    void sample(const char* name, const char* labels, uint32_t value) {
+      if (labels) {
+        line("%s{%s} %u\n", name, labels, value);
+      } else {
+        line("%s %u\n", name, value);
+      }
+    }
+
+    void sample(const char* name, const char* labels, double value) {
+      if (labels) {
+        line("%s{%s} %.6f\n", name, labels, value);
+      } else {
+        line("%s %.6f\n", name, value);
+      }
+    }
+
+    void flush() {
+      if (_len == 0) return;
+      _sink(_buf, _len);
+      _len = 0;
+    }
+
+   private:
+    static const size_t MAX_LINE = 192;
+
+    char* _buf;
+    size_t _cap;
+    size_t _len;
+    Sink _sink;
+
+    __attribute__((format(printf, 2, 3)))
+    void line(const char* fmt, ...) {
+      char tmp[MAX_LINE];
+      va_list args;
+      va_start(args, fmt);
+      int n = vsnprintf(tmp, sizeof(tmp), fmt, args);
+      va_end(args);
+      if (n <= 0) return;
+      size_t len = min((size_t)n, sizeof(tmp) - 1);
+      if (_len + len > _cap) flush();
+      if (len > _cap) {
+        _sink(tmp, len);
+        return;
+      }
+      memcpy(_buf + _len, tmp, len);
+      _len += len;
+    }
+  };
+
+}  // namespace Metrics
+
+#endif  // METRICS_H
@@ -0,0 +1,106 @@
+// MqttCommand.h — Allokationsfreier Parser für "key:value"-Befehle auf <base>/cmd
+//
+// split() zerlegt den Payload direkt im Empfangspuffer von PubSubClient:
+// Key und Value sind Zeiger + Länge (ohne Leerzeichen am Rand), es wird weder
+// kopiert noch null-terminiert. Der Key wird über keyHash() (FNV-1a wie in
+// EffectRegistry, Groß-/Kleinschreibung egal) per switch verteilt; die
+// case-Labels sind constexpr, doppelte Hashes scheitern schon beim Kompilieren.
+//
+//   switch (MqttCommand::keyHash(cmd)) {
+//     case MqttCommand::keyHash("display"): ...
+//   }
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef MQTT_COMMAND_H
+#define MQTT_COMMAND_H
+
+#include <Arduino.h>
+#include "EffectRegistry.h"
+
+namespace MqttCommand {
+
+  struct Command {
+    const char* key;
+    uint8_t keyLen;
+    const char* value;
+    uint16_t valueLen;
+  };
+
+  inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  // Entfernt Leerzeichen am Anfang und Ende (verschiebt nur Zeiger/Länge)
+  inline void trim(const char*& s, size_t& len) {
+    while (len > 0 && isSpace(*s)) { s++; len--; }
+    while (len > 0 && isSpace(s[len - 1])) len--;
+  }
+
+  // "key:value" → false, wenn ':' fehlt oder der Key leer/zu lang ist
+  inline bool split(const char* payload, size_t len, Command& out) {
+    trim(payload, len);
+    const char* colon = (const char*)memchr(payload, ':', len);
+    if (!colon) return false;
+    size_t keyLen = colon - payload;
+    const char* value = colon + 1;
+    size_t valueLen = len - keyLen - 1;
+    trim(payload, keyLen);
+    trim(value, valueLen);
+    if (keyLen == 0 || keyLen > 0xFF) return false;
+    out.key = payload;
+    out.keyLen = (uint8_t)keyLen;
+    out.value = value;
+    out.valueLen = (uint16_t)min(valueLen, (size_t)0xFFFF);
+    return true;
+  }
+
+  constexpr uint32_t keyHash(const char* key) {
+    return EffectRegistry::hash(key, EffectRegistry::length(key), 0);
+  }
+
+  inline uint32_t keyHash(const Command& c) {
+    return EffectRegistry::hash(c.key, c.keyLen, 0);
+  }
+
+  // Absicherung gegen Hash-Kollisionen mit unbekannten Keys
+  inline bool keyIs(const Command& c, const char* key) {
+    return strlen(key) == c.keyLen && strncasecmp(c.key, key, c.keyLen) == 0;
+  }
+
+  inline bool valueIs(const Command& c, const char* text) {
+    return strlen(text) == c.valueLen && strncasecmp(c.value, text, c.valueLen) == 0;
+  }
+
+  // on | true | 1 → true, alles andere false (wie bisher)
+  inline bool toBool(const Command& c) {
+    return valueIs(c, "on") || valueIs(c, "true") || valueIs(c, "1");
+  }
+
+  // Ganzzahl mit optionalem Vorzeichen; Nachkommastellen werden wie bei
+  // String::toInt() abgeschnitten. false ohne Ziffer am Anfang.
+  inline bool toInt(const Command& c, long& out) {
+    const char* p = c.value;
+    const char* end = c.value + c.valueLen;
+    bool negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) p++;
+    if (p >= end || !isDigit(*p)) return false;
+    long v = 0;
+    while (p < end && isDigit(*p) && v < 100000000L) v = v * 10 + (*p++ - '0');
+    out = negative ? -v : v;
+    return true;
+  }
+
+  // Kopie auf den Stack, weil strtof() einen Terminator braucht
+  inline bool toFloat(const Command& c, float& out) {
+    char tmp[24];
+    size_t n = min((size_t)c.valueLen, sizeof(tmp) - 1);
+    memcpy(tmp, c.value, n);
+    tmp[n] = '\0';
+    char* end;
+    out = strtof(tmp, &end);
+    return end != tmp;
+  }
+
+}  // namespace MqttCommand
+
+#endif  // MQTT_COMMAND_H
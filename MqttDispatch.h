@@ -0,0 +1,212 @@
+// MqttDispatch.h — Verteilt eingehende MQTT-Nachrichten (PubSubClient-Callback)
+//
+//   <baseTopic>/frame     binäre Frames → MqttFrames::receive()
+//   homeassistant/status  Birth-Message "online" → Discovery erneut senden
+//   <baseTopic>/cmd       "key:value" (siehe MqttCommand.h) oder ein JSON-Objekt
+//                         wie bei POST /api/batch → stageBatch()
+//
+// Der Payload wird direkt im Empfangspuffer geparst — keine String-Kopien, kein
+// Heap. Zustand und Seiteneffekte (Effekt wechseln, persistieren, Batch
+// vormerken) liefert der Sketch; tools/mqtt_alloc_test.cpp bindet dieselbe
+// Datei mit Stubs dafür ein.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef MQTT_DISPATCH_H
+#define MQTT_DISPATCH_H
+
+#include <Arduino.h>
+#include "HaDiscovery.h"
+#include "Matrix.h"
+#include "MqttCommand.h"
+#include "MqttFrames.h"
+
+// Aus dem Sketch
+extern char mqttBaseTopic[];
+extern bool haDiscoveryPending;
+extern bool displayEnabled;
+extern bool autoBrightnessEnabled;
+extern const uint16_t PWM_MAX;
+extern float g_sensorTemp;
+extern float g_sensorHumi;
+extern uint16_t g_clockDur;
+extern uint16_t g_tempDur;
+extern uint16_t g_humiDur;
+extern uint8_t currentEffectIndex;
+
+bool applyEffect(uint8_t idx);
+int8_t findEffectIndexByName(const char* name, size_t len);
+const char* effectName(uint8_t idx);
+void persistBrightnessToStorage();
+void persistSlideConfig();
+void markStateChanged();
+const char* stageBatch(const char* json, size_t len, const char* source, const char*& errorField);
+
+namespace MqttDispatch {
+
+  inline void handle(const char* topic, const uint8_t* payload, unsigned int length) {
+    // Binäre Frames: direkt aus dem Empfangspuffer übernehmen, kein Logging
+    size_t baseLen = strlen(mqttBaseTopic);
+    if (strncmp(topic, mqttBaseTopic, baseLen) == 0 && strcmp(topic + baseLen, "/frame") == 0) {
+      if (!MqttFrames::receive(payload, length)) {
+        Serial.printf("MQTT frame: invalid length %u\n", length);
+      }
+      return;
+    }
+    const char* message = (const char*)payload;
+    size_t messageLen = length;
+    MqttCommand::trim(message, messageLen);
+
+    // Birth-Message von Home Assistant: Discovery erneut senden
+    if (strcmp(topic, HaDiscovery::STATUS_TOPIC) == 0) {
+      if (messageLen == 6 && strncasecmp(message, "online", 6) == 0) haDiscoveryPending = true;
+      return;
+    }
+
+    // print()/write() statt printf(): Print::printf() legt Ausgaben über 63
+    // Zeichen auf den Heap
+    Serial.print("MQTT cmd on ");
+    Serial.print(topic);
+    Serial.print(": ");
+    Serial.write(message, messageLen);
+    Serial.println();
+
+    if (messageLen > 0 && message[0] == '{') {
+      const char* errorField = nullptr;
+      const char* error = stageBatch(message, messageLen, "mqtt", errorField);
+      if (error) {
+        Serial.print("MQTT batch rejected: ");
+        Serial.print(error);
+        Serial.print(" (");
+        Serial.print(errorField ? errorField : "-");
+        Serial.println(")");
+      }
+      return;
+    }
+
+    MqttCommand::Command cmd;
+    if (!MqttCommand::split(message, messageLen, cmd)) {
+      Serial.println("MQTT cmd: missing ':' separator, ignored");
+      return;
+    }
+
+    bool changed = false;
+    bool unknownKey = false;  // Auch bei Hash-Treffer mit anderem Key
+    long intValue;
+    float floatValue;
+
+    switch (MqttCommand::keyHash(cmd)) {
+      case MqttCommand::keyHash("display"): {
+        if (!MqttCommand::keyIs(cmd, "display")) { unknownKey = true; break; }
+        bool newState = MqttCommand::toBool(cmd);
+        if (newState != displayEnabled) {
+          displayEnabled = newState;
+          if (displayEnabled) {
+            analogWrite(PIN_ENABLE, PWM_MAX - brightness);
+          } else {
+            analogWrite(PIN_ENABLE, PWM_MAX);
+          }
+          Serial.printf("MQTT: display -> %s\n", displayEnabled ? "ON" : "OFF");
+          changed = true;
+        }
+        break;
+      }
+      case MqttCommand::keyHash("effect"): {
+        if (!MqttCommand::keyIs(cmd, "effect")) { unknownKey = true; break; }
+        int8_t idx = findEffectIndexByName(cmd.value, cmd.valueLen);
+        if (idx >= 0) {
+          applyEffect((uint8_t)idx);
+          Serial.printf("MQTT: effect -> %s\n", effectName(currentEffectIndex));
+          changed = true;
+        } else {
+          Serial.print("MQTT: unknown effect '");
+          Serial.write(cmd.value, cmd.valueLen);
+          Serial.println("'");
+        }
+        break;
+      }
+      case MqttCommand::keyHash("brightness"):
+        if (!MqttCommand::keyIs(cmd, "brightness")) { unknownKey = true; break; }
+        if (MqttCommand::toInt(cmd, intValue) && intValue >= 0 && intValue <= PWM_MAX) {
+          brightness = (uint16_t)intValue;
+          analogWrite(PIN_ENABLE, PWM_MAX - brightness);
+          if (autoBrightnessEnabled) {
+            autoBrightnessEnabled = false;
+            Serial.println("Auto-Brightness disabled (manual MQTT brightness)");
+          }
+          persistBrightnessToStorage();
+          Serial.printf("MQTT: brightness -> %d\n", brightness);
+          changed = true;
+        }
+        break;
+      case MqttCommand::keyHash("autobrightness"): {
+        if (!MqttCommand::keyIs(cmd, "autobrightness")) { unknownKey = true; break; }
+        bool newState = MqttCommand::toBool(cmd);
+        if (newState != autoBrightnessEnabled) {
+          autoBrightnessEnabled = newState;
+          persistBrightnessToStorage();
+          Serial.printf("MQTT: autobrightness -> %s\n", autoBrightnessEnabled ? "ON" : "OFF");
+          changed = true;
+        }
+        break;
+      }
+      case MqttCommand::keyHash("temp"):
+        if (!MqttCommand::keyIs(cmd, "temp")) { unknownKey = true; break; }
+        if (MqttCommand::toFloat(cmd, floatValue) && floatValue >= -40.0f && floatValue <= 80.0f) {
+          g_sensorTemp = floatValue;
+          Serial.printf("MQTT: temp -> %.1f\n", g_sensorTemp);
+          changed = true;
+        }
+        break;
+      case MqttCommand::keyHash("humi"):
+        if (!MqttCommand::keyIs(cmd, "humi")) { unknownKey = true; break; }
+        if (MqttCommand::toFloat(cmd, floatValue) && floatValue >= 0.0f && floatValue <= 100.0f) {
+          g_sensorHumi = floatValue;
+          Serial.printf("MQTT: humi -> %.1f\n", g_sensorHumi);
+          changed = true;
+        }
+        break;
+      case MqttCommand::keyHash("clockdur"):
+        if (!MqttCommand::keyIs(cmd, "clockdur")) { unknownKey = true; break; }
+        if (MqttCommand::toInt(cmd, intValue) && intValue >= 1 && intValue <= 3600) {
+          g_clockDur = (uint16_t)intValue;
+          persistSlideConfig();
+          Serial.printf("MQTT: clockdur -> %d\n", g_clockDur);
+          changed = true;
+        }
+        break;
+      case MqttCommand::keyHash("tempdur"):
+        if (!MqttCommand::keyIs(cmd, "tempdur")) { unknownKey = true; break; }
+        if (MqttCommand::toInt(cmd, intValue) && intValue >= 1 && intValue <= 3600) {
+          g_tempDur = (uint16_t)intValue;
+          persistSlideConfig();
+          Serial.printf("MQTT: tempdur -> %d\n", g_tempDur);
+          changed = true;
+        }
+        break;
+      case MqttCommand::keyHash("humidur"):
+        if (!MqttCommand::keyIs(cmd, "humidur")) { unknownKey = true; break; }
+        if (MqttCommand::toInt(cmd, intValue) && intValue >= 1 && intValue <= 3600) {
+          g_humiDur = (uint16_t)intValue;
+          persistSlideConfig();
+          Serial.printf("MQTT: humidur -> %d\n", g_humiDur);
+          changed = true;
+        }
+        break;
+      default:
+        unknownKey = true;
+        break;
+    }
+    if (unknownKey) {
+      Serial.print("MQTT: unknown key '");
+      Serial.write(cmd.key, cmd.keyLen);
+      Serial.println("'");
+    }
+
+    if (changed) {
+      markStateChanged();
+    }
+  }
+
+}  // namespace MqttDispatch
+
+#endif  // MQTT_DISPATCH_H
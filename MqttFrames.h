@@ -0,0 +1,85 @@
+// MqttFrames.h — Extern gerenderte Frames über <baseTopic>/frame
+//
+// Payload (binär):
+//   - 32 Bytes: ein Frame, bleibt bis zum Timeout stehen
+//   - n × 34 Bytes: Sequenz, je 2 Byte Anzeigedauer in ms (big-endian) + 32 Byte Frame
+// Ein Frame ist zeilenweise von oben nach unten, 2 Bytes pro Zeile, MSB = linkes
+// Pixel (x = 0). Die Bytes werden ohne Umweg direkt aus dem PubSubClient-Puffer
+// übernommen; die Umrechnung auf die Verdrahtung (PIXEL_MAP) passiert erst beim
+// Zeichnen.
+//
+// Solange Frames aktiv sind, ersetzen sie den Effekt. TIMEOUT_MS nach dem Ende
+// der Sequenz (bzw. nach einem Einzel-Frame) ohne neue Nachricht läuft der
+// Effekt weiter. Eine neue Nachricht ersetzt eine laufende Sequenz.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef MQTT_FRAMES_H
+#define MQTT_FRAMES_H
+
+#include <Arduino.h>
+#include "Matrix.h"
+
+namespace MqttFrames {
+
+  const uint8_t FRAME_BYTES = 32;
+  const uint8_t RECORD_BYTES = FRAME_BYTES + 2;
+  const uint8_t MAX_FRAMES = 14;               // MQTT_BUFFER_SIZE (IkeaObegraensad.ino) wird daraus berechnet
+  const unsigned long TIMEOUT_MS = 5000;
+
+  inline uint8_t frames[MAX_FRAMES][FRAME_BYTES];
+  inline uint16_t durations[MAX_FRAMES];
+  inline uint8_t count = 0;                    // 0 = keine externen Frames
+  inline uint8_t current = 0;
+  inline unsigned long frameStart = 0;         // Beginn des aktuellen Frames
+  inline bool fresh = false;                   // Neu empfangen: sofort zeichnen, nicht auf den 50-ms-Takt warten
+
+  inline uint32_t received = 0;                // Angenommene Frames
+  inline uint32_t rejected = 0;                // Nachrichten mit ungültiger Länge
+
+  inline bool receive(const uint8_t* payload, size_t len) {
+    if (len == FRAME_BYTES) {
+      memcpy(frames[0], payload, FRAME_BYTES);
+      durations[0] = 0;
+      count = 1;
+    } else if (len > 0 && len % RECORD_BYTES == 0 && len / RECORD_BYTES <= MAX_FRAMES) {
+      count = len / RECORD_BYTES;
+      for (uint8_t i = 0; i < count; i++, payload += RECORD_BYTES) {
+        durations[i] = ((uint16_t)payload[0] << 8) | payload[1];
+        memcpy(frames[i], payload + 2, FRAME_BYTES);
+      }
+    } else {
+      rejected++;
+      return false;
+    }
+    received += count;
+    current = 0;
+    frameStart = millis();
+    fresh = true;
+    return true;
+  }
+
+  // Aktuellen Frame (Verdrahtungsreihenfolge) nach out zeichnen.
+  // false: keine externen Frames (mehr) → Effekt zeichnen.
+  inline bool draw(uint8_t* out) {
+    if (count == 0) return false;
+    unsigned long now = millis();
+    while (current + 1 < count && now - frameStart >= durations[current]) {
+      frameStart += durations[current];
+      current++;
+    }
+    if (current + 1 == count && now - frameStart >= durations[current] + TIMEOUT_MS) {
+      count = 0;
+      return false;
+    }
+    const uint8_t* f = frames[current];
+    for (uint8_t y = 0; y < 16; y++) {
+      for (uint8_t x = 0; x < 16; x++) {
+        if (f[y * 2 + (x >> 3)] & (0x80 >> (x & 7))) setPixel(out, x, y, true);
+      }
+    }
+    return true;
+  }
+
+}  // namespace MqttFrames
+
+#endif  // MQTT_FRAMES_H
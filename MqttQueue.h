@@ -0,0 +1,311 @@
+// MqttQueue.h — Ausgehende MQTT-Nachrichten: fester Ringpuffer, QoS 1 mit PUBACK
+//
+// Queue: alle State-Publishes landen zuerst hier — auch wenn der Broker gerade
+// nicht erreichbar ist. Die Einträge liegen hintereinander in einem festen
+// Byte-Ring (keine Allokation); ist er voll, fällt der älteste Eintrag heraus
+// (dropped). process() sendet aus loop() höchstens BURST Einträge pro Aufruf und
+// hält bei QoS 1 höchstens MAX_INFLIGHT unbestätigte Nachrichten offen; nach
+// RETRY_MS ohne PUBACK wird mit DUP-Flag wiederholt, nach einem Reconnect
+// (resetInflight()) neu gesendet.
+//
+// AckClient: PubSubClient kann nur QoS 0 senden und verwirft eingehende PUBACKs.
+// Der Wrapper sitzt zwischen PubSubClient und WiFiClient, reicht alle Bytes
+// unverändert durch und liest dabei die MQTT-Paketgrenzen mit — PUBACKs werden
+// an acknowledge() gemeldet. QoS-1-PUBLISH-Pakete schreibt writePublish() selbst.
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef MQTT_QUEUE_H
+#define MQTT_QUEUE_H
+
+#include <Arduino.h>
+#include <Client.h>
+
+namespace MqttQueue {
+
+  const size_t CAPACITY = 1024;
+  const uint8_t MAX_INFLIGHT = 4;
+  const uint8_t BURST = 4;                // Sends pro process()-Aufruf
+  const unsigned long RETRY_MS = 3000;
+
+  enum Flags : uint8_t {
+    FLAG_RETAIN = 1 << 0,
+    FLAG_QOS1   = 1 << 1,
+    FLAG_SENT   = 1 << 2,
+    FLAG_ACKED  = 1 << 3
+  };
+
+  // Im Ring, danach Topic (ohne Terminator) und Payload; 4-Byte-ausgerichtet
+  struct Record {
+    uint16_t size;          // Gesamtgröße; FILLER = Rest bis Ringende ungenutzt
+    uint16_t payloadLen;
+    uint8_t topicLen;
+    uint8_t flags;
+    uint16_t packetId;
+    uint32_t sentAt;
+
+    const char* topic() const { return (const char*)(this + 1); }
+    const uint8_t* payload() const { return (const uint8_t*)(this + 1) + topicLen; }
+  };
+
+  const uint16_t FILLER = 0x8000;
+
+  // Sendet einen Eintrag; false = Verbindung weg, später erneut versuchen
+  typedef bool (*Sender)(const Record& r, bool dup);
+
+  alignas(4) inline uint8_t ring[CAPACITY];
+  inline size_t head = 0;      // Ältester Eintrag
+  inline size_t tail = 0;      // Nächste Schreibposition
+  inline size_t used = 0;
+  inline uint16_t nextPacketId = 1;
+
+  inline uint32_t queued = 0;
+  inline uint32_t dropped = 0;    // Älteste Einträge verdrängt (Queue voll)
+  inline uint32_t retries = 0;    // QoS 1 ohne PUBACK erneut gesendet
+  inline uint32_t acked = 0;
+
+  inline Record* at(size_t pos) { return (Record*)(ring + pos); }
+
+  inline size_t length() {
+    size_t n = 0;
+    size_t pos = head;
+    for (size_t left = used; left > 0;) {
+      uint16_t size = at(pos)->size & ~FILLER;
+      if (!(at(pos)->size & FILLER)) n++;
+      left -= size;
+      pos = (pos + size) % CAPACITY;
+    }
+    return n;
+  }
+
+  inline void popHead() {
+    uint16_t size = at(head)->size & ~FILLER;
+    head = (head + size) % CAPACITY;
+    used -= size;
+    if (used == 0) {
+      head = tail = 0;
+    } else if (at(head)->size & FILLER) {
+      popHead();
+    }
+  }
+
+  // Bestätigte bzw. gesendete QoS-0-Einträge am Anfang freigeben
+  inline void popDone() {
+    while (used > 0) {
+      uint8_t f = at(head)->flags;
+      bool done = (f & FLAG_ACKED) || ((f & FLAG_SENT) && !(f & FLAG_QOS1));
+      if (!done) return;
+      popHead();
+    }
+  }
+
+  // Platz für need Bytes am Stück schaffen (ggf. Füller bis Ringende)
+  inline bool reserve(size_t need) {
+    if (used == 0) {
+      head = tail = 0;
+      return true;
+    }
+    if (tail > head) {
+      if (CAPACITY - tail >= need) return true;
+      if (head >= need) {
+        at(tail)->size = (uint16_t)(CAPACITY - tail) | FILLER;
+        used += CAPACITY - tail;
+        tail = 0;
+        return true;
+      }
+      return false;
+    }
+    return head - tail >= need;
+  }
+
+  inline bool push(const char* topic, const uint8_t* payload, size_t len, uint8_t flags) {
+    size_t topicLen = strlen(topic);
+    size_t need = (sizeof(Record) + topicLen + len + 3) & ~(size_t)3;
+    if (topicLen > 0xFF || need > CAPACITY / 2) {
+      dropped++;
+      return false;
+    }
+    while (!reserve(need)) {
+      popHead();
+      dropped++;
+    }
+    Record* r = at(tail);
+    r->size = (uint16_t)need;
+    r->payloadLen = (uint16_t)len;
+    r->topicLen = (uint8_t)topicLen;
+    r->flags = flags & (FLAG_RETAIN | FLAG_QOS1);
+    r->packetId = 0;
+    r->sentAt = 0;
+    memcpy(r + 1, topic, topicLen);
+    memcpy((uint8_t*)(r + 1) + topicLen, payload, len);
+    tail = (tail + need) % CAPACITY;
+    used += need;
+    queued++;
+    return true;
+  }
+
+  inline void acknowledge(uint16_t packetId) {
+    size_t pos = head;
+    for (size_t left = used; left > 0;) {
+      Record* r = at(pos);
+      uint16_t size = r->size & ~FILLER;
+      if (!(r->size & FILLER) && (r->flags & (FLAG_QOS1 | FLAG_SENT)) == (FLAG_QOS1 | FLAG_SENT) &&
+          r->packetId == packetId && !(r->flags & FLAG_ACKED)) {
+        r->flags |= FLAG_ACKED;
+        acked++;
+        break;
+      }
+      left -= size;
+      pos = (pos + size) % CAPACITY;
+    }
+    popDone();
+  }
+
+  // Nach einem Reconnect: unbestätigte QoS-1-Nachrichten neu senden
+  inline void resetInflight() {
+    size_t pos = head;
+    for (size_t left = used; left > 0;) {
+      Record* r = at(pos);
+      uint16_t size = r->size & ~FILLER;
+      if (!(r->size & FILLER) && (r->flags & FLAG_QOS1) && !(r->flags & FLAG_ACKED)) {
+        r->flags &= ~FLAG_SENT;
+      }
+      left -= size;
+      pos = (pos + size) % CAPACITY;
+    }
+  }
+
+  inline void process(Sender send) {
+    unsigned long now = millis();
+    uint8_t inflight = 0;
+    uint8_t sent = 0;
+    size_t pos = head;
+    for (size_t left = used; left > 0 && sent < BURST;) {
+      Record* r = at(pos);
+      uint16_t size = r->size & ~FILLER;
+      left -= size;
+      pos = (pos + size) % CAPACITY;
+      if (r->size & FILLER) continue;
+      if (r->flags & FLAG_ACKED) continue;
+      if (r->flags & FLAG_SENT) {
+        if (!(r->flags & FLAG_QOS1)) continue;
+        inflight++;
+        if (now - r->sentAt < RETRY_MS) continue;
+        if (!send(*r, true)) return;
+        r->sentAt = now;
+        retries++;
+        sent++;
+        continue;
+      }
+      if (r->flags & FLAG_QOS1) {
+        if (inflight >= MAX_INFLIGHT) break;
+        r->packetId = nextPacketId++;
+        if (nextPacketId == 0) nextPacketId = 1;
+        inflight++;
+      }
+      if (!send(*r, false)) return;
+      r->flags |= FLAG_SENT;
+      r->sentAt = now;
+      sent++;
+    }
+    popDone();
+  }
+
+  // Client-Wrapper: liest eingehende Pakete mit und meldet PUBACKs
+  class AckClient : public Client {
+   public:
+    explicit AckClient(Client& inner) : _inner(inner) {}
+
+    int connect(IPAddress ip, uint16_t port) override { resetParser(); return _inner.connect(ip, port); }
+    int connect(const char* host, uint16_t port) override { resetParser(); return _inner.connect(host, port); }
+    size_t write(uint8_t b) override { return _inner.write(b); }
+    size_t write(const uint8_t* buf, size_t size) override { return _inner.write(buf, size); }
+    int available() override { return _inner.available(); }
+    int read() override {
+      int b = _inner.read();
+      if (b >= 0) sniff((uint8_t)b);
+      return b;
+    }
+    int read(uint8_t* buf, size_t size) override {
+      int n = _inner.read(buf, size);
+      for (int i = 0; i < n; i++) sniff(buf[i]);
+      return n;
+    }
+    int peek() override { return _inner.peek(); }
+    void flush() override { _inner.flush(); }
+    void stop() override { resetParser(); _inner.stop(); }
+    uint8_t connected() override { return _inner.connected(); }
+    operator bool() override { return (bool)_inner; }
+
+    // PUBLISH mit QoS 1 (PubSubClient kann das nicht): Header, Topic, Packet-ID, Payload
+    bool writePublish(const char* prefix, const Record& r, bool dup) {
+      size_t prefixLen = strlen(prefix);
+      size_t topicLen = prefixLen + r.topicLen;
+      size_t remaining = 2 + topicLen + 2 + r.payloadLen;
+      uint8_t head[9];
+      uint8_t n = 0;
+      head[n++] = 0x30 | (dup ? 0x08 : 0) | 0x02 | ((r.flags & FLAG_RETAIN) ? 0x01 : 0);
+      do {
+        uint8_t digit = remaining & 0x7F;
+        remaining >>= 7;
+        head[n++] = digit | (remaining ? 0x80 : 0);
+      } while (remaining);
+      head[n++] = topicLen >> 8;
+      head[n++] = topicLen & 0xFF;
+      uint8_t id[2] = {(uint8_t)(r.packetId >> 8), (uint8_t)(r.packetId & 0xFF)};
+      return _inner.write(head, n) == n &&
+             _inner.write((const uint8_t*)prefix, prefixLen) == prefixLen &&
+             _inner.write((const uint8_t*)r.topic(), r.topicLen) == r.topicLen &&
+             _inner.write(id, 2) == 2 &&
+             _inner.write(r.payload(), r.payloadLen) == r.payloadLen;
+    }
+
+   private:
+    enum ParseState : uint8_t { PARSE_HEADER, PARSE_LENGTH, PARSE_BODY };
+
+    Client& _inner;
+    ParseState _state = PARSE_HEADER;
+    uint8_t _type = 0;
+    uint32_t _remaining = 0;
+    uint32_t _multiplier = 1;
+    uint32_t _pos = 0;
+    uint16_t _packetId = 0;
+
+    void resetParser() { _state = PARSE_HEADER; }
+
+    void packetDone() {
+      if (_type == 4 && _pos >= 2) acknowledge(_packetId);  // PUBACK
+      _state = PARSE_HEADER;
+    }
+
+    void sniff(uint8_t b) {
+      switch (_state) {
+        case PARSE_HEADER:
+          _type = b >> 4;
+          _remaining = 0;
+          _multiplier = 1;
+          _state = PARSE_LENGTH;
+          break;
+        case PARSE_LENGTH:
+          _remaining += (b & 0x7F) * _multiplier;
+          _multiplier <<= 7;
+          if (!(b & 0x80)) {
+            _pos = 0;
+            _packetId = 0;
+            if (_remaining == 0) {
+              packetDone();
+            } else {
+              _state = PARSE_BODY;
+            }
+          }
+          break;
+        case PARSE_BODY:
+          if (_pos < 2) _packetId = (_packetId << 8) | b;
+          if (++_pos == _remaining) packetDone();
+          break;
+      }
+    }
+  };
+
+}  // namespace MqttQueue
+
+#endif  // MQTT_QUEUE_H
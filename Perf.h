@@ -0,0 +1,89 @@
+// Perf.h — Immer aktive Laufzeit-Messung pro Subsystem (für /api/perf)
+//
+// Jede Sektion sammelt Anzahl, Min/Max/Summe in Mikrosekunden sowie ein
+// log2-Histogramm: Bucket i zählt Dauern in [2^i, 2^(i+1)) µs, der letzte
+// Bucket sammelt alles darüber. Kosten pro Messung: zwei micros()-Aufrufe
+// und ein paar Additionen — kein Heap, kein Logging.
+//
+// Verwendung:
+//   { PERF_SCOPE(PERF_MQTT); mqttClient.loop(); }
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef PERF_H
+#define PERF_H
+
+#include <Arduino.h>
+
+enum PerfSection : uint8_t {
+  PERF_LOOP = 0,   // Gesamter loop()-Durchlauf
+  PERF_HTTP,       // server.handleClient()
+  PERF_MQTT,       // mqttClient.loop() + State-Publish
+  PERF_OTA,        // ArduinoOTA.handle()
+  PERF_MDNS,       // MDNS.update()
+  PERF_DRAW,       // currentEffect->draw()
+  PERF_SHIFT,      // shiftOutBuffer()
+  PERF_SENSOR,     // LocalSensor::update() (jeder Durchlauf)
+  PERF_BRIGHTNESS, // updateAutoBrightness() (alle 3 s)
+  PERF_SECTION_COUNT
+};
+
+namespace Perf {
+
+  const uint8_t HIST_BUCKETS = 16; // 1 µs … ≥32 ms
+
+  struct Stat {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+    uint32_t hist[HIST_BUCKETS];
+  };
+
+  // Reihenfolge muss zu PerfSection passen
+  static const char* const SECTION_NAMES[PERF_SECTION_COUNT] = {
+    "loop", "http", "mqtt", "ota", "mdns", "draw", "shift", "sensor", "brightness"
+  };
+
+  inline Stat stats[PERF_SECTION_COUNT];
+  inline unsigned long resetAtMs = 0;
+
+  inline void reset() {
+    memset(stats, 0, sizeof(stats));
+    for (uint8_t i = 0; i < PERF_SECTION_COUNT; i++) {
+      stats[i].minUs = UINT32_MAX;
+    }
+    resetAtMs = millis();
+  }
+
+  inline uint8_t bucketFor(uint32_t us) {
+    if (us < 2) return 0;
+    uint8_t b = 31 - __builtin_clz(us);
+    return b < HIST_BUCKETS ? b : HIST_BUCKETS - 1;
+  }
+
+  inline void record(PerfSection section, uint32_t us) {
+    Stat& s = stats[section];
+    s.count++;
+    s.totalUs += us;
+    if (us < s.minUs) s.minUs = us;
+    if (us > s.maxUs) s.maxUs = us;
+    s.hist[bucketFor(us)]++;
+  }
+
+  // RAII-Messung: misst vom Konstruktor bis zum Verlassen des Scopes
+  class Scope {
+   public:
+    explicit Scope(PerfSection section) : _section(section), _startUs(micros()) {}
+    ~Scope() { record(_section, micros() - _startUs); }
+   private:
+    PerfSection _section;
+    uint32_t _startUs;
+  };
+
+}  // namespace Perf
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+#define PERF_SCOPE(section) Perf::Scope PERF_CONCAT(_perfScope, __LINE__)(section)
+
+#endif  // PERF_H
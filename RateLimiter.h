@@ -0,0 +1,105 @@
+// RateLimiter.h — Token-Buckets pro Client-IP für die Web-API
+//
+// Ersetzt das globale 20-Requests-in-10-s-Fenster, bei dem ein einzelner
+// gesprächiger Client (Skript, mehrere Browser-Tabs) alle anderen — auch Home
+// Assistant — aussperrt.
+//   - Feste Tabelle mit TABLE_SIZE Einträgen (IP → Buckets), bei Bedarf wird
+//     der am längsten unbenutzte Eintrag verdrängt (LRU)
+//   - Getrennte Budgets für lesende (Status) und schreibende Endpoints
+//   - take() liefert bei Ablehnung die Wartezeit für den Retry-After-Header
+//
+// Tokens werden in Tausendsteln gezählt (keine Floats).
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+#include <Arduino.h>
+
+namespace RateLimiter {
+
+  enum Class : uint8_t {
+    READ,    // /api/status, /api/events, /api/perf, /api/backup
+    WRITE,   // Einstellungen, Effektwechsel, Restore
+    CLASS_COUNT
+  };
+
+  struct Budget {
+    uint16_t burst;     // Max. Tokens (Requests am Stück)
+    uint16_t refillMs;  // Ein Token pro refillMs
+  };
+
+  // READ: 20 am Stück, dann 2/s (entspricht dem alten Fenster, aber pro Client)
+  // WRITE: 10 am Stück, dann 1/s
+  const Budget BUDGETS[CLASS_COUNT] = {{20, 500}, {10, 1000}};
+
+  const uint8_t TABLE_SIZE = 8;
+  const uint32_t TOKEN = 1000;
+
+  struct Bucket {
+    uint32_t milliTokens;
+    uint32_t lastRefillMs;
+  };
+
+  struct Entry {
+    bool used;
+    uint32_t ip;
+    uint32_t lastUseMs;
+    Bucket buckets[CLASS_COUNT];
+  };
+
+  inline Entry table[TABLE_SIZE] = {};
+
+  // Statistik für /api/status
+  inline uint32_t rejected[CLASS_COUNT] = {};
+  inline uint32_t evictions = 0;
+
+  // Eintrag für ip; neu angelegt mit vollen Buckets (freier Platz oder LRU)
+  inline Entry& lookup(uint32_t ip, uint32_t now) {
+    Entry* victim = nullptr;
+    for (uint8_t i = 0; i < TABLE_SIZE; i++) {
+      Entry& e = table[i];
+      if (e.used && e.ip == ip) return e;
+      if (!e.used) {
+        if (!victim || victim->used) victim = &e;
+      } else if (!victim || (victim->used && now - e.lastUseMs > now - victim->lastUseMs)) {
+        victim = &e;
+      }
+    }
+    if (victim->used) evictions++;
+    victim->used = true;
+    victim->ip = ip;
+    victim->lastUseMs = now;
+    for (uint8_t c = 0; c < CLASS_COUNT; c++) {
+      victim->buckets[c] = {BUDGETS[c].burst * TOKEN, now};
+    }
+    return *victim;
+  }
+
+  // 0 = erlaubt, sonst Sekunden bis zum nächsten Token (Retry-After)
+  inline uint16_t take(uint32_t ip, Class cls, uint32_t now) {
+    Entry& e = lookup(ip, now);
+    e.lastUseMs = now;
+    const Budget& b = BUDGETS[cls];
+    Bucket& k = e.buckets[cls];
+    uint32_t capacity = b.burst * TOKEN;
+    uint32_t elapsed = now - k.lastRefillMs;
+    k.lastRefillMs = now;
+    // Lange Pause: voll auffüllen (vermeidet Überlauf bei elapsed * TOKEN)
+    if (elapsed >= (uint32_t)b.burst * b.refillMs) {
+      k.milliTokens = capacity;
+    } else {
+      k.milliTokens = min(capacity, k.milliTokens + elapsed * TOKEN / b.refillMs);
+    }
+    if (k.milliTokens >= TOKEN) {
+      k.milliTokens -= TOKEN;
+      return 0;
+    }
+    rejected[cls]++;
+    uint32_t waitMs = (TOKEN - k.milliTokens) * b.refillMs / TOKEN;
+    return waitMs / 1000 + 1;
+  }
+
+}  // namespace RateLimiter
+
+#endif  // RATE_LIMITER_H
@@ -0,0 +1,89 @@
+// RtcState.h — CRC-geschützte Slots im RTC-User-Memory des ESP8266
+//
+// Das RTC-User-Memory (512 Bytes, 128 Blöcke à 4 Bytes) übersteht Soft-Resets,
+// Watchdog-Resets und ESP.restart(), wird aber bei Power-On gelöscht bzw. enthält
+// dann Zufallswerte — daher trägt jeder Slot eine CRC32.
+// Schreiben kostet wenige µs und verschleißt keinen Flash.
+//
+// Die Blöcke 0..31 legt eboot für das OTA-Kommando (Flash-Kopie nach dem
+// Update) an und überschreibt sie beim OTA-Neustart — eigene Slots liegen
+// daher erst ab FIRST_FREE_BLOCK und überstehen so auch OTA-Updates.
+//
+// Slot-Belegung (Offsets in 4-Byte-Blöcken, nicht überlappen lassen):
+//   0..31  eboot       — OTA-Kommando, nicht verwenden
+//   32..38 WifiConfig  — letzter erfolgreicher Kanal/BSSID/IP-Konfiguration
+//   39..49 DiagState   — Uptime/Heap/letzte Operation des laufenden Boots
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef RTC_STATE_H
+#define RTC_STATE_H
+
+#include <Arduino.h>
+#include "Crc32.h"
+
+namespace RtcState {
+
+  const uint32_t FIRST_FREE_BLOCK = 32;   // Nach dem eboot-Bereich
+  const uint32_t WIFI_SLOT = FIRST_FREE_BLOCK;
+  static_assert(WIFI_SLOT >= 32, "RTC blocks 0..31 are overwritten by eboot on OTA");
+
+  // Gecachte Verbindungsdaten für den WiFi-Fast-Reconnect
+  struct WifiConfig {
+    uint32_t crc;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t fastConnects;   // Aufeinanderfolgende Verbindungen ohne DHCP
+  };
+  static_assert(sizeof(WifiConfig) % 4 == 0, "RTC slots must be a multiple of 4 bytes");
+
+  const uint32_t DIAG_SLOT = WIFI_SLOT + sizeof(WifiConfig) / 4;
+  const size_t DIAG_OPERATION_LEN = 32;
+
+  // Restart-Diagnose: wird laufend aktualisiert und beim nächsten Boot als
+  // "vor dem Restart" ausgewertet (auch nach Watchdog-Reset oder Exception)
+  struct DiagState {
+    uint32_t crc;
+    uint32_t uptimeMs;
+    uint32_t freeHeap;
+    char lastOperation[DIAG_OPERATION_LEN];
+  };
+  static_assert(sizeof(DiagState) % 4 == 0, "RTC slots must be a multiple of 4 bytes");
+  static_assert(DIAG_SLOT >= WIFI_SLOT + sizeof(WifiConfig) / 4, "RTC slots overlap");
+  static_assert(DIAG_SLOT * 4 + sizeof(DiagState) <= 512, "RTC user memory is 512 bytes");
+
+  // CRC über alles nach dem crc-Feld
+  template <typename T>
+  uint32_t slotCrc(const T& slot) {
+    return crc32((const uint8_t*)&slot + sizeof(uint32_t), sizeof(T) - sizeof(uint32_t));
+  }
+
+  template <typename T>
+  bool read(uint32_t block, T& slot) {
+    if (!ESP.rtcUserMemoryRead(block, (uint32_t*)&slot, sizeof(T))) {
+      return false;
+    }
+    return slot.crc == slotCrc(slot);
+  }
+
+  template <typename T>
+  bool write(uint32_t block, T& slot) {
+    slot.crc = slotCrc(slot);
+    return ESP.rtcUserMemoryWrite(block, (uint32_t*)&slot, sizeof(T));
+  }
+
+  // Slot ungültig machen (CRC passt danach nicht mehr)
+  template <typename T>
+  void invalidate(uint32_t block) {
+    T slot;
+    memset(&slot, 0, sizeof(slot));
+    slot.crc = ~slotCrc(slot);
+    ESP.rtcUserMemoryWrite(block, (uint32_t*)&slot, sizeof(T));
+  }
+
+}  // namespace RtcState
+
+#endif  // RTC_STATE_H
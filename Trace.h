@@ -0,0 +1,110 @@
+// Trace.h — Zyklengenauer Trace-Ringpuffer (Export als Chrome/Perfetto Trace JSON)
+//
+// TRACE_SCOPE("name") schreibt beim Betreten einen Begin- und beim Verlassen
+// einen End-Record (ESP.getCycleCount()) in einen festen RAM-Ringpuffer.
+// Ältere Records werden überschrieben. /api/trace streamt den Inhalt im
+// Chrome Trace Event Format (chrome://tracing, ui.perfetto.dev).
+//
+// Nur aktiv mit #define TRACE_ENABLED (in IkeaObegraensad.ino). Ohne das Flag
+// expandieren alle Makros zu nichts — kein RAM, keine Laufzeitkosten.
+//
+// Namen müssen String-Literale sein (es wird nur der Pointer gespeichert).
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+#ifdef TRACE_ENABLED
+
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 512   // Records (12 Bytes pro Record)
+#endif
+
+namespace Trace {
+
+  struct Record {
+    uint32_t cycles;
+    const char* name;
+    char phase;       // 'B' = begin, 'E' = end, 'i' = instant
+  };
+
+  inline Record ring[TRACE_BUFFER_SIZE];
+  inline uint16_t head = 0;      // Nächste Schreibposition
+  inline uint16_t used = 0;      // Anzahl gültiger Records
+  inline bool paused = false;    // Während des Exports keine neuen Records
+
+  inline void add(const char* name, char phase) {
+    if (paused) return;
+    Record& r = ring[head];
+    r.cycles = ESP.getCycleCount();
+    r.name = name;
+    r.phase = phase;
+    head = (head + 1) % TRACE_BUFFER_SIZE;
+    if (used < TRACE_BUFFER_SIZE) used++;
+  }
+
+  inline void clear() {
+    head = 0;
+    used = 0;
+  }
+
+  class Scope {
+   public:
+    explicit Scope(const char* name) : _name(name) { add(name, 'B'); }
+    ~Scope() { add(_name, 'E'); }
+   private:
+    const char* _name;
+  };
+
+  // Streamt den Puffer als Chrome Trace JSON über writeChunk(const char*).
+  // Zeitstempel werden aus Zyklen-Differenzen aufeinanderfolgender Records
+  // berechnet — das übersteht den Überlauf von getCycleCount() (~53 s bei 80 MHz),
+  // solange zwischen zwei Records kein kompletter Überlauf liegt.
+  template <typename WriteChunk>
+  void exportChromeJson(WriteChunk writeChunk) {
+    paused = true;
+    const uint32_t cyclesPerUs = ESP.getCpuFreqMHz();
+    char buf[256];
+    size_t len = 0;
+    writeChunk("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    uint16_t start = (head + TRACE_BUFFER_SIZE - used) % TRACE_BUFFER_SIZE;
+    uint64_t elapsedCycles = 0;
+    uint32_t prevCycles = used > 0 ? ring[start].cycles : 0;
+    for (uint16_t n = 0; n < used; n++) {
+      const Record& r = ring[(start + n) % TRACE_BUFFER_SIZE];
+      elapsedCycles += (uint32_t)(r.cycles - prevCycles);
+      prevCycles = r.cycles;
+      uint32_t us = (uint32_t)(elapsedCycles / cyclesPerUs);
+      uint32_t frac = (uint32_t)((elapsedCycles % cyclesPerUs) * 1000 / cyclesPerUs);
+      if (len > sizeof(buf) - 96) {
+        writeChunk(buf);
+        len = 0;
+      }
+      int w = snprintf(buf + len, sizeof(buf) - len,
+                       "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%u.%03u,\"pid\":1,\"tid\":1%s}",
+                       n > 0 ? "," : "", r.name, r.phase, us, frac,
+                       r.phase == 'i' ? ",\"s\":\"t\"" : "");
+      if (w > 0) len += w;
+    }
+    if (len > 0) writeChunk(buf);
+    writeChunk("]}");
+    paused = false;
+  }
+
+}  // namespace Trace
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name)
+#define TRACE_INSTANT(name) Trace::add(name, 'i')
+
+#else  // TRACE_ENABLED nicht gesetzt — alles entfällt
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_INSTANT(name) ((void)0)
+
+#endif  // TRACE_ENABLED
+
+#endif  // TRACE_H
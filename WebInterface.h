@@ -1135,11 +1135,26 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
           <label for="mqttTopic">MQTT Base-Topic</label>
           <input id="mqttTopic" type="text" placeholder="ikeaclock" value="ikeaclock" aria-label="MQTT Base-Topic">
         </div>
+        <div class="grid" style="margin-top: var(--spacing-2);">
+          <label class="checkbox-wrapper">
+            <input type="checkbox" id="mqttDeltaState" aria-label="State als Einzel-Topics publizieren">
+            <span>Nur Änderungen als Einzel-Topics</span>
+          </label>
+          <label class="checkbox-wrapper">
+            <input type="checkbox" id="mqttDiscovery" aria-label="Home Assistant Discovery aktivieren">
+            <span>Home Assistant Discovery</span>
+          </label>
+          <div>
+            <label for="mqttMinInterval">Mindestabstand State (ms)</label>
+            <input id="mqttMinInterval" type="number" min="0" max="60000" value="500" aria-label="Mindestabstand zwischen State-Publishes in Millisekunden" required>
+            <span class="input-error">Bitte einen Wert zwischen 0 und 60000 eingeben</span>
+          </div>
+        </div>
         <button id="saveMqtt" aria-label="MQTT Einstellungen speichern">MQTT Einstellungen speichern</button>
         <p class="caption" style="margin: var(--spacing-2) 0 0 0; line-height: 1.5;">
           <strong>Steuerung:</strong> Sende Commands an <code>&lt;baseTopic&gt;/cmd</code>:<br>
           <code>display:on</code> · <code>display:off</code> · <code>effect:clock</code> · <code>brightness:512</code> · <code>autobrightness:on</code><br>
-          <strong>Status:</strong> Wird als JSON (retained) auf <code>&lt;baseTopic&gt;/state</code> publiziert.<br>
+          <strong>Status:</strong> Wird als JSON (retained) auf <code>&lt;baseTopic&gt;/state</code> publiziert, mit „Einzel-Topics“ nur geänderte Felder auf <code>&lt;baseTopic&gt;/state/&lt;feld&gt;</code>.<br>
           <strong>Präsenz:</strong> Muss extern (z.B. in Home Assistant) auf das cmd-Topic gemappt werden.
         </p>
       </div>
@@ -1277,6 +1292,9 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
     const mqttUserInput = document.getElementById('mqttUser');
     const mqttPasswordInput = document.getElementById('mqttPassword');
     const mqttTopicInput = document.getElementById('mqttTopic');
+    const mqttDeltaStateCheckbox = document.getElementById('mqttDeltaState');
+    const mqttMinIntervalInput = document.getElementById('mqttMinInterval');
+    const mqttDiscoveryCheckbox = document.getElementById('mqttDiscovery');
     const saveMqttButton = document.getElementById('saveMqtt');
     const mqttStatusEl = document.getElementById('mqttStatus');
     const displayStatusEl = document.getElementById('displayStatus');
@@ -1396,6 +1414,15 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
         } else if (data.mqttTopic !== undefined) {
           mqttTopicInput.value = data.mqttTopic;
         }
+        if (data.mqttDeltaState !== undefined) {
+          mqttDeltaStateCheckbox.checked = data.mqttDeltaState;
+        }
+        if (data.mqttDiscovery !== undefined) {
+          mqttDiscoveryCheckbox.checked = data.mqttDiscovery;
+        }
+        if (data.mqttMinInterval !== undefined && !editingFields.has('mqttMinInterval')) {
+          mqttMinIntervalInput.value = data.mqttMinInterval;
+        }
         if (data.clockDur !== undefined) {
           syncSliderInput(scClockDurSlider, scClockDurInput, data.clockDur);
         }
@@ -1410,107 +1437,153 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
       }
     }
 
+    // Letzter bekannter Status: /api/status liefert alles, /api/events nur geänderte Felder
+    const statusState = {};
+
     async function refreshStatus() {
       try {
-        const data = await fetchJson('/api/status');
-
-        timeEl.textContent = data.time;
-        currentEffectEl.textContent = prettifyEffect(data.effect);
-        setActiveEffect(data.effect);
-        if (data.hourFormat || data.use24HourFormat !== undefined) {
-          const formatValue = data.hourFormat ? data.hourFormat : (data.use24HourFormat ? '24h' : '12h');
-          hourFormatSelect.value = formatValue.startsWith('12') ? '12' : '24';
-        }
+        applyStatus(await fetchJson('/api/status'));
+      } catch (error) {
+        showToast('Status konnte nicht geladen werden. ' + error.message, 'error');
+      }
+    }
 
-        updateBrightnessUI(data.brightness);
+    function applyStatus(delta) {
+      Object.assign(statusState, delta);
+      const data = statusState;
 
-        if (data.sensorValue !== undefined) {
-          sensorValueEl.textContent = data.sensorValue;
-        }
-        if (data.autoBrightness !== undefined) {
-          const status = data.autoBrightness ? 'An' : 'Aus';
-          autoStatusEl.textContent = status;
-          updateStatusBadge(autoStatusEl, data.autoBrightness ? 'success' : 'neutral', status);
-        }
+      timeEl.textContent = data.time;
+      currentEffectEl.textContent = prettifyEffect(data.effect);
+      setActiveEffect(data.effect);
+      if (data.hourFormat || data.use24HourFormat !== undefined) {
+        const formatValue = data.hourFormat ? data.hourFormat : (data.use24HourFormat ? '24h' : '12h');
+        hourFormatSelect.value = formatValue.startsWith('12') ? '12' : '24';
+      }
 
-        if (data.mqttConnected !== undefined) {
-          if (data.mqttConnected) {
-            mqttStatusEl.textContent = 'Verbunden';
-            updateStatusBadge(mqttStatusEl, 'success', 'Verbunden');
-          } else if (data.mqttEnabled) {
-            mqttStatusEl.textContent = 'Getrennt';
-            updateStatusBadge(mqttStatusEl, 'warning', 'Getrennt');
-          } else {
-            mqttStatusEl.textContent = 'Aus';
-            updateStatusBadge(mqttStatusEl, 'neutral', 'Aus');
-          }
-        }
+      updateBrightnessUI(data.brightness);
 
+      if (data.sensorValue !== undefined) {
+        sensorValueEl.textContent = data.sensorValue;
+      }
+      if (data.autoBrightness !== undefined) {
+        const status = data.autoBrightness ? 'An' : 'Aus';
+        autoStatusEl.textContent = status;
+        updateStatusBadge(autoStatusEl, data.autoBrightness ? 'success' : 'neutral', status);
+      }
 
-        if (data.displayEnabled !== undefined) {
-          const status = data.displayEnabled ? 'An' : 'Aus';
-          displayStatusEl.textContent = status;
-          updateStatusBadge(displayStatusEl, data.displayEnabled ? 'success' : 'error', status);
-        }
-        if (data.sensorTemp !== undefined && data.sensorTemp !== null) {
-          scTempDisplay.textContent = parseFloat(data.sensorTemp).toFixed(1);
+      if (data.mqttConnected !== undefined) {
+        if (data.mqttConnected) {
+          mqttStatusEl.textContent = 'Verbunden';
+          updateStatusBadge(mqttStatusEl, 'success', 'Verbunden');
+        } else if (data.mqttEnabled) {
+          mqttStatusEl.textContent = 'Getrennt';
+          updateStatusBadge(mqttStatusEl, 'warning', 'Getrennt');
         } else {
-          scTempDisplay.textContent = '--';
-        }
-        if (data.sensorHumi !== undefined && data.sensorHumi !== null) {
-          scHumiDisplay.textContent = parseFloat(data.sensorHumi).toFixed(1);
-        } else {
-          scHumiDisplay.textContent = '--';
+          mqttStatusEl.textContent = 'Aus';
+          updateStatusBadge(mqttStatusEl, 'neutral', 'Aus');
         }
+      }
 
-        if (data.otaEnabled !== undefined) {
-          const status = data.otaEnabled ? 'Aktiv' : 'Inaktiv';
-          otaStatusEl.textContent = status;
-          updateStatusBadge(otaStatusEl, data.otaEnabled ? 'success' : 'neutral', status);
-          if (data.otaHostname) {
-            otaStatusEl.title = 'Hostname: ' + data.otaHostname + (data.ipAddress ? ' | IP: ' + data.ipAddress : '');
-          }
-        }
 
-        if (data.ipAddress !== undefined) {
-          ipAddressEl.textContent = data.ipAddress;
-          ipAddressEl.title = 'IP-Adresse für OTA-Updates: ' + data.ipAddress;
-        }
+      if (data.displayEnabled !== undefined) {
+        const status = data.displayEnabled ? 'An' : 'Aus';
+        displayStatusEl.textContent = status;
+        updateStatusBadge(displayStatusEl, data.displayEnabled ? 'success' : 'error', status);
+      }
+      if (data.sensorTemp !== undefined && data.sensorTemp !== null) {
+        scTempDisplay.textContent = parseFloat(data.sensorTemp).toFixed(1);
+      } else {
+        scTempDisplay.textContent = '--';
+      }
+      if (data.sensorHumi !== undefined && data.sensorHumi !== null) {
+        scHumiDisplay.textContent = parseFloat(data.sensorHumi).toFixed(1);
+      } else {
+        scHumiDisplay.textContent = '--';
+      }
 
-        if (data.restartCount !== undefined) {
-          restartCountEl.textContent = data.restartCount;
-          restartCountEl.title = 'Anzahl der Neustarts seit letztem Reset des Counters';
+      if (data.otaEnabled !== undefined) {
+        const status = data.otaEnabled ? 'Aktiv' : 'Inaktiv';
+        otaStatusEl.textContent = status;
+        updateStatusBadge(otaStatusEl, data.otaEnabled ? 'success' : 'neutral', status);
+        if (data.otaHostname) {
+          otaStatusEl.title = 'Hostname: ' + data.otaHostname + (data.ipAddress ? ' | IP: ' + data.ipAddress : '');
         }
+      }
 
-        if (data.lastResetReason !== undefined) {
-          lastResetReasonEl.textContent = data.lastResetReason || '-';
-          lastResetReasonEl.title = 'Grund des letzten Neustarts';
-        }
-        if (data.lastUptimeBeforeRestart !== undefined) {
-          const uptimeEl = document.getElementById('lastUptimeBeforeRestart');
-          if (uptimeEl) {
-            if (data.lastUptimeBeforeRestartHours !== undefined && data.lastUptimeBeforeRestartMinutes !== undefined) {
-              uptimeEl.textContent = `${data.lastUptimeBeforeRestartHours}h ${data.lastUptimeBeforeRestartMinutes}m`;
-            } else {
-              uptimeEl.textContent = '-';
-            }
+      if (data.ipAddress !== undefined) {
+        ipAddressEl.textContent = data.ipAddress;
+        ipAddressEl.title = 'IP-Adresse für OTA-Updates: ' + data.ipAddress;
+      }
+
+      if (data.restartCount !== undefined) {
+        restartCountEl.textContent = data.restartCount;
+        restartCountEl.title = 'Anzahl der Neustarts seit letztem Reset des Counters';
+      }
+
+      if (data.lastResetReason !== undefined) {
+        lastResetReasonEl.textContent = data.lastResetReason || '-';
+        lastResetReasonEl.title = 'Grund des letzten Neustarts';
+      }
+      if (data.lastUptimeBeforeRestart !== undefined) {
+        const uptimeEl = document.getElementById('lastUptimeBeforeRestart');
+        if (uptimeEl) {
+          if (data.lastUptimeBeforeRestartHours !== undefined && data.lastUptimeBeforeRestartMinutes !== undefined) {
+            uptimeEl.textContent = `${data.lastUptimeBeforeRestartHours}h ${data.lastUptimeBeforeRestartMinutes}m`;
+          } else {
+            uptimeEl.textContent = '-';
           }
         }
-        if (data.lastHeapBeforeRestart !== undefined) {
-          const heapEl = document.getElementById('lastHeapBeforeRestart');
-          if (heapEl) {
-            if (data.lastHeapBeforeRestartKB !== undefined) {
-              heapEl.textContent = `${data.lastHeapBeforeRestartKB} KB`;
-            } else {
-              heapEl.textContent = '-';
-            }
+      }
+      if (data.lastHeapBeforeRestart !== undefined) {
+        const heapEl = document.getElementById('lastHeapBeforeRestart');
+        if (heapEl) {
+          if (data.lastHeapBeforeRestartKB !== undefined) {
+            heapEl.textContent = `${data.lastHeapBeforeRestartKB} KB`;
+          } else {
+            heapEl.textContent = '-';
           }
         }
-      } catch (error) {
-        showToast('Status konnte nicht geladen werden. ' + error.message, 'error');
       }
     }
 
+    // Live-Updates per Server-Sent Events; Polling nur, wenn /api/events nicht
+    // verfügbar ist (alter Browser, alle Event-Slots belegt, ältere Firmware)
+    let pollTimer = null;
+
+    function startPolling() {
+      if (!pollTimer) {
+        pollTimer = setInterval(refreshStatus, 2000);
+      }
+    }
+
+    function stopPolling() {
+      clearInterval(pollTimer);
+      pollTimer = null;
+    }
+
+    function startStatusUpdates() {
+      if (!window.EventSource) {
+        startPolling();
+        return;
+      }
+      const events = new EventSource('/api/events');
+      events.addEventListener('status', (e) => {
+        try {
+          applyStatus(JSON.parse(e.data));
+        } catch (error) {
+          console.warn('Ungültiges Status-Event', error);
+        }
+      });
+      events.onopen = () => stopPolling();
+      events.onerror = () => {
+        // CONNECTING: Browser verbindet selbst neu; CLOSED: Server hat abgelehnt
+        if (events.readyState === EventSource.CLOSED) {
+          startPolling();
+          setTimeout(startStatusUpdates, 30000);
+        }
+      };
+    }
+
     async function applyEffect(effect) {
       try {
         setButtonLoading(saveBrightnessButton, true);
@@ -1525,6 +1598,20 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
       }
     }
 
+    // Mehrere Einstellungen in einem Request (POST /api/batch): alles oder nichts
+    async function sendBatch(changes) {
+      const response = await fetch('/api/batch', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(changes)
+      });
+      if (!response.ok) {
+        const error = await response.json().catch(() => ({}));
+        throw new Error(error.error || 'HTTP ' + response.status);
+      }
+      return response.json();
+    }
+
     async function updateTimezone() {
       const tz = tzSelect.value.trim();
       const format = hourFormatSelect.value === '12' ? '12' : '24';
@@ -1534,14 +1621,7 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
       }
       try {
         setButtonLoading(setTzButton, true);
-        const responses = await Promise.all([
-          fetch('/api/setTimezone?tz=' + encodeURIComponent(tz)),
-          fetch('/api/setClockFormat?format=' + format)
-        ]);
-
-        if (responses.some(r => !r.ok)) {
-          throw new Error('Server hat die Einstellungen nicht akzeptiert.');
-        }
+        await sendBatch({ tz: tz, use24HourFormat: format === '24' });
         currentTimezoneEl.textContent = tz;
         showToast('Zeitzone und Zeitformat gespeichert.', 'success');
       } catch (error) {
@@ -1588,6 +1668,10 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
         showToast('Bitte einen gültigen Port eingeben.', 'error');
         return;
       }
+      if (!mqttMinIntervalInput.validity.valid) {
+        showToast('Bitte einen Mindestabstand zwischen 0 und 60000 ms eingeben.', 'error');
+        return;
+      }
 
       try {
         setButtonLoading(saveMqttButton, true);
@@ -1597,7 +1681,10 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
           port: mqttPortInput.value,
           user: mqttUserInput.value,
           password: mqttPasswordInput.value,
-          topic: mqttTopicInput.value
+          topic: mqttTopicInput.value,
+          deltaState: mqttDeltaStateCheckbox.checked ? 'true' : 'false',
+          minInterval: mqttMinIntervalInput.value,
+          discovery: mqttDiscoveryCheckbox.checked ? 'true' : 'false'
         });
         await fetch('/api/setMqtt?' + params.toString());
         showToast('MQTT Einstellungen gespeichert. Verbindung wird neu aufgebaut...', 'info');
@@ -1774,6 +1861,8 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
     mqttPortInput.addEventListener('blur', () => editingFields.delete('mqttPort'));
     mqttTopicInput.addEventListener('focus', () => editingFields.add('mqttTopic'));
     mqttTopicInput.addEventListener('blur', () => editingFields.delete('mqttTopic'));
+    mqttMinIntervalInput.addEventListener('focus', () => editingFields.add('mqttMinInterval'));
+    mqttMinIntervalInput.addEventListener('blur', () => editingFields.delete('mqttMinInterval'));
 
     saveMqttButton.addEventListener('click', () => {
       saveMqtt();
@@ -1872,7 +1961,7 @@ const char WEB_INTERFACE_HTML[] PROGMEM = R"rawl(
 
     loadSettings();
     refreshStatus();
-    setInterval(refreshStatus, 2000);
+    startStatusUpdates();
   </script>
 </body>
 </html>
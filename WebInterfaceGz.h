@@ -0,0 +1,808 @@
+// WebInterfaceGz.h — GENERIERT von tools/gen_web_gz.py, nicht von Hand ändern.
+// Quelle: WebInterface.h (69672 Bytes) -> gzip (12633 Bytes)
+//
+// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).
+#pragma once
+
+#include <Arduino.h>
+
+// SHA-1 (gekürzt) des unkomprimierten HTML, Teil des ETags
+#define WEB_INTERFACE_HASH "690d28fe185d"
+
+// Länge des unkomprimierten HTML — der Sketch prüft damit per static_assert,
+// ob diese Datei nach einer Änderung an WebInterface.h neu erzeugt wurde
+const size_t WEB_INTERFACE_HTML_LEN = 69672;
+
+const size_t WEB_INTERFACE_HTML_GZ_LEN = 12633;
+const uint8_t WEB_INTERFACE_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x7d, 0x5d, 0x93, 0x1b, 0x39,
+  0x92, 0xd8, 0xbb, 0x7e, 0x05, 0x86, 0xbb, 0x23, 0x92, 0xb7, 0x24, 0x9b, 0x64, 0x7f, 0xa8, 0xc5,
+  0xfe, 0x98, 0x93, 0x5a, 0xad, 0x1d, 0xed, 0x4a, 0x1a, 0x79, 0xba, 0xb5, 0xe3, 0xbd, 0xf5, 0x38,
+  0xb6, 0x48, 0x82, 0xcd, 0xda, 0x2e, 0x56, 0x71, 0xab, 0x8a, 0xfd, 0xa5, 0x95, 0xe3, 0x1e, 0xee,
+  0xc9, 0x71, 0x8e, 0x73, 0xf8, 0x63, 0x23, 0xec, 0xb8, 0xf0, 0xda, 0x11, 0xeb, 0x08, 0xbf, 0xfa,
+  0xe5, 0xec, 0x87, 0x09, 0x3f, 0x58, 0xff, 0x64, 0xfe, 0x80, 0xef, 0x27, 0x5c, 0x26, 0x80, 0xaa,
+  0x02, 0x50, 0x40, 0x7d, 0xb0, 0x29, 0xcd, 0xde, 0xf9, 0x3e, 0x46, 0xec, 0x02, 0x90, 0xc8, 0x4c,
+  0x24, 0x12, 0x89, 0x44, 0x22, 0xf1, 0xe0, 0xf0, 0xb3, 0x67, 0x5f, 0x9d, 0x9c, 0xff, 0xf2, 0xcd,
+  0x29, 0x99, 0xc7, 0x0b, 0xef, 0xf8, 0xc1, 0x21, 0xfe, 0x43, 0x3c, 0xc7, 0xbf, 0x38, 0x6a, 0x4c,
+  0x69, 0x03, 0x3f, 0x50, 0x67, 0x7a, 0xfc, 0x80, 0x90, 0xc3, 0x05, 0x8d, 0x1d, 0x32, 0x99, 0x3b,
+  0x61, 0x44, 0xe3, 0xa3, 0xc6, 0xdb, 0xf3, 0xe7, 0xdd, 0xfd, 0x46, 0x56, 0xe0, 0x3b, 0x0b, 0x7a,
+  0xd4, 0xb8, 0x72, 0xe9, 0xf5, 0x32, 0x08, 0xe3, 0x06, 0x99, 0x04, 0x7e, 0x4c, 0x7d, 0xa8, 0x78,
+  0xed, 0x4e, 0xe3, 0xf9, 0xd1, 0x94, 0x5e, 0xb9, 0x13, 0xda, 0x65, 0x7f, 0x74, 0x88, 0xeb, 0xbb,
+  0xb1, 0xeb, 0x78, 0xdd, 0x68, 0xe2, 0x78, 0xf4, 0x68, 0xc0, 0xc1, 0xc4, 0x6e, 0xec, 0xd1, 0xe3,
+  0x17, 0x3f, 0x3f, 0x7d, 0x42, 0x3e, 0xfc, 0x7e, 0x4c, 0x2f, 0xc2, 0x0f, 0x7f, 0xf4, 0x23, 0x67,
+  0x7a, 0xb8, 0xc5, 0x0b, 0xb0, 0x4a, 0x14, 0xdf, 0xf2, 0x5f, 0x84, 0x8c, 0xc2, 0x20, 0x88, 0xc9,
+  0x3b, 0xf6, 0x9b, 0x40, 0x6f, 0x5e, 0x10, 0x02, 0xb8, 0x39, 0x5d, 0xd0, 0x11, 0x99, 0x3a, 0xe1,
+  0xe5, 0x81, 0x28, 0xe9, 0x76, 0xc7, 0x17, 0x23, 0x12, 0x3a, 0x53, 0xec, 0xef, 0x02, 0xff, 0x05,
+  0xac, 0x5a, 0x13, 0x37, 0x9c, 0x78, 0x94, 0x38, 0x31, 0x89, 0x83, 0x65, 0x87, 0xfc, 0x68, 0x30,
+  0x1d, 0xcc, 0x86, 0x33, 0xf8, 0xd1, 0x7f, 0xdc, 0x1f, 0x0f, 0x76, 0xc8, 0xee, 0xee, 0xe7, 0xf8,
+  0xc7, 0x6e, 0x7f, 0xaf, 0x3f, 0x26, 0x83, 0x7e, 0xff, 0xf3, 0x76, 0x06, 0x6f, 0xe2, 0x84, 0x53,
+  0x0e, 0xf4, 0x62, 0xec, 0xb4, 0x06, 0xfb, 0x1d, 0x32, 0xec, 0x77, 0xc8, 0xf6, 0xb0, 0x43, 0xfa,
+  0xbd, 0xc7, 0xf9, 0x7a, 0xdd, 0x79, 0x70, 0x45, 0x43, 0x73, 0xed, 0x5d, 0xa9, 0xba, 0x33, 0x99,
+  0x00, 0x66, 0x23, 0xf2, 0xa3, 0xdd, 0xf1, 0xa4, 0x4f, 0xc7, 0x7a, 0x41, 0x37, 0x8a, 0xc3, 0xc0,
+  0x87, 0x5e, 0x7f, 0xb4, 0xe3, 0x38, 0xdb, 0x93, 0xc7, 0xb9, 0x72, 0xd1, 0xcd, 0x8f, 0xf6, 0xa6,
+  0xd3, 0xfe, 0x6c, 0x37, 0x2b, 0x8e, 0x56, 0x50, 0x1e, 0x45, 0xac, 0xe1, 0x94, 0xee, 0xf7, 0xb3,
+  0x92, 0x6b, 0x27, 0xf4, 0x5d, 0x06, 0x72, 0x36, 0x1e, 0xcf, 0x86, 0x3b, 0x59, 0x09, 0x0d, 0xc3,
+  0x00, 0x61, 0xcd, 0xf6, 0x1f, 0x0d, 0x1e, 0x0d, 0xb2, 0xef, 0x31, 0xbd, 0x41, 0x0c, 0x67, 0xbb,
+  0xb3, 0x47, 0xb3, 0x99, 0xfa, 0xb9, 0x1b, 0x51, 0x18, 0x72, 0xe0, 0xfc, 0x2d, 0x54, 0x98, 0x0e,
+  0xa6, 0xbb, 0x74, 0x3f, 0xab, 0xb0, 0x58, 0xc5, 0x74, 0x0a, 0xdf, 0x9d, 0x7d, 0x67, 0x3a, 0xd9,
+  0xd1, 0xbe, 0x77, 0x71, 0xb8, 0x10, 0xf1, 0xf1, 0xa3, 0xa1, 0x8c, 0xde, 0x38, 0x08, 0xa7, 0x29,
+  0xe3, 0x86, 0xbb, 0xbb, 0xc0, 0xb9, 0xf4, 0x3f, 0xfd, 0xde, 0xa0, 0xad, 0xd7, 0xec, 0x7a, 0xee,
+  0xc5, 0x3c, 0xb6, 0xd6, 0x97, 0x79, 0x1d, 0xcd, 0x9d, 0x69, 0x70, 0x3d, 0x22, 0x7d, 0xb2, 0xbf,
+  0xbc, 0x21, 0xc3, 0x1d, 0xf8, 0x0f, 0x6b, 0x05, 0x35, 0x61, 0x80, 0x06, 0x7b, 0xd8, 0x60, 0x27,
+  0x57, 0xbf, 0xeb, 0x5d, 0x60, 0x93, 0xc1, 0x1e, 0x54, 0xdf, 0xd9, 0x37, 0xb5, 0xd9, 0xcb, 0xb7,
+  0x89, 0x16, 0xd8, 0x66, 0x08, 0xb5, 0x8d, 0x2d, 0xb6, 0xa5, 0x16, 0x28, 0x9c, 0x2b, 0x18, 0xa8,
+  0x01, 0xd4, 0xd6, 0xbf, 0x32, 0x38, 0xfb, 0x86, 0xef, 0x88, 0x13, 0x62, 0x24, 0x75, 0xbc, 0x74,
+  0x26, 0x30, 0xac, 0xdd, 0x01, 0x74, 0xdc, 0xdb, 0x0d, 0xe9, 0x22, 0x5f, 0x34, 0x84, 0x36, 0xc6,
+  0x82, 0x6d, 0x28, 0xb0, 0xb4, 0xd9, 0x19, 0x91, 0xa1, 0xb1, 0x60, 0x17, 0x0a, 0x2c, 0x6d, 0xf6,
+  0x46, 0x64, 0x5b, 0x2a, 0x98, 0x81, 0x4e, 0xe8, 0xce, 0x9c, 0x85, 0xeb, 0x81, 0x90, 0x34, 0x5e,
+  0x80, 0x82, 0x08, 0x1b, 0x1d, 0xd2, 0x38, 0xa3, 0x17, 0x01, 0x25, 0x6f, 0x5f, 0xc0, 0xef, 0xe8,
+  0x36, 0x8a, 0xe9, 0xa2, 0xbb, 0x72, 0x3b, 0xa4, 0xeb, 0x2c, 0x97, 0x1e, 0xed, 0xf2, 0x2f, 0x50,
+  0xe2, 0xf8, 0xc0, 0x04, 0x1a, 0xba, 0x42, 0xee, 0xde, 0x3f, 0x60, 0xff, 0xfc, 0x59, 0xaa, 0x02,
+  0xc6, 0xc1, 0x4d, 0x37, 0x72, 0xef, 0x98, 0x40, 0x0b, 0x81, 0x80, 0x4f, 0x49, 0xd7, 0x0b, 0x27,
+  0xbc, 0x70, 0x7d, 0xe0, 0x48, 0xf2, 0x61, 0xe9, 0x4c, 0xa7, 0xac, 0x6e, 0x5f, 0x81, 0x37, 0x0e,
+  0xa6, 0xb7, 0x29, 0xc8, 0x5c, 0xa3, 0x85, 0xeb, 0x77, 0xe7, 0x94, 0x8b, 0x19, 0x68, 0x85, 0xab,
+  0x79, 0x52, 0x30, 0x75, 0xa3, 0xa5, 0xe7, 0x00, 0x55, 0x33, 0x8f, 0xa6, 0x7d, 0x3a, 0x20, 0x90,
+  0x7e, 0xd7, 0x05, 0xf4, 0x61, 0x50, 0x71, 0x8e, 0xd2, 0x30, 0x29, 0xfa, 0xcd, 0x2a, 0x8a, 0xdd,
+  0xd9, 0x6d, 0x57, 0x68, 0x49, 0xbd, 0x38, 0x45, 0xee, 0xca, 0x09, 0x5b, 0xd2, 0xe8, 0xb4, 0xb5,
+  0x0f, 0xc3, 0x54, 0x7a, 0xc6, 0xce, 0xe4, 0xf2, 0x22, 0x0c, 0x56, 0xfe, 0x34, 0x69, 0x34, 0xbe,
+  0x48, 0x0b, 0x99, 0x76, 0x4c, 0xbe, 0xe3, 0x64, 0x4d, 0x4b, 0x3c, 0xd7, 0xa7, 0x19, 0x45, 0xbd,
+  0x3d, 0x65, 0xa4, 0x80, 0x9b, 0x54, 0x16, 0x14, 0xc1, 0xa2, 0x85, 0xe3, 0xfa, 0x29, 0x8b, 0x98,
+  0x42, 0x1f, 0x21, 0x63, 0x5a, 0xc0, 0x90, 0xfe, 0xf2, 0xa6, 0xa3, 0xaa, 0xcb, 0x85, 0x73, 0xd3,
+  0x15, 0x75, 0x1e, 0xef, 0x5e, 0x5d, 0xdb, 0xd1, 0x15, 0xda, 0x32, 0x23, 0x88, 0x0f, 0x61, 0x32,
+  0x27, 0x78, 0xa5, 0x54, 0xe6, 0xa5, 0x6a, 0x37, 0xe9, 0x6c, 0x16, 0xbc, 0x49, 0xe6, 0xaa, 0x06,
+  0x0a, 0x28, 0x81, 0x09, 0x18, 0x05, 0x9e, 0x3b, 0x4d, 0x38, 0xc4, 0xbe, 0x2b, 0x2c, 0x9c, 0x86,
+  0xc1, 0xb2, 0x3b, 0x73, 0xbd, 0x18, 0xeb, 0x8f, 0xbd, 0x55, 0xd8, 0xc2, 0xb9, 0xd5, 0xce, 0x8d,
+  0xcb, 0xc4, 0x73, 0x16, 0xcb, 0x96, 0x3e, 0x3a, 0x1d, 0xb2, 0x73, 0x75, 0xdd, 0xd1, 0xc6, 0x68,
+  0xb7, 0xdd, 0x56, 0xd8, 0x37, 0x1f, 0xd8, 0xe5, 0x4b, 0x62, 0x3b, 0xef, 0x61, 0xd0, 0x7b, 0x84,
+  0x33, 0x4b, 0x00, 0x1e, 0xf6, 0x86, 0xf8, 0x57, 0x36, 0x7a, 0x34, 0x06, 0x44, 0x93, 0x9e, 0x46,
+  0xa4, 0xdb, 0xef, 0xf5, 0x87, 0xda, 0x74, 0xbb, 0x16, 0x83, 0xfb, 0xa8, 0xdf, 0xb7, 0x0c, 0xfa,
+  0xb0, 0x4c, 0x4c, 0x12, 0xc4, 0x87, 0x95, 0x10, 0x1f, 0x70, 0x24, 0x6b, 0x22, 0xb1, 0x5d, 0x15,
+  0x89, 0xed, 0x8a, 0x48, 0x0c, 0x6c, 0x38, 0xec, 0x59, 0x71, 0xd8, 0xa9, 0x88, 0x43, 0x2f, 0x5a,
+  0x8d, 0x99, 0x4d, 0xa2, 0x9a, 0x1f, 0x49, 0x03, 0xb6, 0xa8, 0xb5, 0x0d, 0x48, 0xf5, 0x7b, 0xfb,
+  0x8f, 0xac, 0xac, 0xd9, 0xb1, 0xa2, 0xb5, 0xab, 0xea, 0xb0, 0x2e, 0x58, 0x2c, 0xba, 0x62, 0x18,
+  0x68, 0x08, 0x4e, 0x9c, 0x65, 0xec, 0x06, 0xd9, 0x2c, 0x55, 0x90, 0x50, 0x70, 0x28, 0xc0, 0xdc,
+  0xcc, 0x9d, 0x64, 0x1c, 0xc0, 0x2a, 0xa4, 0x61, 0xda, 0x81, 0x51, 0xff, 0xe1, 0xef, 0xee, 0xd4,
+  0x0d, 0xe9, 0x04, 0x91, 0x19, 0x61, 0x5f, 0xab, 0x85, 0x9f, 0x94, 0x5e, 0x38, 0x56, 0x32, 0x08,
+  0x61, 0x16, 0x05, 0xd3, 0x9f, 0x23, 0x90, 0xf2, 0x59, 0xac, 0xb1, 0x60, 0x1c, 0xc4, 0x71, 0xb0,
+  0xd0, 0x9b, 0xef, 0xe8, 0xc3, 0x14, 0x3b, 0x31, 0x68, 0x8b, 0xa9, 0x13, 0xcd, 0xc7, 0x01, 0xa8,
+  0x97, 0x3c, 0xb6, 0x17, 0xa1, 0x3b, 0x4d, 0xf1, 0x81, 0xdf, 0x30, 0xd8, 0x0b, 0x28, 0x89, 0x69,
+  0x97, 0xe3, 0x0a, 0x8a, 0x27, 0xa4, 0x4b, 0xea, 0xc4, 0x2d, 0x67, 0x15, 0x07, 0xa0, 0x18, 0xe2,
+  0x0e, 0xaa, 0x3a, 0x50, 0x6a, 0xad, 0xc1, 0x0e, 0x57, 0x76, 0xb3, 0xb0, 0xdd, 0x2e, 0x20, 0x69,
+  0xd8, 0xbe, 0x0f, 0xea, 0xb8, 0x76, 0x7c, 0x34, 0x1e, 0x5b, 0x16, 0x99, 0x61, 0x15, 0x15, 0xbc,
+  0x8e, 0x6e, 0x4d, 0xf4, 0x3d, 0xb3, 0x81, 0x1e, 0xe3, 0x3a, 0x01, 0xff, 0xbf, 0xaf, 0x9a, 0x5a,
+  0x71, 0x08, 0xcb, 0xbc, 0xcb, 0x49, 0x71, 0x3c, 0x0f, 0xca, 0x86, 0xbb, 0x11, 0x99, 0xac, 0xc6,
+  0xee, 0xa4, 0x3b, 0xa6, 0x77, 0x2e, 0x0d, 0x5b, 0x50, 0x1d, 0xda, 0x60, 0x33, 0xb0, 0xa1, 0x25,
+  0x6a, 0x82, 0xa4, 0x5d, 0x48, 0x61, 0x04, 0xdd, 0x2b, 0x9a, 0x94, 0xa0, 0x5d, 0x3c, 0xf3, 0x70,
+  0x81, 0x98, 0xbb, 0xd3, 0x29, 0xf5, 0xad, 0x9c, 0x1e, 0x8d, 0xc6, 0x74, 0x16, 0x84, 0xf2, 0xb4,
+  0x16, 0xab, 0x73, 0xb3, 0x99, 0xef, 0xc6, 0x19, 0x03, 0xbd, 0x30, 0x61, 0x52, 0xd4, 0x71, 0x5a,
+  0x66, 0x73, 0x18, 0x84, 0x56, 0xfa, 0x33, 0xe4, 0xb3, 0x28, 0xfd, 0x3b, 0x99, 0x56, 0x92, 0xa5,
+  0x27, 0xb3, 0x08, 0xa7, 0x9e, 0x13, 0x66, 0xdb, 0x95, 0xc7, 0xfd, 0x29, 0xbd, 0x48, 0x16, 0x16,
+  0x6e, 0xef, 0xb7, 0xd5, 0x3f, 0xc5, 0xf6, 0x20, 0x93, 0xc5, 0x00, 0x87, 0x33, 0xbe, 0x95, 0xfa,
+  0x94, 0x79, 0x2b, 0x4a, 0x05, 0x7f, 0xa9, 0x13, 0x51, 0x3b, 0x57, 0xd8, 0xc6, 0x22, 0xe5, 0x09,
+  0x83, 0x02, 0x5c, 0x02, 0x11, 0x66, 0x3f, 0x71, 0xb6, 0xfc, 0xb2, 0xd5, 0x1d, 0x4a, 0xab, 0xa4,
+  0x6d, 0x4d, 0xd6, 0x05, 0x4b, 0xd1, 0x3d, 0xb2, 0x0d, 0x5f, 0x51, 0x6c, 0x76, 0xdb, 0x25, 0x48,
+  0xe7, 0x06, 0x34, 0x65, 0xca, 0xc0, 0xd8, 0xd2, 0x73, 0xc6, 0xd4, 0x33, 0x2b, 0xcd, 0xbd, 0xfd,
+  0xaa, 0x6a, 0x93, 0xa9, 0x2e, 0x89, 0x4b, 0xab, 0xe5, 0x92, 0x86, 0x93, 0x94, 0xc3, 0xf9, 0x55,
+  0x1b, 0x16, 0xed, 0xfd, 0xf2, 0xb5, 0xaa, 0xae, 0x85, 0x59, 0x30, 0xf5, 0x8d, 0x54, 0x43, 0x25,
+  0x7f, 0x34, 0x73, 0xc3, 0x28, 0xee, 0x4e, 0xe6, 0xae, 0x37, 0x35, 0xb1, 0x41, 0x59, 0x53, 0x85,
+  0x91, 0x04, 0x32, 0x7a, 0xcb, 0xb6, 0xf1, 0xad, 0x6c, 0x33, 0xa3, 0x75, 0x70, 0xe5, 0x78, 0x2b,
+  0x6a, 0x84, 0xd7, 0xdb, 0x7e, 0x54, 0xc5, 0x56, 0xb0, 0xdb, 0xaf, 0xac, 0x05, 0x7c, 0x77, 0x1d,
+  0xf8, 0xd7, 0x5f, 0x2d, 0x60, 0x7f, 0x30, 0x01, 0xc1, 0x74, 0xc6, 0x2b, 0x0f, 0xe6, 0x0f, 0x7c,
+  0x88, 0x4c, 0xd2, 0xcf, 0xe0, 0xa1, 0xec, 0x17, 0x88, 0xfe, 0xd8, 0x99, 0x5e, 0xd0, 0xbc, 0xee,
+  0x75, 0x7d, 0xb6, 0x2c, 0xd6, 0x19, 0x84, 0xbe, 0x46, 0x65, 0xb6, 0xf3, 0x10, 0x05, 0x28, 0x5e,
+  0x8a, 0xcd, 0x54, 0x64, 0xfb, 0x46, 0x0b, 0xb3, 0x69, 0xb1, 0x57, 0x60, 0x5b, 0x48, 0x62, 0xb4,
+  0x8e, 0x74, 0xee, 0x66, 0x60, 0x0d, 0xfa, 0x59, 0xe6, 0xa1, 0x5d, 0x0d, 0x9b, 0xb8, 0x5b, 0x45,
+  0xdf, 0x8a, 0xbd, 0x83, 0xb4, 0xc1, 0x4d, 0x54, 0xa7, 0xf4, 0x49, 0xe3, 0xd7, 0x6e, 0xff, 0x73,
+  0x93, 0x02, 0x99, 0xac, 0xc2, 0x10, 0xa0, 0x9f, 0xe0, 0xe0, 0xe7, 0xb5, 0x64, 0x2f, 0x75, 0x57,
+  0x38, 0xbe, 0xbb, 0x70, 0x38, 0x0d, 0xcb, 0x95, 0x17, 0x51, 0x22, 0x48, 0xec, 0xc2, 0xea, 0x1d,
+  0xac, 0x62, 0x10, 0x81, 0x19, 0xfa, 0xaf, 0x54, 0xc2, 0xfe, 0xfc, 0x92, 0xde, 0xce, 0x42, 0x67,
+  0x41, 0x23, 0xd1, 0x28, 0xa1, 0xa9, 0xff, 0x39, 0xdf, 0x11, 0x91, 0x77, 0x6a, 0x67, 0xb2, 0x22,
+  0xe5, 0xf3, 0x07, 0xa6, 0x27, 0x40, 0xe3, 0xad, 0x76, 0xd5, 0x06, 0x03, 0x53, 0xf5, 0x5e, 0xd6,
+  0x20, 0xe1, 0x2e, 0x63, 0x6b, 0xe2, 0xf1, 0xc9, 0x76, 0xc6, 0xba, 0x16, 0x7d, 0x04, 0x2b, 0xe8,
+  0x70, 0x88, 0xcb, 0xe7, 0x70, 0x5f, 0xf3, 0x8d, 0x28, 0x53, 0x4d, 0x00, 0x2a, 0x58, 0xec, 0x8d,
+  0xe0, 0x86, 0xba, 0x62, 0xe6, 0x68, 0x09, 0x77, 0x93, 0x1d, 0xad, 0xe1, 0xee, 0x00, 0x60, 0x3c,
+  0x86, 0xff, 0x6c, 0xef, 0x15, 0xa1, 0x25, 0x00, 0x95, 0xa1, 0xa5, 0x83, 0xb3, 0xa0, 0xc5, 0x7c,
+  0x5d, 0x05, 0x48, 0xed, 0xa0, 0xaf, 0x66, 0xb0, 0x2d, 0xfe, 0x63, 0xc7, 0x8a, 0xc1, 0x29, 0xc5,
+  0x49, 0x87, 0x66, 0x41, 0x0a, 0x64, 0x2c, 0xb0, 0xe3, 0xf4, 0x98, 0x11, 0x06, 0x0c, 0x1f, 0x6e,
+  0xef, 0x16, 0xa1, 0x24, 0x2c, 0x85, 0x12, 0x9c, 0x74, 0x68, 0x16, 0x94, 0x7c, 0xba, 0x02, 0x19,
+  0xf4, 0xec, 0x58, 0x0d, 0xf6, 0x90, 0xb6, 0x47, 0x48, 0xdb, 0xe3, 0x3d, 0xd5, 0x45, 0x57, 0xb0,
+  0x5c, 0x5a, 0x90, 0xca, 0x03, 0x2b, 0xc4, 0x2a, 0xa7, 0x4a, 0x52, 0x85, 0xed, 0x07, 0x3e, 0xd5,
+  0x37, 0x47, 0xa6, 0xad, 0xc0, 0xbd, 0x8c, 0xea, 0xed, 0x76, 0xa9, 0xe7, 0xe6, 0x07, 0x34, 0xaa,
+  0x0b, 0x77, 0x1e, 0xdb, 0x46, 0xdb, 0x5b, 0xb6, 0xd0, 0x32, 0x25, 0xdf, 0x91, 0xba, 0xb4, 0x2d,
+  0x9f, 0xc8, 0x5d, 0xcd, 0x64, 0xfc, 0x48, 0xe6, 0x1e, 0xf3, 0x18, 0x55, 0xd9, 0x87, 0xd6, 0xf1,
+  0xc3, 0x21, 0x5b, 0x28, 0x6c, 0x35, 0xe2, 0x6b, 0x4a, 0xfd, 0x4a, 0x0c, 0x1c, 0x98, 0xd0, 0x52,
+  0xdd, 0x03, 0xaa, 0x63, 0xa2, 0x92, 0x7b, 0x24, 0xe7, 0xdc, 0x28, 0xf3, 0x49, 0xc0, 0x5c, 0x07,
+  0x96, 0xca, 0x9b, 0xfe, 0xaa, 0x52, 0x54, 0x45, 0x20, 0x37, 0x21, 0x69, 0xd9, 0xc6, 0xd2, 0xbc,
+  0x23, 0xdb, 0x94, 0x04, 0xa6, 0x9c, 0x58, 0x4f, 0x0c, 0x73, 0x60, 0x3e, 0x8d, 0x8c, 0x59, 0x77,
+  0xe3, 0xd6, 0xf9, 0x0a, 0xf6, 0x4c, 0x84, 0x94, 0x2c, 0x03, 0x57, 0xee, 0x6e, 0x15, 0xa1, 0xf9,
+  0x46, 0x3d, 0x50, 0x5e, 0xb2, 0xf6, 0xd3, 0xb8, 0x6b, 0xe5, 0xa2, 0x49, 0xb1, 0x2b, 0x87, 0x56,
+  0xdb, 0x25, 0x7c, 0xe2, 0x5c, 0xef, 0x58, 0x0a, 0x67, 0xc1, 0x04, 0x77, 0x04, 0x6e, 0xe4, 0x8e,
+  0xa5, 0x09, 0x52, 0xd2, 0x65, 0xb6, 0xbc, 0x81, 0xfd, 0x85, 0xf6, 0xb7, 0x49, 0xad, 0x57, 0xed,
+  0x4a, 0xda, 0x9c, 0xba, 0x7e, 0x44, 0x63, 0xd2, 0x67, 0xff, 0x8b, 0x27, 0x34, 0x86, 0x55, 0xd3,
+  0x2a, 0x0d, 0x55, 0x1d, 0x91, 0x15, 0x6c, 0xf2, 0xca, 0x53, 0xbb, 0xeb, 0x4e, 0xa4, 0xf9, 0x2d,
+  0x8f, 0x67, 0x6a, 0x1d, 0xe2, 0x00, 0x55, 0x73, 0x98, 0x58, 0x90, 0x2c, 0x32, 0x20, 0x54, 0x8f,
+  0xa0, 0x05, 0xc9, 0x5e, 0xb0, 0xa4, 0x7e, 0x31, 0xd2, 0xdc, 0x8c, 0x0d, 0x03, 0xd8, 0x0b, 0x80,
+  0x1d, 0xbb, 0x8f, 0xce, 0x0d, 0x2b, 0xc9, 0x62, 0xd6, 0x48, 0xcc, 0xbe, 0x49, 0x51, 0xe8, 0xd7,
+  0x51, 0x28, 0x59, 0x43, 0xe4, 0x51, 0x89, 0x57, 0xa9, 0x93, 0xcc, 0x47, 0x51, 0x57, 0xd9, 0xe2,
+  0xa4, 0xfb, 0x37, 0xcb, 0xd4, 0x2c, 0x67, 0x49, 0x11, 0x51, 0xdb, 0xec, 0x18, 0xa5, 0xa2, 0x3d,
+  0x91, 0x74, 0x45, 0x67, 0x33, 0x98, 0xef, 0x5d, 0xf4, 0x61, 0x6e, 0xc0, 0xcb, 0xe9, 0x79, 0x99,
+  0x9b, 0x73, 0xb8, 0x9e, 0x9b, 0xd3, 0xe0, 0xa4, 0x1e, 0x9a, 0x71, 0x56, 0xcc, 0x31, 0x27, 0x5a,
+  0xe2, 0xb7, 0x10, 0xf7, 0x5f, 0xa9, 0x88, 0xad, 0x65, 0xa5, 0x6d, 0xfc, 0xf0, 0x6d, 0x3d, 0xbf,
+  0xe8, 0xb0, 0xa6, 0x09, 0xa7, 0x2a, 0xbe, 0xbd, 0x32, 0x65, 0xbf, 0xbe, 0xbf, 0x54, 0xf6, 0xb0,
+  0xab, 0xf4, 0xd7, 0x55, 0x53, 0xeb, 0xfb, 0x5e, 0x25, 0x09, 0xf8, 0x84, 0xbe, 0xd7, 0xc4, 0x3a,
+  0xe9, 0x57, 0xf1, 0xbc, 0x82, 0xfc, 0x7f, 0x62, 0xd7, 0xab, 0xcc, 0x94, 0x4a, 0xae, 0xd7, 0x9d,
+  0xe5, 0x4d, 0x3b, 0xf5, 0x09, 0xf4, 0x87, 0x85, 0x5e, 0xd6, 0xdc, 0x8e, 0xf0, 0xc6, 0x1a, 0x0b,
+  0x51, 0xba, 0x2d, 0xcc, 0x21, 0x6a, 0x77, 0xb7, 0xc2, 0xf6, 0xcd, 0xde, 0xd6, 0xbc, 0x4e, 0x1b,
+  0x56, 0xfa, 0x35, 0x48, 0xc2, 0xff, 0xdd, 0xb6, 0x51, 0xb4, 0x6d, 0x27, 0x08, 0x74, 0x35, 0x8a,
+  0x71, 0xa1, 0xed, 0xa8, 0x77, 0x5c, 0x63, 0x97, 0x5e, 0x03, 0xc9, 0x21, 0x48, 0x5b, 0x9f, 0xe0,
+  0xa8, 0x60, 0x58, 0x48, 0x09, 0x64, 0x3b, 0x25, 0x85, 0x63, 0xb3, 0x6b, 0x57, 0xcc, 0xe8, 0x16,
+  0x4e, 0xdb, 0xd8, 0xe7, 0xf9, 0x5d, 0xd7, 0xf5, 0xa7, 0xf4, 0x46, 0xb7, 0x0a, 0x0c, 0x0e, 0xf5,
+  0x22, 0xd7, 0xf6, 0xd8, 0x0b, 0x26, 0x97, 0xb5, 0x36, 0x5d, 0xa5, 0xbe, 0x61, 0xd3, 0xc9, 0xab,
+  0x40, 0x8e, 0xdb, 0xc8, 0xdc, 0x50, 0x75, 0xfd, 0xe5, 0x2a, 0xfe, 0x55, 0x7c, 0xbb, 0xa4, 0x47,
+  0x0d, 0x04, 0xd2, 0xf8, 0x36, 0xff, 0xdd, 0x5f, 0x2d, 0xc6, 0x34, 0x34, 0x95, 0x2c, 0x9d, 0x28,
+  0xba, 0x06, 0x09, 0x49, 0xca, 0xc6, 0x2b, 0xc0, 0x39, 0x17, 0x23, 0x81, 0x5e, 0x40, 0x83, 0x0f,
+  0x98, 0xbb, 0x80, 0x07, 0xf5, 0xdd, 0xbf, 0xeb, 0x7a, 0x09, 0xd4, 0x25, 0xe6, 0x51, 0x5d, 0x4e,
+  0x3e, 0x36, 0xf8, 0xec, 0x93, 0x98, 0x1e, 0xd7, 0x9f, 0xd3, 0xd0, 0x8d, 0x2b, 0x7b, 0x8b, 0xe5,
+  0x78, 0x9a, 0x9d, 0x9d, 0xc4, 0xea, 0x51, 0xc6, 0x87, 0xab, 0x07, 0xdb, 0x28, 0xd9, 0x4a, 0x93,
+  0xb1, 0xb2, 0x95, 0x67, 0x23, 0xc6, 0x6b, 0x7c, 0x4a, 0xb5, 0x33, 0xac, 0x3a, 0x34, 0xfb, 0xda,
+  0xb4, 0x66, 0x04, 0x8c, 0x5c, 0xff, 0xca, 0xf1, 0x24, 0x33, 0xcf, 0x84, 0x9c, 0xec, 0x8b, 0x34,
+  0x35, 0xd6, 0x88, 0x2e, 0x40, 0x3e, 0xef, 0xb0, 0xd4, 0x54, 0x0d, 0x83, 0xab, 0x39, 0x51, 0x0b,
+  0xfc, 0xa2, 0xf6, 0x48, 0x04, 0xd9, 0x70, 0xec, 0xab, 0x31, 0x24, 0x76, 0x67, 0x9e, 0xca, 0x92,
+  0x7f, 0x65, 0x46, 0xc7, 0xa4, 0x5f, 0x92, 0x70, 0x2f, 0x75, 0xa6, 0x5a, 0xac, 0x2c, 0x6b, 0xfc,
+  0x48, 0xfe, 0xac, 0x64, 0x20, 0x4d, 0xe3, 0x0d, 0x9b, 0x15, 0xc9, 0x7c, 0x97, 0x25, 0x53, 0x70,
+  0x5a, 0x44, 0xaa, 0xde, 0xd3, 0x1e, 0xe3, 0xcc, 0xd8, 0xbc, 0x25, 0xd6, 0x95, 0x35, 0x9f, 0x41,
+  0x19, 0x4a, 0x11, 0x75, 0x9f, 0xd7, 0x38, 0x0d, 0x67, 0xda, 0x65, 0xe9, 0xe0, 0x99, 0x4e, 0xc7,
+  0x12, 0xf4, 0x89, 0x8b, 0xa7, 0x54, 0xcd, 0xe8, 0xea, 0x44, 0x1c, 0xd1, 0xc7, 0x60, 0xb0, 0xc5,
+  0x04, 0x43, 0xb8, 0x71, 0xe3, 0x07, 0x71, 0x6b, 0x04, 0xa2, 0xe4, 0x80, 0x95, 0x32, 0x6d, 0xe7,
+  0xb8, 0xc4, 0x49, 0xcd, 0x48, 0x28, 0x07, 0x51, 0x66, 0xd7, 0x0d, 0x2c, 0x47, 0xea, 0xc2, 0x50,
+  0xeb, 0x27, 0x53, 0xf4, 0xd1, 0x2e, 0x06, 0x93, 0x82, 0xd6, 0x18, 0x0e, 0x76, 0xd4, 0x90, 0xd2,
+  0xba, 0x12, 0xc8, 0x63, 0x88, 0x35, 0x39, 0xd4, 0xc2, 0xd7, 0x04, 0x41, 0xc2, 0xaa, 0xa8, 0x45,
+  0x51, 0xdf, 0x08, 0xa9, 0x96, 0xf9, 0x57, 0x59, 0xc9, 0xee, 0x18, 0xfb, 0x4a, 0x30, 0x35, 0x59,
+  0x41, 0x7b, 0xfa, 0x56, 0x0b, 0x68, 0x83, 0x0d, 0x12, 0x4c, 0x16, 0x3a, 0x3d, 0xc8, 0xd3, 0x95,
+  0x53, 0x45, 0xbc, 0x8b, 0x9e, 0x17, 0x38, 0x53, 0xf9, 0x94, 0x4b, 0xcc, 0x50, 0x49, 0x0a, 0xb3,
+  0x49, 0xc4, 0x94, 0x4c, 0x97, 0x5e, 0xc1, 0xc7, 0xa8, 0x14, 0xe2, 0x68, 0xe4, 0xcc, 0x62, 0x1a,
+  0xde, 0x63, 0x5a, 0x4a, 0xe7, 0xa2, 0x5c, 0x5a, 0xa5, 0x0f, 0xa6, 0x11, 0x6b, 0x75, 0x77, 0xf1,
+  0xf4, 0x12, 0xff, 0xdb, 0xd6, 0xa6, 0xef, 0xb0, 0x9f, 0x3f, 0x90, 0x95, 0xbf, 0xe5, 0xb7, 0xbf,
+  0x49, 0xe4, 0xf3, 0x1e, 0xae, 0x24, 0x9a, 0x98, 0xf2, 0x15, 0x0c, 0x70, 0xec, 0x9a, 0xf5, 0x99,
+  0xfd, 0x7c, 0x57, 0x3a, 0xab, 0x8d, 0x96, 0xae, 0x8f, 0xc3, 0x18, 0x09, 0x51, 0x2f, 0x3d, 0xa7,
+  0x65, 0x0d, 0x52, 0x89, 0x0d, 0xc8, 0xbb, 0x52, 0x26, 0x24, 0x2e, 0xab, 0xed, 0x3d, 0xee, 0xb2,
+  0xd2, 0x4e, 0x5f, 0xa1, 0x09, 0x1e, 0x73, 0x86, 0x0e, 0x9e, 0xa9, 0x7f, 0xa4, 0xb0, 0x2d, 0xb5,
+  0x2f, 0x94, 0x81, 0x30, 0xf0, 0x8a, 0xfb, 0x2a, 0x74, 0xd7, 0x58, 0xdd, 0x24, 0xe6, 0x8e, 0x64,
+  0x1b, 0x8a, 0x95, 0x34, 0xbe, 0xcd, 0xcc, 0x7b, 0x2f, 0xbf, 0x01, 0x28, 0x68, 0x9e, 0x98, 0x68,
+  0xba, 0x99, 0xfc, 0xd8, 0xe4, 0xfd, 0x4a, 0x22, 0x24, 0x74, 0xa3, 0xe1, 0x1f, 0x9f, 0xa9, 0x6c,
+  0x8b, 0xc9, 0x30, 0xba, 0x62, 0x0a, 0xed, 0xe3, 0xa2, 0xb1, 0x80, 0x6e, 0xc6, 0x97, 0x6e, 0x8c,
+  0x31, 0xf4, 0x30, 0x15, 0x1c, 0x7f, 0xa2, 0x69, 0xd2, 0x82, 0x55, 0x78, 0xdf, 0x1a, 0x57, 0xf1,
+  0xf8, 0xf1, 0x63, 0x73, 0xb8, 0x5a, 0xd9, 0x0d, 0x0d, 0xa3, 0x32, 0xaf, 0x76, 0x1c, 0x61, 0xa7,
+  0x55, 0x3f, 0xdd, 0x29, 0xc7, 0xc7, 0x64, 0x4e, 0x6b, 0x30, 0xcb, 0xcf, 0x0c, 0x2a, 0x1a, 0xf7,
+  0x05, 0x7d, 0x8c, 0x92, 0xc1, 0x89, 0x40, 0x10, 0x51, 0xef, 0xcd, 0x61, 0x26, 0x54, 0x1e, 0xb9,
+  0x92, 0x11, 0xad, 0xa6, 0x98, 0xcb, 0x42, 0x65, 0x36, 0x61, 0xae, 0x5a, 0x6c, 0x69, 0x95, 0x97,
+  0xca, 0xbd, 0x18, 0xdb, 0x1a, 0x6e, 0x3f, 0xea, 0xc8, 0x4e, 0x05, 0x53, 0xa8, 0x35, 0x04, 0xc8,
+  0x38, 0x10, 0x76, 0x9f, 0x5b, 0x1a, 0x76, 0x63, 0xf3, 0xe3, 0x6c, 0x17, 0x3a, 0x69, 0x76, 0xab,
+  0x48, 0xc6, 0x22, 0xb8, 0xeb, 0x72, 0x95, 0xa9, 0x4a, 0xc5, 0xfd, 0x47, 0xd7, 0xb0, 0x79, 0xf8,
+  0xff, 0x71, 0xc4, 0x35, 0x06, 0x7f, 0xaa, 0xd1, 0xee, 0x8d, 0x99, 0x17, 0xda, 0xa7, 0x51, 0xd4,
+  0x5d, 0x86, 0x14, 0xaf, 0x49, 0x16, 0xb9, 0x87, 0xb2, 0x1d, 0x51, 0x7d, 0x65, 0xac, 0x8f, 0x24,
+  0x58, 0x36, 0xac, 0xef, 0x0e, 0x11, 0x95, 0x89, 0x45, 0x3f, 0xf6, 0xf7, 0xdb, 0x18, 0xad, 0xa6,
+  0xd6, 0x32, 0x78, 0x81, 0x51, 0xac, 0x4a, 0x6a, 0x41, 0x25, 0xed, 0x16, 0x50, 0xd9, 0xcd, 0x85,
+  0xfa, 0x9b, 0xd6, 0x8a, 0xab, 0xba, 0x7d, 0x00, 0xee, 0x6f, 0x50, 0xdb, 0x4e, 0x1c, 0x4c, 0x1b,
+  0x5a, 0x31, 0xca, 0x02, 0x43, 0x09, 0x19, 0x1a, 0x4e, 0xd8, 0x0e, 0x56, 0xb6, 0xb2, 0x3f, 0x8e,
+  0xeb, 0xc0, 0x2c, 0x3b, 0xf2, 0x4c, 0x63, 0x48, 0x56, 0x3f, 0x42, 0xd6, 0xd7, 0xc5, 0xfd, 0x8a,
+  0xbb, 0xb1, 0xde, 0x64, 0x4e, 0x27, 0x97, 0xd8, 0xba, 0x92, 0xb1, 0xbc, 0x5e, 0x94, 0x73, 0xfd,
+  0x00, 0x09, 0xcb, 0xc1, 0xdf, 0xa0, 0x5d, 0x7a, 0x90, 0x63, 0x0c, 0x84, 0xd2, 0x68, 0xd4, 0x54,
+  0x8d, 0xb4, 0xf3, 0x7c, 0x5c, 0xc2, 0x1c, 0x59, 0x93, 0x25, 0x85, 0x79, 0xbb, 0xb9, 0x6c, 0x6d,
+  0xb0, 0x70, 0x43, 0x48, 0x8c, 0xdd, 0xb7, 0x69, 0xa5, 0x87, 0xdb, 0x4a, 0xd7, 0x6e, 0x3c, 0x97,
+  0xf6, 0x51, 0xa9, 0xa9, 0xa7, 0x1f, 0x7c, 0x6a, 0xfe, 0x52, 0x51, 0xaf, 0x1b, 0xcc, 0x66, 0x11,
+  0xd5, 0x2e, 0x42, 0xa8, 0xc2, 0xaa, 0x9b, 0xbd, 0xbd, 0x0a, 0x87, 0xdc, 0x4e, 0xe9, 0xe1, 0x73,
+  0x1c, 0x38, 0x18, 0xe9, 0x0e, 0x53, 0xde, 0x01, 0x34, 0x42, 0xc3, 0x11, 0xc7, 0xcc, 0xbd, 0x91,
+  0x36, 0xfe, 0x41, 0x41, 0xcc, 0x9f, 0x38, 0x60, 0xb4, 0x15, 0x67, 0x67, 0x23, 0xfd, 0x92, 0x70,
+  0xfe, 0x7b, 0x5c, 0xe6, 0x91, 0xee, 0x59, 0xee, 0x28, 0xf1, 0x03, 0x65, 0x4e, 0x06, 0xce, 0x89,
+  0x8c, 0xfe, 0xda, 0x61, 0x48, 0x75, 0xe3, 0xc7, 0x8a, 0xae, 0x7b, 0x56, 0x08, 0x56, 0x2b, 0xbf,
+  0xee, 0xb9, 0xc6, 0x89, 0x90, 0xe2, 0x48, 0x60, 0x0c, 0x39, 0x43, 0x93, 0xf0, 0x85, 0x5f, 0x5d,
+  0x17, 0xea, 0x8c, 0xc6, 0x50, 0x8a, 0x83, 0x8f, 0xa1, 0xd5, 0xca, 0x22, 0xec, 0x19, 0xfa, 0xf7,
+  0x73, 0xe2, 0x6a, 0xcb, 0x99, 0xba, 0xd6, 0xe5, 0x8e, 0xcf, 0x13, 0xb1, 0xb3, 0xce, 0x60, 0x45,
+  0x24, 0xd8, 0x42, 0x61, 0x10, 0x12, 0x05, 0xfd, 0x5e, 0x92, 0xb4, 0x40, 0x27, 0x23, 0x2f, 0x48,
+  0x6a, 0x8c, 0xba, 0x0a, 0x85, 0xa7, 0x31, 0x28, 0x87, 0x61, 0x38, 0x2e, 0x11, 0x10, 0x30, 0x0e,
+  0xbb, 0x02, 0x00, 0x93, 0xc2, 0x94, 0x3c, 0x4d, 0x8a, 0x44, 0xa5, 0xee, 0x92, 0x30, 0xc8, 0xee,
+  0xf6, 0x99, 0x1d, 0x70, 0xff, 0xbc, 0x05, 0x46, 0xe8, 0xa4, 0xc5, 0xae, 0x0f, 0xfc, 0x24, 0x37,
+  0x01, 0xb3, 0xe5, 0xdd, 0x14, 0x72, 0xf0, 0x5e, 0x72, 0x6c, 0x95, 0x74, 0xd2, 0x37, 0x01, 0x1a,
+  0xa8, 0x80, 0x04, 0x51, 0xb3, 0x20, 0x90, 0x4d, 0x26, 0xbb, 0x5d, 0xb7, 0x53, 0x35, 0xd0, 0x24,
+  0x9d, 0x8e, 0x6a, 0x5c, 0x6c, 0x41, 0xc4, 0xb8, 0x50, 0x51, 0xdd, 0x42, 0x9d, 0x9c, 0xf9, 0x14,
+  0xab, 0xd9, 0x87, 0x7f, 0xbe, 0xa0, 0x53, 0xd7, 0x21, 0x2d, 0xf4, 0xb8, 0x08, 0x81, 0xde, 0xc5,
+  0xd5, 0x33, 0xf3, 0x69, 0xab, 0xeb, 0x4e, 0x59, 0x24, 0xd5, 0x30, 0x8d, 0xa0, 0xea, 0x6b, 0xd1,
+  0x53, 0xef, 0x4b, 0xba, 0x7d, 0xb4, 0xb7, 0xaf, 0x74, 0x6b, 0xbd, 0xc5, 0x5a, 0x86, 0xc2, 0x0e,
+  0xef, 0x58, 0x17, 0x88, 0x04, 0xae, 0x29, 0x64, 0x6c, 0x8d, 0xf8, 0x30, 0xc3, 0x35, 0x58, 0x33,
+  0x85, 0xd2, 0x02, 0xb5, 0xdf, 0xdf, 0x0c, 0x85, 0xc3, 0xcd, 0x53, 0x98, 0x03, 0x99, 0x00, 0xb3,
+  0x19, 0x0c, 0x89, 0xb6, 0xb4, 0x39, 0x58, 0x2d, 0xe6, 0x81, 0x5c, 0x41, 0x62, 0x8d, 0x6c, 0x8e,
+  0xbe, 0xb7, 0xde, 0xa5, 0xeb, 0x14, 0xdc, 0x54, 0x93, 0x16, 0xb2, 0x99, 0x93, 0x2d, 0x61, 0x39,
+  0xfb, 0x54, 0x52, 0x4f, 0xa2, 0x9e, 0x45, 0x31, 0xe5, 0x55, 0x4b, 0x61, 0x24, 0x52, 0xa1, 0xfe,
+  0xc9, 0x6b, 0x97, 0xb2, 0xb3, 0xa2, 0x8c, 0x0d, 0x84, 0x1c, 0x6e, 0x89, 0xfc, 0x3f, 0x87, 0x5b,
+  0x3c, 0x29, 0xd1, 0x21, 0x66, 0xeb, 0xe0, 0x29, 0x88, 0x60, 0x50, 0x78, 0x5e, 0xa0, 0x43, 0x1e,
+  0x9f, 0x7b, 0x2c, 0x5a, 0x1f, 0xce, 0x07, 0xa6, 0x94, 0x42, 0xf0, 0x35, 0xa9, 0xb0, 0xc4, 0x54,
+  0x0b, 0x51, 0x74, 0xd4, 0x48, 0x6e, 0xf5, 0x37, 0x8e, 0x5f, 0x9e, 0x3e, 0xeb, 0xbe, 0x72, 0xe2,
+  0xd0, 0xbd, 0x21, 0x67, 0x31, 0x5d, 0xd1, 0x70, 0xe5, 0x5f, 0x90, 0x87, 0x0b, 0x14, 0xd0, 0x03,
+  0xb2, 0x08, 0x00, 0x3c, 0x6c, 0xdd, 0xc8, 0x37, 0x74, 0xdc, 0x7d, 0x96, 0xc8, 0xec, 0xe1, 0xd6,
+  0x52, 0xf4, 0xbf, 0x95, 0x20, 0xc0, 0xff, 0x8c, 0xb8, 0x31, 0x97, 0x76, 0xa2, 0xc9, 0x7a, 0x83,
+  0x84, 0x81, 0x87, 0x1e, 0x0a, 0x7a, 0x01, 0xb5, 0x1a, 0x04, 0xaf, 0x32, 0xf2, 0x1b, 0x99, 0x47,
+  0x8d, 0x33, 0x96, 0xfa, 0x04, 0x50, 0xc0, 0x26, 0x8d, 0x14, 0xe1, 0xa9, 0x7b, 0xa5, 0x41, 0x43,
+  0x23, 0x22, 0x2d, 0x37, 0xd6, 0x60, 0x10, 0xa5, 0x2a, 0x88, 0xd8, 0xd2, 0xf1, 0x8f, 0xff, 0xfe,
+  0x0f, 0xff, 0xf1, 0xdf, 0x02, 0x5b, 0xf1, 0x67, 0xae, 0xec, 0x2f, 0xa8, 0x1b, 0xeb, 0x65, 0x87,
+  0x5b, 0x00, 0xbb, 0xb0, 0x27, 0x26, 0xa0, 0x0d, 0xe2, 0x4e, 0x8f, 0x1a, 0xb1, 0xbb, 0xa0, 0x09,
+  0x45, 0x60, 0xa6, 0x1c, 0x35, 0x96, 0xa0, 0x84, 0x63, 0xe0, 0x6f, 0xb7, 0x3b, 0x62, 0xff, 0xa7,
+  0x40, 0x53, 0xff, 0xd8, 0x24, 0x91, 0xdf, 0xff, 0xed, 0xff, 0xb0, 0xd1, 0x78, 0x0a, 0x2a, 0xe2,
+  0xf2, 0x7e, 0x54, 0x8a, 0x6b, 0x85, 0xa7, 0x4c, 0xd9, 0x00, 0x6d, 0x9f, 0x88, 0xa8, 0xbf, 0xff,
+  0xc3, 0xbf, 0xfb, 0x6f, 0x36, 0xaa, 0xbe, 0xa4, 0x1e, 0xac, 0xb7, 0x97, 0xf7, 0x1d, 0x3f, 0x41,
+  0xd9, 0xd3, 0xd4, 0x59, 0xd1, 0x38, 0xee, 0x7f, 0x32, 0xea, 0xfe, 0xfa, 0xdf, 0x14, 0xc9, 0xe5,
+  0x1d, 0xe8, 0xc9, 0x4d, 0xd0, 0x76, 0x0e, 0x22, 0x8a, 0xb0, 0x1a, 0x84, 0xa9, 0x96, 0xa3, 0x86,
+  0x69, 0x8b, 0xf0, 0x29, 0x07, 0xf5, 0xdf, 0xff, 0x6b, 0x1b, 0xd9, 0x2f, 0xdd, 0xc9, 0x3c, 0x8e,
+  0xa8, 0x0f, 0x9b, 0xf8, 0x7b, 0x51, 0xce, 0x41, 0xfc, 0x82, 0x7d, 0xf8, 0x64, 0xe3, 0xf9, 0xfd,
+  0x7f, 0xfe, 0x4f, 0xff, 0xef, 0x7f, 0xff, 0x8d, 0x8d, 0xb4, 0x27, 0x68, 0x56, 0xd4, 0x13, 0x5a,
+  0xa4, 0x04, 0xad, 0x11, 0xa1, 0x1c, 0x35, 0x34, 0xf8, 0x92, 0xa8, 0xdc, 0x10, 0x6c, 0x40, 0x2f,
+  0xd1, 0xa7, 0x1b, 0x46, 0xeb, 0xdc, 0x7c, 0xf5, 0xcf, 0xce, 0xcf, 0xab, 0x12, 0xb8, 0xf8, 0x6d,
+  0x1c, 0xff, 0x89, 0x12, 0xf8, 0xfb, 0xff, 0x5e, 0x30, 0x9e, 0xcf, 0xf8, 0x7e, 0xb7, 0x2a, 0x99,
+  0x62, 0x7b, 0x5c, 0x4e, 0xa9, 0xd8, 0xeb, 0x01, 0xa5, 0xfe, 0x27, 0x23, 0xf4, 0x3f, 0xfc, 0x95,
+  0x8d, 0xca, 0xaf, 0xce, 0x9f, 0x54, 0xa5, 0x30, 0x88, 0x9d, 0x1a, 0xe3, 0xf8, 0xe9, 0xb4, 0xcd,
+  0x5f, 0x5b, 0x17, 0xff, 0x17, 0x6f, 0xba, 0x4f, 0xa6, 0x21, 0x30, 0xfb, 0x7e, 0x6a, 0xd6, 0x5d,
+  0x3e, 0x99, 0x32, 0x30, 0x7f, 0x32, 0x0a, 0xd6, 0x3e, 0x9e, 0xaf, 0xe9, 0x0a, 0x5a, 0x87, 0x71,
+  0x54, 0x85, 0x62, 0x41, 0x8d, 0xea, 0xd9, 0x31, 0xfa, 0x74, 0x2c, 0xde, 0x1c, 0x15, 0xb9, 0x42,
+  0x26, 0x02, 0xff, 0x10, 0xaf, 0x93, 0x60, 0xe5, 0xe7, 0x0c, 0x0c, 0xd6, 0x5a, 0x44, 0x31, 0x8a,
+  0xba, 0x34, 0xfe, 0x5a, 0x6e, 0x90, 0xa0, 0x2a, 0x76, 0x18, 0xcc, 0x2f, 0x65, 0xcc, 0x41, 0xc1,
+  0xc7, 0xc2, 0x14, 0xa1, 0xa9, 0xc4, 0x21, 0x30, 0x00, 0xaa, 0xa1, 0x2a, 0xfa, 0xeb, 0xb2, 0x0e,
+  0x61, 0x6f, 0x74, 0xb7, 0x0a, 0x3f, 0x7c, 0x37, 0xb9, 0x04, 0x4c, 0xee, 0xa8, 0xdf, 0x38, 0xfe,
+  0x1a, 0x71, 0x3a, 0xdc, 0xe2, 0x58, 0x5a, 0xd8, 0xfa, 0x31, 0x97, 0x9e, 0xff, 0x5a, 0xa0, 0xaa,
+  0x5e, 0x02, 0x8e, 0x88, 0xb2, 0xc0, 0xf1, 0x1e, 0xa2, 0x0e, 0xdf, 0xe3, 0xaf, 0x39, 0xf7, 0x9d,
+  0x08, 0x4d, 0x79, 0x93, 0xc0, 0x0b, 0x7e, 0x62, 0xe8, 0x71, 0x77, 0x1c, 0x52, 0xe7, 0x72, 0x44,
+  0xd8, 0x3f, 0x5d, 0xfc, 0xf2, 0x09, 0xe7, 0xc1, 0xf7, 0x7f, 0xf3, 0x3f, 0x0b, 0x98, 0xf2, 0x76,
+  0x89, 0xa6, 0x3b, 0xb9, 0x0a, 0x18, 0x5f, 0x70, 0x68, 0xef, 0xcd, 0x19, 0x0e, 0xf2, 0x29, 0x73,
+  0xa4, 0x09, 0x98, 0x9f, 0xd4, 0x56, 0xfe, 0x3f, 0x76, 0x5b, 0xd9, 0x59, 0x6e, 0x94, 0x52, 0x04,
+  0x58, 0x95, 0x4e, 0xe8, 0x8c, 0x6f, 0x0f, 0x2d, 0xbb, 0xc5, 0x49, 0xc9, 0x0e, 0x91, 0x6f, 0x5f,
+  0x08, 0x2c, 0xfc, 0xd7, 0xce, 0xdc, 0x33, 0x6e, 0x11, 0xa5, 0x5b, 0xf2, 0x32, 0xf3, 0xe6, 0x43,
+  0xa5, 0x82, 0xd8, 0xf8, 0x0a, 0x78, 0x0e, 0xc0, 0xfb, 0xf0, 0xc7, 0xb9, 0x47, 0x61, 0x99, 0x9d,
+  0x0f, 0x4b, 0xc7, 0x47, 0xf2, 0xb3, 0x24, 0xc8, 0xa2, 0x7b, 0x74, 0xa9, 0xe2, 0xfa, 0x0b, 0x1a,
+  0xce, 0x3e, 0x7c, 0x77, 0x31, 0x76, 0x42, 0x4a, 0x78, 0x3f, 0xd4, 0x32, 0x9a, 0xd2, 0xfd, 0x93,
+  0x06, 0x99, 0x3a, 0xb1, 0xd3, 0xe5, 0x5f, 0x80, 0xe3, 0xbe, 0x73, 0x49, 0x93, 0x3e, 0xb8, 0x3e,
+  0x69, 0x60, 0xb6, 0x1f, 0x76, 0xc0, 0x72, 0xd4, 0xe8, 0x6b, 0xfb, 0x67, 0xac, 0x2d, 0xfa, 0x32,
+  0x48, 0x05, 0x2b, 0xae, 0x31, 0xdc, 0x76, 0xb4, 0x26, 0x18, 0x57, 0x5e, 0x19, 0xad, 0x13, 0xac,
+  0x6d, 0x47, 0x8b, 0x15, 0x6f, 0x04, 0xad, 0xd0, 0x71, 0xfd, 0xca, 0x58, 0x7d, 0x8d, 0x59, 0x3d,
+  0xad, 0x48, 0x61, 0xe9, 0x46, 0x70, 0x1a, 0xc3, 0x12, 0x31, 0xa9, 0x3e, 0x84, 0x4f, 0x59, 0x75,
+  0x3b, 0x5e, 0xbc, 0x7c, 0x23, 0x98, 0xe1, 0x5c, 0x8d, 0xaa, 0xcb, 0x16, 0xd6, 0x2e, 0x90, 0x2d,
+  0x2c, 0xde, 0x08, 0x5a, 0x78, 0x4a, 0x5a, 0x1d, 0xad, 0x97, 0x58, 0xdb, 0x8e, 0x16, 0x2b, 0xde,
+  0x08, 0x5a, 0x2c, 0xc9, 0x51, 0x65, 0xb4, 0xde, 0xb0, 0x94, 0x48, 0x56, 0xb4, 0x58, 0xf1, 0x46,
+  0xd0, 0xba, 0x76, 0xae, 0x6a, 0x70, 0xeb, 0x1b, 0xac, 0x6d, 0x47, 0x8b, 0x15, 0x6f, 0x46, 0xb6,
+  0x96, 0x2e, 0x5a, 0xf6, 0x95, 0x85, 0x8b, 0x55, 0x2f, 0x90, 0x2e, 0x56, 0xbe, 0x11, 0xcc, 0x66,
+  0x6e, 0x58, 0x7d, 0x18, 0x9f, 0xbb, 0x61, 0xc1, 0x28, 0x62, 0xe9, 0x66, 0x64, 0x0b, 0x2a, 0x2c,
+  0x9c, 0xea, 0xc2, 0xc5, 0xaa, 0x17, 0x48, 0x17, 0x2b, 0xdf, 0x8c, 0x46, 0x75, 0x31, 0x27, 0x75,
+  0x75, 0x9d, 0xca, 0xaa, 0x17, 0x68, 0x55, 0x56, 0xbe, 0x19, 0x09, 0x73, 0xfc, 0x69, 0xbd, 0x65,
+  0xe8, 0x0c, 0x5a, 0x90, 0x92, 0xb5, 0x28, 0xab, 0xb3, 0x19, 0x24, 0x99, 0xeb, 0xa9, 0x26, 0x9a,
+  0xac, 0x4d, 0x29, 0xa2, 0x52, 0xad, 0x42, 0x54, 0xf3, 0x46, 0x8c, 0x30, 0xd3, 0x0b, 0xf3, 0x16,
+  0x58, 0x0c, 0x15, 0x6e, 0xf1, 0x08, 0x00, 0xe6, 0xa0, 0x93, 0xba, 0x69, 0x65, 0x87, 0x72, 0xbe,
+  0x85, 0xdc, 0x1e, 0x51, 0xfe, 0x1b, 0xbe, 0xf0, 0xeb, 0xb5, 0x60, 0x6a, 0x1e, 0x35, 0xe2, 0xbb,
+  0x86, 0xe4, 0x18, 0x65, 0x05, 0x5a, 0x65, 0x1e, 0xf1, 0xc4, 0x1d, 0xf3, 0x77, 0x2a, 0x8f, 0x93,
+  0x86, 0x92, 0xe1, 0xd7, 0x50, 0x5b, 0x43, 0xfb, 0x80, 0xa7, 0x14, 0x66, 0xd6, 0x2e, 0x18, 0x31,
+  0xa7, 0xe7, 0xdd, 0xc1, 0xc9, 0xe9, 0xd9, 0x79, 0x77, 0xd8, 0x79, 0xb5, 0xdd, 0xdb, 0xed, 0xf5,
+  0xb7, 0xfa, 0xf0, 0x6b, 0xd0, 0xe7, 0x3f, 0xb7, 0xc1, 0x96, 0x5c, 0x85, 0xc1, 0xd2, 0xd9, 0x7a,
+  0x4a, 0x43, 0x58, 0xc2, 0x48, 0x0b, 0x1a, 0xb4, 0x0f, 0xb7, 0x38, 0x90, 0x12, 0xd8, 0x3f, 0x7d,
+  0x75, 0xde, 0x7f, 0x7a, 0x76, 0x9e, 0xc0, 0x1d, 0x24, 0x60, 0x53, 0x98, 0x2f, 0x03, 0x7f, 0x0a,
+  0xd5, 0x5b, 0x50, 0x71, 0x0b, 0x2a, 0x56, 0x85, 0xfb, 0xcd, 0xe9, 0x79, 0xff, 0x9b, 0xd3, 0x42,
+  0xc0, 0x6e, 0x14, 0x39, 0x63, 0x04, 0x0d, 0x75, 0xb7, 0xb0, 0x6e, 0x55, 0xd8, 0xa7, 0xc0, 0x8f,
+  0xe1, 0xa9, 0x04, 0x7c, 0x3b, 0x65, 0xc6, 0x4e, 0x0a, 0xfe, 0x4b, 0xea, 0x45, 0xae, 0x7f, 0xe9,
+  0x92, 0xd6, 0x69, 0x75, 0x6e, 0x00, 0xcc, 0xdd, 0xd3, 0x67, 0x0c, 0xee, 0xb0, 0xd7, 0x07, 0xa8,
+  0x83, 0xde, 0x00, 0x51, 0x7e, 0x82, 0xc9, 0x2e, 0x2f, 0x9d, 0xad, 0xd7, 0xf4, 0x9a, 0xfc, 0x32,
+  0x08, 0x2f, 0x01, 0x68, 0x75, 0x74, 0x4f, 0xce, 0xce, 0xf7, 0x4e, 0x0a, 0x80, 0x9e, 0xcc, 0xdd,
+  0x89, 0x73, 0x11, 0xc0, 0xb0, 0x55, 0x87, 0xf9, 0xea, 0xec, 0xfc, 0xd1, 0xab, 0x02, 0x98, 0xcf,
+  0xa8, 0x8f, 0x01, 0x70, 0xad, 0x57, 0xd5, 0x41, 0xbe, 0x39, 0x3b, 0xdf, 0x7f, 0x53, 0x00, 0xf2,
+  0x65, 0x10, 0x91, 0x27, 0xfe, 0x05, 0x48, 0x76, 0x44, 0x5a, 0x6f, 0xaa, 0xc3, 0x7d, 0x82, 0x82,
+  0x3b, 0xe8, 0x3f, 0x61, 0x7c, 0x85, 0x61, 0x1a, 0x20, 0xf0, 0x1d, 0xfc, 0x67, 0x6b, 0x9b, 0xf9,
+  0x51, 0xd1, 0x11, 0xe7, 0x52, 0x7f, 0xeb, 0xec, 0x76, 0xea, 0xd3, 0x5b, 0xd2, 0x7a, 0x52, 0x83,
+  0xb7, 0x3f, 0x03, 0xd8, 0x8f, 0x01, 0x4a, 0x84, 0x00, 0xce, 0x83, 0x4b, 0x17, 0xd8, 0xf8, 0xb3,
+  0x5a, 0x43, 0x83, 0x0f, 0xab, 0xf0, 0xe6, 0x67, 0x73, 0xc7, 0xbf, 0x98, 0x3b, 0x6e, 0xad, 0x81,
+  0x78, 0x01, 0x10, 0x76, 0x47, 0xdb, 0xfd, 0x04, 0xc8, 0x0b, 0x1f, 0x23, 0x47, 0x49, 0xeb, 0x45,
+  0x75, 0x10, 0x6f, 0xcf, 0x4f, 0xa0, 0x39, 0xfc, 0xd7, 0x5c, 0x1f, 0xf7, 0xad, 0xa8, 0x4d, 0x14,
+  0xfd, 0x94, 0x73, 0x4b, 0x15, 0x2a, 0xac, 0x79, 0xb0, 0x0a, 0x9f, 0x07, 0xe1, 0xc2, 0x89, 0xb9,
+  0xe2, 0x9a, 0xb1, 0xdf, 0xa5, 0xaa, 0x4b, 0x6a, 0x96, 0x53, 0x61, 0x1c, 0x44, 0x0d, 0x25, 0x36,
+  0x84, 0xa9, 0x39, 0xdc, 0xe9, 0x9e, 0xc5, 0x2b, 0x58, 0x7a, 0xfc, 0xee, 0x73, 0x81, 0x42, 0x25,
+  0x0e, 0x0d, 0x86, 0x8d, 0xe3, 0xc1, 0x50, 0x6b, 0x0b, 0x82, 0xf2, 0x6a, 0xeb, 0xcd, 0xab, 0xf6,
+  0xda, 0x5c, 0xd3, 0xff, 0x94, 0x3c, 0x7b, 0x11, 0x8d, 0xcf, 0x6d, 0x7a, 0x1b, 0x2f, 0xce, 0xc8,
+  0x1c, 0xb8, 0x8c, 0x57, 0x20, 0xbf, 0x30, 0xf8, 0x21, 0x32, 0x21, 0xad, 0xf6, 0x50, 0xae, 0x14,
+  0x2d, 0xa9, 0x3b, 0x99, 0xd3, 0xd0, 0xd7, 0x3d, 0x73, 0x45, 0xfe, 0x09, 0x69, 0xf1, 0x4b, 0xb3,
+  0x19, 0x15, 0x1e, 0x61, 0xcb, 0xab, 0xf7, 0xcf, 0x03, 0x7f, 0xe6, 0x5e, 0xac, 0x58, 0x72, 0x1f,
+  0xdf, 0xe8, 0xac, 0xd0, 0xb3, 0x6c, 0x95, 0x5b, 0x09, 0xf4, 0x06, 0xd6, 0xfa, 0x29, 0x05, 0xfe,
+  0xcc, 0x1c, 0xb6, 0x23, 0x61, 0x5f, 0xc5, 0x7d, 0xb3, 0x28, 0x31, 0x39, 0x58, 0xff, 0x27, 0x3c,
+  0x04, 0x4e, 0xf1, 0x82, 0x6c, 0x1f, 0xdb, 0x31, 0x3c, 0xdc, 0x82, 0xe2, 0x07, 0x8a, 0x9d, 0x91,
+  0xc7, 0x13, 0x93, 0x5b, 0x89, 0x4e, 0x79, 0x70, 0x3a, 0xac, 0xae, 0x21, 0x9e, 0xac, 0x7d, 0xff,
+  0xfb, 0xef, 0x54, 0x43, 0xc4, 0xea, 0x3e, 0xc9, 0xa5, 0x85, 0x92, 0xcf, 0xe9, 0x6c, 0x98, 0x1b,
+  0x7c, 0xd0, 0xdc, 0x05, 0x6d, 0x30, 0x43, 0x76, 0xc0, 0x0c, 0x29, 0xcb, 0x01, 0xc9, 0x63, 0x4f,
+  0x31, 0xb4, 0x77, 0x44, 0xf0, 0xbf, 0x07, 0x06, 0x23, 0xeb, 0x1c, 0xac, 0x18, 0x0a, 0xbc, 0x59,
+  0x85, 0x23, 0x7c, 0x8a, 0x09, 0x43, 0xcc, 0x39, 0xa6, 0x13, 0x2c, 0x11, 0x87, 0x3e, 0x78, 0xba,
+  0x8f, 0x81, 0x1a, 0x58, 0x7a, 0x4c, 0x1e, 0xfe, 0x68, 0xf0, 0x68, 0xef, 0xe0, 0xc4, 0xea, 0x7d,
+  0x5d, 0xcd, 0xe2, 0x19, 0x5d, 0x4d, 0xe6, 0x31, 0x3f, 0xf9, 0xd3, 0xe1, 0x7e, 0xb9, 0x5a, 0xb8,
+  0x46, 0xb8, 0x9f, 0xd7, 0xb0, 0x47, 0x3f, 0x82, 0x95, 0x36, 0xd8, 0x97, 0xac, 0xb4, 0x52, 0xde,
+  0xd6, 0x30, 0xe3, 0x38, 0x2b, 0x1b, 0x12, 0xab, 0x49, 0x4b, 0xf0, 0xb0, 0x6d, 0xd6, 0x8d, 0x2c,
+  0x38, 0x5c, 0x1a, 0x06, 0x98, 0x24, 0xf2, 0xf5, 0x4a, 0xc4, 0xf8, 0xa8, 0xd1, 0xdd, 0x81, 0xf9,
+  0x02, 0x88, 0x1f, 0x35, 0xf6, 0xfb, 0xc8, 0x0a, 0xba, 0x84, 0x19, 0xd4, 0x1b, 0x34, 0x08, 0xd0,
+  0x3b, 0xa1, 0xf3, 0xc0, 0x83, 0xb9, 0xc6, 0x6a, 0x91, 0xb1, 0x1b, 0x91, 0x7d, 0xcd, 0x04, 0x97,
+  0x90, 0xa1, 0x40, 0x12, 0x1d, 0x6b, 0x9a, 0xb5, 0xa6, 0xe6, 0xe7, 0xc3, 0xda, 0xc8, 0x0d, 0x3e,
+  0x69, 0x7d, 0x5e, 0x81, 0x46, 0xd6, 0xd6, 0x44, 0x63, 0x42, 0xe1, 0xa0, 0x5f, 0x40, 0x22, 0x27,
+  0x90, 0x55, 0x51, 0xdc, 0x26, 0x3a, 0x2a, 0x55, 0xe8, 0x2c, 0xd2, 0xd5, 0xce, 0x15, 0xe5, 0x8a,
+  0xe5, 0x19, 0xec, 0x7f, 0x4c, 0x2a, 0x11, 0xf6, 0x45, 0xb0, 0x24, 0xc3, 0x1c, 0x9f, 0x62, 0x27,
+  0xf9, 0x6f, 0x86, 0xe3, 0x92, 0x79, 0xa8, 0xee, 0x55, 0xf2, 0xd3, 0x9c, 0xf4, 0x0f, 0x0a, 0xb2,
+  0x5c, 0xde, 0x67, 0x1b, 0x63, 0x3d, 0xad, 0x52, 0xee, 0x3c, 0x37, 0x8a, 0x06, 0x9d, 0x69, 0xb2,
+  0x67, 0x2b, 0xa8, 0xf4, 0x76, 0x1e, 0xc2, 0x7a, 0x09, 0xf6, 0x15, 0x69, 0x9d, 0xd1, 0x4b, 0xb6,
+  0x7e, 0x5a, 0x06, 0x3e, 0xd7, 0x91, 0x50, 0xec, 0xf9, 0x85, 0x5d, 0x16, 0x91, 0xb4, 0x27, 0x22,
+  0xdf, 0xfe, 0xe2, 0x52, 0x32, 0x10, 0x52, 0xb2, 0xbd, 0x97, 0x89, 0xc9, 0x40, 0x1d, 0xa0, 0x0c,
+  0xbd, 0x67, 0xce, 0x2a, 0x47, 0x94, 0xa5, 0xaf, 0x17, 0xf8, 0xcd, 0x28, 0x97, 0x96, 0x1e, 0x13,
+  0x33, 0xa2, 0x5f, 0xd8, 0x39, 0xe1, 0x39, 0xed, 0xa3, 0xc9, 0x5c, 0xe7, 0x6d, 0x6e, 0xce, 0x99,
+  0x26, 0x61, 0xfd, 0x51, 0x62, 0x9a, 0x1c, 0x07, 0x29, 0x9b, 0xf4, 0x1f, 0x75, 0xac, 0x92, 0xfe,
+  0xd6, 0x1b, 0xaa, 0x1c, 0x92, 0x15, 0x46, 0x4c, 0xf4, 0xb8, 0xee, 0x80, 0xed, 0x56, 0xc1, 0xe0,
+  0x93, 0x0f, 0x1b, 0x5b, 0x28, 0x71, 0xd8, 0x74, 0x4d, 0x16, 0x7d, 0xd4, 0xd1, 0x4b, 0xba, 0x5d,
+  0x6f, 0xf4, 0x6c, 0xb8, 0x56, 0x18, 0x44, 0xd1, 0xf1, 0x86, 0x06, 0xb1, 0x10, 0x91, 0xb5, 0xc7,
+  0xb2, 0x6c, 0x7d, 0xc0, 0xfb, 0x00, 0x27, 0xcc, 0xe0, 0x6c, 0x94, 0x3b, 0xa1, 0xd0, 0x8c, 0x50,
+  0x7d, 0xb1, 0x88, 0xa1, 0x3f, 0x45, 0x0c, 0xfd, 0xcc, 0x96, 0x6f, 0x1c, 0x9b, 0xbf, 0x17, 0xda,
+  0xf8, 0xec, 0xe7, 0x5a, 0xe7, 0x8f, 0xaf, 0x1c, 0x7f, 0x45, 0x3d, 0x8f, 0x92, 0x2c, 0x78, 0xeb,
+  0xfe, 0x87, 0x90, 0x19, 0x2c, 0xd2, 0x12, 0x1d, 0xb4, 0x2b, 0x9d, 0x43, 0xda, 0xa6, 0x8b, 0x3c,
+  0x55, 0xc6, 0x52, 0x30, 0xa3, 0x1c, 0x71, 0xa6, 0xcd, 0x89, 0x6a, 0xf3, 0x41, 0x12, 0x49, 0x09,
+  0xae, 0x61, 0x32, 0x64, 0xb6, 0xc9, 0x70, 0xdb, 0x32, 0x19, 0x24, 0xaa, 0xc1, 0xf8, 0x80, 0x2a,
+  0x9e, 0xbe, 0x81, 0x35, 0xf6, 0x66, 0x9f, 0x01, 0x96, 0x3e, 0xc5, 0x0c, 0xe8, 0x5b, 0x7b, 0x4f,
+  0xc5, 0x3d, 0x33, 0x82, 0xc0, 0x0e, 0xfe, 0xed, 0xca, 0x0d, 0xe9, 0xb4, 0x92, 0xbd, 0x9d, 0xbf,
+  0x69, 0x9b, 0xca, 0xb7, 0xe9, 0xe6, 0x2b, 0xbb, 0xa6, 0xde, 0xd0, 0xc8, 0x7a, 0x23, 0x1a, 0x1e,
+  0xeb, 0xfd, 0xc8, 0xbb, 0x30, 0x29, 0xd7, 0x57, 0xe3, 0xf8, 0xa9, 0x1b, 0xc7, 0x14, 0x51, 0x06,
+  0x13, 0xea, 0x1b, 0x1a, 0xc6, 0xe4, 0xee, 0x1a, 0x89, 0x80, 0xbf, 0xfa, 0x6c, 0x7b, 0x8c, 0x6c,
+  0x48, 0x29, 0x2a, 0xda, 0x99, 0x69, 0xd3, 0x54, 0x8a, 0x7e, 0xb5, 0x71, 0x4c, 0x9a, 0x7d, 0xa6,
+  0xaf, 0xea, 0xdc, 0xbb, 0xf7, 0x96, 0x1a, 0x83, 0x25, 0x31, 0xc2, 0x1f, 0x89, 0x2b, 0x9b, 0x77,
+  0x9b, 0xdf, 0x4f, 0xe3, 0x56, 0x28, 0x63, 0x89, 0x79, 0x4b, 0x6d, 0xc1, 0xf0, 0x07, 0xde, 0x4f,
+  0x97, 0x62, 0xce, 0xb5, 0x44, 0xa2, 0x90, 0xb4, 0xdb, 0xae, 0xa6, 0x99, 0xa8, 0xdd, 0xc8, 0x4d,
+  0x7b, 0x39, 0xf5, 0x59, 0x92, 0xa9, 0xfc, 0xb0, 0x49, 0x31, 0xae, 0xe8, 0xa3, 0x71, 0xaf, 0x84,
+  0x83, 0xa6, 0x2c, 0x20, 0x56, 0xaa, 0x9c, 0xdf, 0xf7, 0x16, 0x68, 0x2e, 0xc5, 0xb0, 0xaf, 0x7a,
+  0xc0, 0xb1, 0x9e, 0x09, 0x02, 0x2a, 0x47, 0x8e, 0x13, 0x7f, 0xe5, 0xfa, 0x3d, 0x52, 0xa0, 0x5f,
+  0xd7, 0xb6, 0x39, 0xd4, 0x7e, 0xd6, 0x53, 0xb5, 0x80, 0x9c, 0xbb, 0x70, 0xcc, 0xab, 0x56, 0x59,
+  0x97, 0x1b, 0xd2, 0xb7, 0x06, 0x14, 0x24, 0x3b, 0xc3, 0xa0, 0x6f, 0x8d, 0x06, 0xc7, 0x47, 0xd2,
+  0x87, 0x1b, 0xb3, 0x4b, 0x81, 0x1f, 0x8a, 0x50, 0x38, 0x37, 0x1f, 0x49, 0x28, 0x94, 0x7e, 0xd6,
+  0x14, 0x0a, 0xe7, 0xa6, 0x96, 0x50, 0xc8, 0x5d, 0x6e, 0x4a, 0x28, 0xf2, 0x28, 0xfc, 0x13, 0x14,
+  0x0a, 0xee, 0xd7, 0x84, 0x09, 0x90, 0xb8, 0x3d, 0x08, 0x53, 0x16, 0xad, 0xe9, 0xca, 0xbf, 0xa4,
+  0xde, 0x26, 0xb7, 0x27, 0x69, 0x47, 0xeb, 0x49, 0x44, 0x86, 0x9d, 0xbb, 0x58, 0x2d, 0x2a, 0xf5,
+  0xb4, 0xae, 0x20, 0xec, 0x16, 0xf5, 0xfc, 0x4f, 0x57, 0x06, 0x9c, 0x9b, 0x4c, 0x06, 0x50, 0x37,
+  0xb4, 0xe6, 0xdc, 0xd6, 0xdf, 0xb0, 0x04, 0x40, 0x37, 0xf7, 0x93, 0x00, 0x9c, 0x97, 0x95, 0x24,
+  0xc0, 0xb9, 0x59, 0x57, 0x02, 0x76, 0x76, 0xfb, 0x45, 0x7d, 0xff, 0x49, 0xcb, 0x40, 0xc9, 0x46,
+  0x17, 0x8d, 0x19, 0x83, 0x2d, 0x94, 0xa9, 0x4f, 0x72, 0x2a, 0x36, 0x3c, 0x2b, 0xe8, 0x50, 0xd9,
+  0xcc, 0xea, 0x15, 0x6b, 0xef, 0x67, 0xeb, 0x1a, 0xd7, 0x78, 0x3b, 0x27, 0xbb, 0xf3, 0xf9, 0x89,
+  0x6c, 0x6a, 0xbc, 0xe6, 0x63, 0xb6, 0xa4, 0x55, 0x74, 0x7e, 0x60, 0x03, 0xda, 0x82, 0xe6, 0x46,
+  0xcc, 0x66, 0x84, 0x6d, 0x34, 0x9b, 0x19, 0x07, 0x0a, 0x6d, 0x65, 0xad, 0xc6, 0xa7, 0x32, 0x90,
+  0x0b, 0xac, 0x1e, 0xbc, 0xb5, 0x45, 0xc3, 0x2b, 0xa4, 0x9e, 0x21, 0xf7, 0x34, 0x0c, 0x2e, 0x69,
+  0x48, 0x5e, 0xbc, 0x29, 0x3b, 0xdd, 0x90, 0x5a, 0x12, 0x29, 0xcb, 0xb9, 0x7a, 0x84, 0x31, 0x78,
+  0x3c, 0xec, 0x0d, 0xf6, 0xf6, 0x7b, 0x83, 0x5e, 0xee, 0x18, 0x43, 0xed, 0x8d, 0x88, 0x0b, 0x3c,
+  0xd0, 0xde, 0xc1, 0x3c, 0xd5, 0x20, 0x09, 0xff, 0xb2, 0xf5, 0xc5, 0xe8, 0x57, 0xfd, 0xee, 0xe3,
+  0x6f, 0xdf, 0x0d, 0x3a, 0xdb, 0xef, 0xff, 0x45, 0xaf, 0xfd, 0x6e, 0xfb, 0x7d, 0xf6, 0xf7, 0x8f,
+  0x1b, 0xf5, 0xf5, 0x07, 0xb9, 0xf8, 0xf0, 0x9d, 0x17, 0xbb, 0x17, 0x94, 0x64, 0x37, 0x86, 0xea,
+  0xae, 0x1e, 0xc5, 0xac, 0x7c, 0x13, 0x60, 0x08, 0x3d, 0x23, 0x0d, 0x7f, 0x56, 0xe1, 0x21, 0x6b,
+  0x52, 0xe4, 0x15, 0xdc, 0xdb, 0xdd, 0xdd, 0xde, 0xcd, 0x7c, 0xf0, 0xfb, 0xfb, 0xdb, 0x06, 0x46,
+  0x72, 0x28, 0x16, 0x6d, 0x5b, 0x49, 0xb5, 0x22, 0x84, 0x4c, 0xb5, 0x0e, 0x98, 0x6a, 0x65, 0x5d,
+  0x6f, 0x96, 0x43, 0x6f, 0xa3, 0x54, 0xd4, 0xf0, 0x27, 0x69, 0xf1, 0xe0, 0x03, 0xc7, 0x6b, 0x57,
+  0x61, 0x16, 0x6b, 0x6d, 0x17, 0x37, 0xcc, 0x96, 0xe5, 0x3b, 0xd9, 0x45, 0x6e, 0x59, 0xd2, 0xa8,
+  0xbf, 0x8a, 0xef, 0x44, 0xf1, 0x7d, 0x47, 0x39, 0x49, 0xc8, 0x2f, 0x46, 0x9a, 0xff, 0x19, 0xd7,
+  0xa4, 0x25, 0x85, 0x42, 0xb4, 0x34, 0xff, 0x2a, 0x4d, 0xd9, 0xe7, 0xfc, 0xa0, 0x8b, 0x8e, 0xeb,
+  0x1c, 0xfc, 0xad, 0x11, 0x45, 0x98, 0x67, 0xc0, 0x79, 0xb0, 0x74, 0x27, 0x89, 0xc2, 0xc0, 0xd7,
+  0x66, 0xd9, 0x07, 0x03, 0xd1, 0x1a, 0xc9, 0xbc, 0x9d, 0x7d, 0xfc, 0xdc, 0x4b, 0xea, 0x88, 0x88,
+  0x4b, 0x21, 0xee, 0xd2, 0x97, 0xfc, 0x90, 0xa6, 0x3d, 0x37, 0xea, 0x9f, 0xad, 0xd7, 0x26, 0xbe,
+  0xca, 0xa2, 0x51, 0xba, 0x6c, 0x3c, 0xa3, 0x1e, 0xbf, 0x5d, 0x49, 0x73, 0x11, 0xfa, 0x30, 0x11,
+  0x61, 0xc1, 0x45, 0xf3, 0xe2, 0x8e, 0x7a, 0x9c, 0x2c, 0x7c, 0x9e, 0x77, 0xec, 0xb9, 0x77, 0xf9,
+  0xd5, 0x24, 0xbd, 0x06, 0xb8, 0x0a, 0xc9, 0x87, 0xbf, 0x82, 0xf5, 0x3a, 0xe4, 0xe6, 0x48, 0x0e,
+  0x82, 0x69, 0xce, 0xe6, 0x47, 0x69, 0x93, 0x14, 0x82, 0x02, 0xc1, 0xdc, 0x71, 0xb7, 0x9a, 0x07,
+  0x32, 0x58, 0x50, 0xf2, 0x24, 0x8a, 0xdc, 0x28, 0x76, 0xfc, 0x98, 0xa4, 0xb5, 0x6c, 0xcb, 0x65,
+  0x7a, 0xe3, 0xc9, 0xd2, 0xae, 0x1a, 0x5d, 0xa5, 0x33, 0x99, 0x6d, 0x83, 0x60, 0xb9, 0xb9, 0xc2,
+  0xab, 0xac, 0xaf, 0xd0, 0x14, 0x82, 0x7e, 0xc6, 0xd8, 0xd7, 0x94, 0xf0, 0x31, 0x69, 0x2d, 0xa2,
+  0x4a, 0xb3, 0x59, 0x86, 0x54, 0x64, 0x51, 0xef, 0xf5, 0xfb, 0xb8, 0x12, 0x26, 0x7b, 0xa9, 0x7e,
+  0xde, 0xd7, 0x22, 0xe3, 0x90, 0xea, 0x63, 0x86, 0x4c, 0xf7, 0x0d, 0x8a, 0x43, 0x34, 0xa7, 0x11,
+  0x71, 0x7d, 0xd8, 0x71, 0xc1, 0xc6, 0x3b, 0x12, 0x27, 0x65, 0xf7, 0xd3, 0xfd, 0x26, 0xb3, 0x9a,
+  0x21, 0xba, 0x31, 0xbb, 0xfa, 0x15, 0xb0, 0xc8, 0x30, 0x85, 0xad, 0xc6, 0x74, 0x51, 0xa9, 0x21,
+  0xdc, 0x60, 0x99, 0x9d, 0xcd, 0x30, 0x15, 0xdc, 0x28, 0x8e, 0x3e, 0x18, 0xf2, 0xcc, 0x5e, 0xfd,
+  0x03, 0xed, 0x95, 0xc0, 0xde, 0xae, 0x1e, 0x4a, 0xc4, 0x43, 0x78, 0x52, 0xab, 0x76, 0x94, 0x45,
+  0xf5, 0x9c, 0x61, 0xe8, 0x03, 0x39, 0x09, 0x16, 0x0b, 0x18, 0xa8, 0x88, 0x00, 0x97, 0x0f, 0x27,
+  0xc1, 0x94, 0x1e, 0x3f, 0xf4, 0xe2, 0x83, 0x31, 0x68, 0x26, 0x36, 0xff, 0x1e, 0x5e, 0xc4, 0x07,
+  0x5b, 0x93, 0xc5, 0xf4, 0x70, 0x8b, 0x95, 0x8d, 0x0e, 0xc7, 0xa1, 0x02, 0x9f, 0x7d, 0x4d, 0x62,
+  0xa2, 0x30, 0x8a, 0x8b, 0x7d, 0x20, 0xff, 0xf7, 0x7f, 0xe9, 0x45, 0xb3, 0x59, 0xae, 0x8c, 0x07,
+  0xaa, 0x8f, 0x26, 0x3c, 0x8c, 0x5c, 0x2b, 0xcc, 0x4e, 0x27, 0x46, 0xbb, 0x83, 0x61, 0xae, 0x18,
+  0x3d, 0xbf, 0x52, 0x95, 0xb4, 0x67, 0x1d, 0xbf, 0x94, 0x7e, 0xbc, 0x3c, 0x28, 0x11, 0xff, 0x8d,
+  0x1b, 0x4e, 0x99, 0xb2, 0xf9, 0xd9, 0xd9, 0x57, 0xaf, 0x49, 0x2b, 0xa4, 0x2c, 0xd1, 0xd0, 0xb4,
+  0x4d, 0x9c, 0xd5, 0xcc, 0xca, 0x07, 0xbc, 0x82, 0x48, 0x13, 0x54, 0x52, 0xcd, 0xc6, 0x02, 0x95,
+  0x62, 0xf2, 0xfd, 0x5f, 0xfe, 0x17, 0x45, 0x71, 0x7d, 0xff, 0x97, 0x7f, 0x0b, 0xfb, 0xc8, 0x90,
+  0x5c, 0xd0, 0x0f, 0x7f, 0x44, 0xfd, 0x06, 0xb2, 0xfa, 0x9c, 0xe2, 0x2a, 0x51, 0xde, 0xc5, 0x16,
+  0x7e, 0x9f, 0x41, 0x65, 0xfc, 0x24, 0xfa, 0xeb, 0x59, 0x28, 0x7b, 0x13, 0x7e, 0xf8, 0x23, 0xec,
+  0x87, 0xef, 0x24, 0xda, 0x5e, 0xad, 0x60, 0xf3, 0x06, 0x6b, 0x13, 0x9e, 0x49, 0xb6, 0xee, 0x7a,
+  0x4f, 0x7b, 0x38, 0xd9, 0x54, 0x3d, 0xc4, 0xe9, 0x9c, 0x3a, 0x11, 0x81, 0xb1, 0xe5, 0x08, 0x03,
+  0xa2, 0x0b, 0x50, 0x97, 0x31, 0xb9, 0xa6, 0x21, 0xcc, 0xc7, 0x9e, 0x34, 0x31, 0x96, 0x9b, 0xde,
+  0xf8, 0x3d, 0x75, 0x26, 0x97, 0xab, 0x25, 0x9b, 0xa5, 0x78, 0x6d, 0x33, 0x08, 0xe9, 0x27, 0xda,
+  0xfc, 0x8d, 0x59, 0xc7, 0xe6, 0xed, 0x9f, 0x40, 0xea, 0x61, 0x82, 0xd2, 0x0f, 0xbc, 0x01, 0xb4,
+  0xa2, 0x5a, 0xa2, 0x2a, 0xec, 0xef, 0x01, 0x2b, 0x9a, 0xe1, 0x34, 0x14, 0xa7, 0x9e, 0xe4, 0xcc,
+  0x65, 0x5a, 0x94, 0x08, 0xfa, 0x5f, 0xcc, 0x43, 0x90, 0x51, 0x25, 0x36, 0x93, 0x60, 0x12, 0x26,
+  0xa2, 0xd5, 0x87, 0xcd, 0x08, 0x4d, 0x34, 0x1a, 0xc8, 0xb6, 0xda, 0xe0, 0xda, 0xa5, 0xec, 0xd9,
+  0x56, 0x1a, 0x1a, 0xe5, 0xa8, 0xf0, 0x5a, 0xbf, 0x25, 0x68, 0xb0, 0x38, 0x64, 0x52, 0xd2, 0xd6,
+  0x9c, 0x71, 0x4f, 0x85, 0x8c, 0xc8, 0x62, 0xa7, 0xe2, 0x88, 0xb3, 0x5f, 0xd0, 0x3c, 0x47, 0xdd,
+  0x08, 0xf3, 0xc5, 0x73, 0x58, 0x80, 0x98, 0xe9, 0x6b, 0x5e, 0x67, 0xab, 0x8b, 0x71, 0xc8, 0x85,
+  0xe6, 0xb9, 0xeb, 0x49, 0xe9, 0x6d, 0xc4, 0x1b, 0x0d, 0x44, 0x4a, 0x38, 0x37, 0x64, 0xf9, 0x42,
+  0x8b, 0x4c, 0x92, 0x19, 0x03, 0x91, 0xa4, 0x22, 0x48, 0x61, 0x62, 0xd6, 0xc3, 0x65, 0x7c, 0xd4,
+  0xe8, 0xfd, 0x46, 0xbe, 0xef, 0xae, 0x3e, 0xd6, 0x64, 0x9a, 0x65, 0xdd, 0x67, 0xa0, 0x51, 0x5c,
+  0x7b, 0x9c, 0x76, 0xc2, 0xba, 0xc0, 0x9f, 0x78, 0xee, 0xe4, 0x12, 0x40, 0x06, 0x93, 0xd5, 0x02,
+  0x64, 0xae, 0x77, 0x41, 0xe3, 0x53, 0x8f, 0xe2, 0xcf, 0xa7, 0xb7, 0x2f, 0xa6, 0xad, 0xa6, 0x84,
+  0x4e, 0xb3, 0xdd, 0x63, 0xb5, 0x5b, 0x6d, 0x3d, 0xe3, 0x01, 0xcb, 0xc2, 0x6c, 0x9c, 0xed, 0x5c,
+  0x26, 0x80, 0xa9, 0xe9, 0x71, 0xbb, 0xa5, 0xc0, 0xc8, 0xea, 0x9c, 0x63, 0x41, 0x5b, 0xae, 0xcb,
+  0x66, 0x85, 0xd9, 0x4e, 0x56, 0x33, 0x1f, 0x5e, 0x3b, 0xa1, 0x0f, 0x05, 0x6d, 0xf3, 0x1a, 0xfa,
+  0x0d, 0x94, 0xaa, 0x2b, 0xe8, 0x33, 0xd0, 0x9f, 0xdf, 0x68, 0xc8, 0x93, 0x0f, 0xdf, 0x81, 0xcd,
+  0x04, 0x76, 0x48, 0x48, 0xdd, 0x71, 0x8c, 0x0f, 0xb1, 0x51, 0x16, 0x21, 0xce, 0x0b, 0x15, 0x83,
+  0xe0, 0xb3, 0x3a, 0x2a, 0x96, 0xe7, 0x82, 0x4c, 0x6b, 0x25, 0xf7, 0x5e, 0xf1, 0x4a, 0xfc, 0x37,
+  0x6c, 0x02, 0x72, 0xb5, 0xcd, 0x3b, 0x1c, 0x3e, 0xf4, 0xc7, 0xd1, 0xf2, 0x20, 0x89, 0x42, 0x92,
+  0x43, 0xd4, 0xe3, 0x34, 0xb5, 0x9a, 0x6a, 0x9c, 0x8c, 0x3d, 0xc0, 0x17, 0xfe, 0xa5, 0x53, 0x37,
+  0x86, 0x6a, 0x63, 0x47, 0xc9, 0x7b, 0x74, 0xb8, 0x95, 0xf5, 0x7f, 0xb8, 0xc5, 0xf3, 0xbf, 0x3d,
+  0x50, 0xd5, 0x98, 0x96, 0xb2, 0x4f, 0x24, 0x25, 0xc3, 0x8f, 0x27, 0xd9, 0xb7, 0x7c, 0x7a, 0x32,
+  0xfe, 0xc9, 0x01, 0x8d, 0xe5, 0x4e, 0x12, 0xdd, 0x99, 0x11, 0x7e, 0x18, 0x4d, 0x42, 0x77, 0x29,
+  0x62, 0xf8, 0x67, 0x2b, 0x9f, 0xc7, 0xcb, 0x44, 0xf3, 0xe0, 0xfa, 0x1c, 0x21, 0xb7, 0x16, 0xb0,
+  0xf8, 0x3b, 0x17, 0xb4, 0xc3, 0xa6, 0x0e, 0x39, 0x22, 0x4d, 0x4c, 0x21, 0xda, 0x6c, 0xcb, 0x89,
+  0x58, 0xa3, 0x98, 0x64, 0x79, 0x04, 0x8f, 0x88, 0x55, 0xba, 0x55, 0x54, 0x9b, 0x52, 0x82, 0x5b,
+  0x04, 0xc1, 0xf3, 0xf6, 0x4a, 0xcd, 0x27, 0x21, 0x85, 0x79, 0x25, 0x20, 0xb4, 0x9a, 0x80, 0x70,
+  0xd6, 0x84, 0x67, 0x33, 0x65, 0x7c, 0x79, 0x0d, 0xbb, 0x75, 0x68, 0xf6, 0x6b, 0xde, 0xfe, 0xc7,
+  0xef, 0x10, 0xcf, 0xf7, 0xbf, 0x56, 0x2b, 0xe2, 0x3e, 0x52, 0xe8, 0x79, 0xa8, 0x2a, 0x48, 0x52,
+  0xab, 0x44, 0x34, 0x7e, 0x12, 0xc7, 0xa1, 0x0b, 0x13, 0x83, 0xc2, 0x44, 0x84, 0x55, 0xb0, 0xd9,
+  0x21, 0x4d, 0xc7, 0x83, 0xf1, 0x54, 0x30, 0xe5, 0xc8, 0xf7, 0x70, 0xdb, 0xe3, 0x4f, 0x4f, 0xe6,
+  0xae, 0x37, 0x6d, 0x31, 0x00, 0x50, 0x47, 0x54, 0xc2, 0x8b, 0x0d, 0xee, 0x82, 0x06, 0xab, 0xb8,
+  0xd5, 0x6a, 0x93, 0xa3, 0x63, 0x39, 0x5f, 0x29, 0xef, 0x0a, 0xa7, 0x4d, 0x2f, 0x4d, 0x6c, 0x88,
+  0x4c, 0xcd, 0xe7, 0xe8, 0xc5, 0x04, 0x87, 0x60, 0xb0, 0xc3, 0x46, 0x26, 0xa2, 0xcd, 0x2c, 0xbb,
+  0x60, 0x0e, 0x38, 0x07, 0x19, 0xd2, 0x05, 0xec, 0x79, 0x5a, 0xed, 0x0e, 0x3e, 0xb7, 0x9c, 0xa5,
+  0x1a, 0x64, 0x7f, 0x6a, 0xcf, 0x54, 0xa5, 0xfc, 0xfd, 0x2d, 0xd8, 0xab, 0xb7, 0x67, 0xec, 0x06,
+  0x47, 0x10, 0x3e, 0xf1, 0xbc, 0x56, 0x33, 0xf7, 0x2a, 0x38, 0x28, 0x21, 0x50, 0xbd, 0xa7, 0xce,
+  0x64, 0xde, 0x12, 0xcf, 0x84, 0x4b, 0xe4, 0xf0, 0x2f, 0x3d, 0x67, 0x3a, 0x3d, 0xc5, 0x1c, 0xc1,
+  0x2f, 0xc1, 0xee, 0xa1, 0xc0, 0x9a, 0x56, 0x93, 0xe9, 0x2d, 0xe0, 0x9e, 0x4e, 0x3d, 0x1f, 0xe7,
+  0xb4, 0x0f, 0xa0, 0x5b, 0x80, 0xe0, 0xef, 0x48, 0x89, 0x91, 0x3e, 0xd0, 0xea, 0xbb, 0xd1, 0x57,
+  0xf8, 0xda, 0xf4, 0x51, 0xd6, 0x90, 0x8f, 0x3b, 0xf6, 0xd7, 0x13, 0x03, 0x12, 0xb5, 0x9a, 0xf8,
+  0x24, 0x75, 0x53, 0x4a, 0x42, 0x69, 0xaa, 0x1d, 0x07, 0x17, 0x17, 0x1e, 0xcd, 0xd7, 0x15, 0x68,
+  0xa8, 0x22, 0xa0, 0x58, 0x3b, 0x40, 0xcd, 0x67, 0x1c, 0x91, 0x8c, 0xb9, 0xd9, 0x88, 0x5b, 0x39,
+  0x71, 0x49, 0x6f, 0xa7, 0xc1, 0xb5, 0x8f, 0xbc, 0xa0, 0x1a, 0x33, 0xdc, 0x19, 0x7c, 0xeb, 0x41,
+  0x05, 0x72, 0x74, 0x04, 0x02, 0x70, 0x8a, 0xcb, 0x60, 0x93, 0xfc, 0xee, 0x77, 0x44, 0xfa, 0x48,
+  0xa4, 0x79, 0x86, 0xff, 0x43, 0x7b, 0x18, 0x80, 0x04, 0x3d, 0x3c, 0xa3, 0x33, 0x67, 0xe5, 0xc5,
+  0x2d, 0x89, 0x86, 0x14, 0x0b, 0xb1, 0x6a, 0x64, 0x25, 0xef, 0x25, 0x84, 0x15, 0xc4, 0x39, 0x7f,
+  0xf9, 0x1e, 0xe1, 0xc4, 0x09, 0x61, 0x87, 0x72, 0x54, 0x28, 0x1d, 0xd2, 0x45, 0xd8, 0x84, 0x7b,
+  0x32, 0x88, 0x97, 0xb8, 0x7c, 0x20, 0x8c, 0x04, 0x65, 0x96, 0xdd, 0x62, 0x44, 0x9a, 0x2c, 0x31,
+  0x45, 0x33, 0x79, 0x62, 0x81, 0x6d, 0x46, 0xe0, 0x2b, 0x8b, 0x34, 0x4e, 0xbf, 0x62, 0x6e, 0x07,
+  0xf8, 0x88, 0x79, 0x19, 0xd2, 0x6f, 0x3c, 0xb7, 0x02, 0x7c, 0xe5, 0x59, 0x11, 0xd2, 0xef, 0x2c,
+  0xb3, 0x01, 0xc2, 0xc5, 0x7f, 0xd3, 0xaf, 0x2c, 0xb1, 0x00, 0x7c, 0x65, 0x39, 0x01, 0xd2, 0xaf,
+  0xec, 0x5e, 0x3f, 0x7c, 0x65, 0x57, 0xf2, 0xd3, 0xaf, 0xec, 0x5a, 0x3d, 0x7c, 0x65, 0x37, 0xe2,
+  0x33, 0xb8, 0xec, 0x1a, 0x3a, 0x02, 0x66, 0x3f, 0xd2, 0xef, 0x78, 0xa7, 0x1c, 0xbe, 0xe2, 0x7d,
+  0xf0, 0x0c, 0x2e, 0xbb, 0x84, 0x8d, 0x80, 0xd9, 0x8f, 0x8c, 0x0e, 0x76, 0x05, 0x1a, 0x29, 0x61,
+  0x3f, 0x32, 0xd8, 0xc9, 0x7d, 0x66, 0x04, 0x9f, 0xde, 0x42, 0xce, 0x8a, 0xb3, 0x9b, 0xc4, 0x58,
+  0x41, 0xba, 0xc3, 0xd3, 0xe4, 0x63, 0x26, 0x86, 0x2c, 0x53, 0xd0, 0x20, 0xab, 0xec, 0xc9, 0x3a,
+  0x9e, 0xa7, 0xb1, 0xc5, 0x87, 0x20, 0x13, 0x17, 0x69, 0x54, 0xd3, 0x29, 0xcc, 0x1e, 0xc0, 0x55,
+  0x67, 0x24, 0x3e, 0xa8, 0x9b, 0xcd, 0x0f, 0xa1, 0x45, 0x9a, 0xfc, 0x31, 0x3c, 0x79, 0x86, 0xa0,
+  0xb4, 0xb2, 0xca, 0x78, 0xff, 0x19, 0xfa, 0x16, 0xb2, 0xc0, 0xc4, 0x54, 0xef, 0xda, 0x00, 0x18,
+  0x66, 0x86, 0x09, 0x6a, 0x4e, 0x32, 0x39, 0x91, 0x55, 0x70, 0xe7, 0x4f, 0x01, 0xd7, 0x54, 0x3d,
+  0x09, 0xd2, 0xc4, 0x40, 0x8a, 0xa4, 0x39, 0x60, 0xe0, 0x6e, 0x55, 0xb6, 0x1a, 0xe6, 0xbc, 0x05,
+  0x81, 0x4f, 0x3a, 0xe3, 0x05, 0x97, 0xeb, 0xcd, 0x77, 0xcc, 0x5b, 0x74, 0xea, 0x15, 0xae, 0xd3,
+  0x50, 0x43, 0x9d, 0xe0, 0x4a, 0x4e, 0xd0, 0xe2, 0xc6, 0x4a, 0x55, 0x23, 0x94, 0xec, 0xfc, 0xb3,
+  0x12, 0xa4, 0xac, 0xba, 0x11, 0x5a, 0x92, 0xf1, 0xb2, 0x12, 0xac, 0xa4, 0xb2, 0x0a, 0x49, 0xca,
+  0x20, 0x59, 0x0c, 0x45, 0xaa, 0xa8, 0x42, 0xc8, 0x32, 0x37, 0x16, 0x03, 0xc8, 0xea, 0xa9, 0xed,
+  0xe3, 0x3b, 0xae, 0x69, 0x0b, 0x47, 0xe5, 0x4e, 0x6d, 0x93, 0xdd, 0x1c, 0x2d, 0x6f, 0x9b, 0xd5,
+  0xd5, 0x29, 0x8f, 0xcf, 0xef, 0xf8, 0x3e, 0xae, 0x98, 0x6e, 0xa8, 0xa6, 0xb6, 0xcc, 0x3c, 0x43,
+  0xcc, 0x6a, 0x29, 0xb4, 0xfb, 0xc6, 0x96, 0x11, 0xd4, 0xa2, 0x7e, 0xab, 0x81, 0x60, 0x55, 0x6d,
+  0x70, 0x44, 0x98, 0x6d, 0x35, 0x48, 0xa2, 0xb2, 0xc6, 0x11, 0x25, 0x44, 0xb6, 0x02, 0x6b, 0x94,
+  0xfa, 0x4d, 0x75, 0xaa, 0x49, 0xc1, 0x93, 0x65, 0x52, 0x21, 0xaa, 0xa9, 0xc8, 0x28, 0x91, 0x7a,
+  0xe5, 0x7c, 0x56, 0xaa, 0x6b, 0x90, 0xe4, 0xf0, 0xae, 0x0a, 0x90, 0xe4, 0xea, 0xa6, 0xc9, 0xf2,
+  0xca, 0xf5, 0xcb, 0xa1, 0xa4, 0x55, 0x8d, 0x10, 0x9c, 0x9b, 0xca, 0x10, 0x9c, 0x9b, 0x02, 0xbe,
+  0x94, 0xca, 0x4e, 0xbe, 0x76, 0x01, 0x6f, 0xca, 0xa1, 0xe5, 0x6a, 0x5b, 0xf8, 0x53, 0x0a, 0x49,
+  0xad, 0x69, 0xe1, 0x51, 0x55, 0x28, 0xa2, 0x66, 0x5e, 0x98, 0x31, 0xe4, 0xa4, 0x9a, 0x18, 0x63,
+  0x4d, 0x4d, 0x80, 0xa5, 0x30, 0x86, 0x13, 0x71, 0x8c, 0x53, 0xc8, 0x9b, 0xac, 0xba, 0xc6, 0xe2,
+  0x34, 0x10, 0xa0, 0x9c, 0xbf, 0x69, 0xd5, 0x3c, 0x08, 0x3c, 0x7f, 0xae, 0x04, 0x00, 0x2b, 0xe6,
+  0x9b, 0xe3, 0xc9, 0x70, 0xa5, 0xe6, 0x58, 0xd1, 0xd0, 0xbb, 0x38, 0x65, 0xad, 0x86, 0x81, 0xa8,
+  0x9c, 0x07, 0xc3, 0x5c, 0xc1, 0x95, 0x60, 0xb0, 0x9a, 0x79, 0x00, 0xd9, 0x01, 0x61, 0xd5, 0x31,
+  0xc9, 0x5a, 0xe4, 0xa1, 0x49, 0x87, 0x52, 0x95, 0x90, 0x92, 0xea, 0x1b, 0x50, 0x4b, 0xce, 0xde,
+  0x2a, 0x63, 0x96, 0x34, 0xc8, 0x0b, 0x2e, 0x1e, 0x07, 0x55, 0x13, 0x5c, 0xac, 0x69, 0x90, 0xb7,
+  0x0a, 0xeb, 0x71, 0x56, 0x4f, 0x6d, 0xaf, 0x64, 0xf0, 0x2d, 0x06, 0xa1, 0x54, 0x55, 0xa1, 0xa4,
+  0x59, 0x72, 0x8b, 0x21, 0xa4, 0xd5, 0xd4, 0xd6, 0x69, 0xaa, 0xd9, 0xe2, 0xd6, 0x69, 0x35, 0xb5,
+  0xb5, 0x9c, 0x63, 0xb5, 0x18, 0x80, 0x5c, 0x53, 0x1b, 0x05, 0xf9, 0x1e, 0x7c, 0xe1, 0x20, 0xc8,
+  0x15, 0x75, 0x18, 0xd2, 0x9d, 0xf7, 0x62, 0x18, 0x52, 0x45, 0x13, 0x1e, 0xe5, 0x9a, 0x90, 0x55,
+  0x33, 0x75, 0x5f, 0xa1, 0x29, 0x56, 0xcb, 0xcb, 0x60, 0x76, 0xe7, 0xf9, 0x69, 0x5c, 0x2a, 0x86,
+  0x59, 0x65, 0x1d, 0x87, 0xe4, 0x52, 0x6d, 0x85, 0x05, 0x2f, 0xad, 0x6b, 0x83, 0x51, 0x81, 0x16,
+  0xa5, 0xaa, 0x71, 0x48, 0xab, 0xa1, 0x22, 0xaa, 0x5a, 0x20, 0x54, 0x1c, 0x0f, 0x1b, 0x1e, 0xe2,
+  0xc6, 0x63, 0x15, 0x3c, 0x44, 0x55, 0x0b, 0x84, 0x8a, 0x83, 0x6b, 0xc1, 0x43, 0xbd, 0xb8, 0x58,
+  0x65, 0x94, 0xb3, 0xda, 0x2a, 0x28, 0x2d, 0x5f, 0x6e, 0xf1, 0xa4, 0xd3, 0x2a, 0xa7, 0xcb, 0xae,
+  0x47, 0x65, 0x73, 0xf6, 0x19, 0xe5, 0x2e, 0x10, 0xc5, 0xd7, 0x82, 0xde, 0x63, 0xff, 0xe2, 0xb9,
+  0x4b, 0x3d, 0xe6, 0xb0, 0xf1, 0xc1, 0xdc, 0x3d, 0xa3, 0x6c, 0x63, 0xa8, 0x7a, 0x08, 0x60, 0xe3,
+  0x18, 0xc7, 0xee, 0xec, 0xd6, 0xe2, 0x20, 0x80, 0xd2, 0x55, 0xe8, 0x2b, 0xae, 0x9b, 0x5f, 0xf1,
+  0x3f, 0xbe, 0xc5, 0x3d, 0xa9, 0xa8, 0xdf, 0x9b, 0xcc, 0x9d, 0xf0, 0x49, 0xdc, 0xea, 0xb7, 0x7b,
+  0x71, 0xf0, 0x16, 0x43, 0x3d, 0x4e, 0x60, 0xcf, 0x0c, 0xbb, 0xeb, 0x9f, 0x88, 0x96, 0xbd, 0x08,
+  0xb6, 0x9f, 0xb4, 0x35, 0x68, 0xab, 0x5b, 0xf8, 0xcc, 0x4f, 0x71, 0xeb, 0x4f, 0xf8, 0x18, 0x33,
+  0xee, 0xb7, 0xf8, 0xd3, 0xb4, 0x1d, 0xfe, 0x06, 0x60, 0x87, 0xc7, 0x38, 0x64, 0x48, 0xf1, 0xd2,
+  0x1e, 0xfb, 0x0a, 0xb4, 0xb1, 0x7f, 0x93, 0x8d, 0x2d, 0x6b, 0x61, 0x2a, 0xca, 0x75, 0xe9, 0xcc,
+  0xe8, 0xdb, 0x25, 0x26, 0x1f, 0x68, 0xcd, 0x90, 0x4b, 0xe8, 0x20, 0xee, 0x90, 0xe2, 0x8e, 0x71,
+  0x6f, 0xfe, 0x99, 0xc2, 0xda, 0xde, 0xdc, 0x89, 0xb2, 0xf6, 0x6d, 0x79, 0x5b, 0x5e, 0x89, 0x26,
+  0xf3, 0x73, 0x53, 0x09, 0x8e, 0x2b, 0x86, 0x5f, 0x66, 0x48, 0xbe, 0x7d, 0xd1, 0xd2, 0x30, 0x32,
+  0x6c, 0x96, 0x35, 0x37, 0xb6, 0xc2, 0x1d, 0x89, 0x68, 0x79, 0xbf, 0xd5, 0xc9, 0x6d, 0xd4, 0x3a,
+  0xfa, 0xb6, 0x4b, 0x47, 0x98, 0x8b, 0x99, 0xb8, 0xcc, 0x08, 0xdd, 0x70, 0xc4, 0xc8, 0x16, 0x0b,
+  0xa2, 0x6e, 0x93, 0x3f, 0xc3, 0xf3, 0xa7, 0xf4, 0x55, 0x2a, 0x7d, 0x33, 0x25, 0x7c, 0xdb, 0x20,
+  0xd8, 0x6f, 0xc2, 0x00, 0x60, 0xc4, 0xb7, 0xad, 0xa6, 0xe9, 0x92, 0x24, 0x20, 0x96, 0xf4, 0xf0,
+  0x13, 0xd2, 0xfc, 0xbc, 0x69, 0x93, 0x1e, 0x2a, 0x4c, 0x80, 0x97, 0x81, 0x83, 0xf9, 0xbd, 0x5b,
+  0xfc, 0xd8, 0xaa, 0x43, 0x3c, 0xfe, 0xb7, 0x3a, 0x80, 0xb9, 0x8f, 0x80, 0x20, 0xab, 0xaf, 0x7b,
+  0xa2, 0x44, 0x45, 0xd9, 0x15, 0x25, 0x2a, 0xc2, 0x6a, 0x9e, 0x6c, 0xd7, 0xf0, 0xa0, 0x24, 0x1d,
+  0x44, 0x42, 0x31, 0xe1, 0x67, 0x01, 0xdc, 0xc4, 0x75, 0x56, 0x09, 0x34, 0x3b, 0x39, 0xaf, 0x22,
+  0x20, 0xdc, 0x2e, 0x78, 0x8a, 0xe9, 0xf4, 0x5b, 0x94, 0xeb, 0x8f, 0x0e, 0xe1, 0x69, 0x9a, 0x73,
+  0x22, 0x2c, 0xca, 0x95, 0x43, 0x91, 0xa6, 0x9c, 0x96, 0x3f, 0x3d, 0x45, 0x40, 0x5e, 0xf1, 0x02,
+  0xee, 0x74, 0x12, 0xcf, 0x10, 0x30, 0x5f, 0x94, 0x98, 0x5f, 0x47, 0x9c, 0x7e, 0xf5, 0x4b, 0xf3,
+  0x89, 0xaf, 0xd5, 0x69, 0xfe, 0x82, 0x86, 0x63, 0x76, 0x00, 0xa6, 0x17, 0x9c, 0x86, 0x97, 0x8e,
+  0x8f, 0x06, 0x85, 0xc4, 0xb4, 0x3c, 0x86, 0x3f, 0x41, 0x97, 0x97, 0xf2, 0x16, 0x42, 0x53, 0x63,
+  0xb9, 0x8e, 0xab, 0x38, 0x40, 0xd4, 0xbb, 0xfb, 0x29, 0x8d, 0x61, 0xb6, 0xd4, 0xe9, 0x2f, 0x01,
+  0x54, 0xd2, 0x1f, 0x8b, 0x84, 0xd2, 0x7a, 0x63, 0xc3, 0xa7, 0xb3, 0x66, 0xa5, 0xf3, 0xaf, 0xf9,
+  0x1a, 0x1f, 0x38, 0x21, 0xb4, 0x2e, 0x23, 0x78, 0x8f, 0x25, 0x68, 0x69, 0x87, 0x70, 0x25, 0x20,
+  0x59, 0x6d, 0xab, 0x2c, 0x17, 0x36, 0x15, 0x8f, 0x38, 0x34, 0x8d, 0xd2, 0xea, 0xa0, 0x26, 0xcc,
+  0x64, 0x76, 0x46, 0xe3, 0xc9, 0xfc, 0x67, 0xb0, 0x9c, 0xb5, 0x56, 0xa1, 0xa7, 0x9f, 0x10, 0x82,
+  0x99, 0xb9, 0x84, 0x1f, 0x28, 0x95, 0xce, 0xb5, 0xe3, 0xc6, 0xbc, 0x36, 0xd6, 0xec, 0x90, 0x77,
+  0x64, 0xe2, 0x4c, 0xe6, 0xe8, 0x35, 0xf7, 0x83, 0x2e, 0x3b, 0x01, 0x6f, 0xa6, 0xde, 0x4b, 0xa1,
+  0x9b, 0x93, 0xe6, 0xbd, 0xe0, 0x52, 0x26, 0x3b, 0x9e, 0x87, 0xc1, 0x35, 0x5b, 0x03, 0x4f, 0x91,
+  0x6d, 0xad, 0xe6, 0x6b, 0x1a, 0xdf, 0x5d, 0x03, 0xcf, 0x67, 0x74, 0xee, 0xe1, 0xfb, 0x9b, 0x4d,
+  0xd0, 0x2f, 0x69, 0x5b, 0xce, 0xc1, 0xdc, 0x93, 0x5e, 0x62, 0x29, 0x4c, 0xab, 0xe1, 0xf1, 0x7f,
+  0x4b, 0xd5, 0x48, 0x1a, 0xa5, 0x38, 0xcb, 0xcf, 0x70, 0x79, 0xf5, 0x2f, 0xa2, 0x56, 0x5b, 0x7a,
+  0x6e, 0xfb, 0x36, 0xe7, 0x73, 0x46, 0x2f, 0xb3, 0x4a, 0x33, 0xe3, 0x50, 0x73, 0xcb, 0x59, 0xba,
+  0x5b, 0x51, 0x6a, 0xf7, 0x67, 0x14, 0x09, 0x57, 0x60, 0xba, 0xd2, 0x21, 0x80, 0x5e, 0x7c, 0x87,
+  0xc2, 0xd5, 0x2c, 0xcb, 0x52, 0x29, 0x1d, 0x14, 0xe6, 0xdc, 0xa3, 0xda, 0xea, 0x21, 0x83, 0xed,
+  0x36, 0xf5, 0x43, 0x37, 0x9e, 0x53, 0xed, 0x17, 0x32, 0x0a, 0x99, 0x0f, 0x91, 0x7c, 0x91, 0xfb,
+  0x32, 0x22, 0x2d, 0xf6, 0x69, 0x15, 0xd1, 0xe1, 0xce, 0x97, 0xd9, 0xf7, 0x6c, 0xba, 0x7c, 0x41,
+  0x9a, 0x83, 0xe1, 0xbc, 0x09, 0x35, 0x9b, 0xc3, 0x9d, 0xb9, 0x72, 0xfa, 0xa6, 0x39, 0x32, 0x53,
+  0xca, 0x5b, 0x32, 0x16, 0x0f, 0x1f, 0xca, 0x48, 0xf5, 0xf8, 0xcb, 0x16, 0xdf, 0xb8, 0xf1, 0xbc,
+  0x05, 0x70, 0x9b, 0xb0, 0x3e, 0xb3, 0x0e, 0x04, 0xfc, 0xa6, 0xc4, 0x50, 0xfd, 0xa4, 0x84, 0xe1,
+  0x99, 0xfa, 0xf5, 0x15, 0xef, 0x3c, 0x2b, 0x52, 0xef, 0x55, 0x93, 0xcf, 0x80, 0x02, 0xd4, 0x70,
+  0x33, 0x1e, 0xbc, 0x26, 0x3b, 0xe7, 0x25, 0xbf, 0x1d, 0x7f, 0x4d, 0x98, 0xbb, 0xf9, 0xf2, 0x40,
+  0xf2, 0xbe, 0x79, 0xa9, 0x3f, 0xc5, 0x3d, 0x55, 0xd4, 0x9d, 0x6e, 0x76, 0x18, 0xbc, 0x83, 0x1d,
+  0x83, 0x6b, 0xac, 0x43, 0xf2, 0xdd, 0xb4, 0x8b, 0x31, 0x92, 0x5d, 0x5c, 0xb5, 0x30, 0xca, 0x7b,
+  0x19, 0x3b, 0x06, 0xf7, 0x5a, 0x82, 0x91, 0x5c, 0x50, 0x8c, 0x51, 0xea, 0x2a, 0xab, 0x83, 0x8d,
+  0xe6, 0xa9, 0xec, 0x68, 0xae, 0x39, 0x81, 0x45, 0xfa, 0xb1, 0x12, 0x06, 0xce, 0xcd, 0x1a, 0x18,
+  0x24, 0x9e, 0xce, 0x8e, 0xe6, 0xd6, 0x53, 0x31, 0x70, 0x6e, 0x14, 0x0c, 0x0c, 0xc3, 0x92, 0x79,
+  0xd7, 0x8a, 0x90, 0x30, 0xf8, 0xec, 0x74, 0xe9, 0x94, 0xaa, 0x14, 0x0b, 0x42, 0xea, 0x8b, 0x2b,
+  0xeb, 0x50, 0x72, 0xee, 0xa9, 0x8a, 0x2b, 0x2b, 0x2c, 0xed, 0x89, 0xdd, 0x2e, 0x29, 0xe9, 0x27,
+  0xf5, 0x00, 0xe6, 0x7b, 0xc1, 0xa2, 0xd2, 0x3e, 0x9e, 0x26, 0xa1, 0xa0, 0x65, 0x1d, 0x65, 0x5e,
+  0xba, 0x7c, 0x4f, 0x29, 0x10, 0xa9, 0xbb, 0x6c, 0x99, 0x4e, 0xab, 0xdd, 0xbb, 0x1f, 0xbd, 0x0f,
+  0x33, 0x49, 0x99, 0x73, 0xaf, 0xac, 0xaf, 0xbc, 0xe3, 0xd0, 0x24, 0x18, 0x59, 0xad, 0xf2, 0xae,
+  0xd3, 0x10, 0xfd, 0xb2, 0x9e, 0x75, 0xbf, 0xa0, 0xb1, 0xe3, 0xa4, 0x52, 0x69, 0xbf, 0x92, 0x0f,
+  0x52, 0xed, 0x19, 0x57, 0x09, 0xc3, 0x36, 0x2e, 0xef, 0xb8, 0xcc, 0xa3, 0xa8, 0xfb, 0x41, 0xf3,
+  0xc3, 0x21, 0xd5, 0x28, 0xc4, 0x70, 0x22, 0xdc, 0x2f, 0xb5, 0x34, 0x85, 0xe6, 0x23, 0xea, 0xe8,
+  0x1e, 0x1f, 0xa1, 0x2b, 0x12, 0xd8, 0xc5, 0xca, 0x2a, 0xe6, 0x7e, 0x97, 0x7a, 0x08, 0x28, 0x8e,
+  0xa1, 0x8e, 0xe6, 0xe7, 0x11, 0xdd, 0x0b, 0xc0, 0xc5, 0xbd, 0xcf, 0xb9, 0xb7, 0xa5, 0x5e, 0xef,
+  0x8a, 0x3b, 0xa8, 0xa3, 0x79, 0x77, 0x44, 0xef, 0x02, 0xb0, 0xe9, 0xa8, 0x1b, 0x0c, 0x48, 0xb0,
+  0xac, 0x48, 0x8b, 0xbf, 0x7c, 0x2d, 0xef, 0xd5, 0xd3, 0x40, 0xb6, 0x66, 0x62, 0xb0, 0x91, 0xcb,
+  0x00, 0x0c, 0x72, 0x4a, 0x7c, 0x66, 0x9f, 0x5f, 0x50, 0x16, 0x7c, 0x9a, 0xc4, 0x64, 0x33, 0x83,
+  0x91, 0x41, 0xe9, 0xa5, 0x91, 0x6f, 0x62, 0x13, 0x60, 0xde, 0xd2, 0x6f, 0x6d, 0x91, 0xe4, 0xcd,
+  0xa5, 0x31, 0x65, 0xa6, 0x3e, 0xfc, 0x12, 0xc1, 0xf0, 0x44, 0x32, 0xf2, 0x88, 0xe7, 0xd2, 0x19,
+  0x06, 0x07, 0x62, 0xf8, 0x20, 0xec, 0xde, 0x58, 0x11, 0x7f, 0x5c, 0xdd, 0x1c, 0xc4, 0x2e, 0x7b,
+  0xa9, 0x18, 0x04, 0x3e, 0xc7, 0x8f, 0xc8, 0xbb, 0x24, 0x18, 0x44, 0x33, 0x4a, 0x43, 0x3a, 0x03,
+  0x13, 0x76, 0xce, 0xfb, 0xb6, 0x5a, 0xa5, 0x2c, 0xba, 0x41, 0xd4, 0x29, 0x36, 0x4a, 0x33, 0x7a,
+  0x2b, 0x71, 0x97, 0x53, 0xb9, 0x51, 0xde, 0xa6, 0xa4, 0xc9, 0x48, 0x4f, 0x51, 0x3f, 0x65, 0x48,
+  0x7c, 0x35, 0xfe, 0x0d, 0xda, 0x8c, 0xb0, 0x75, 0x71, 0x2f, 0xfc, 0x96, 0xc4, 0x29, 0x10, 0x1a,
+  0x56, 0x53, 0xf5, 0x6b, 0x08, 0x73, 0x5c, 0xaa, 0x97, 0xda, 0x80, 0x3c, 0x30, 0xc2, 0x68, 0x26,
+  0x43, 0xc9, 0x81, 0xea, 0x97, 0x49, 0x42, 0x21, 0xb4, 0xea, 0x9a, 0xd3, 0x4d, 0xb5, 0x35, 0xab,
+  0xd8, 0xa3, 0xfa, 0x5c, 0xca, 0x4c, 0x69, 0x30, 0xd4, 0x8d, 0x26, 0xb6, 0x75, 0x9a, 0x6d, 0xd6,
+  0x92, 0xff, 0x82, 0xdb, 0xed, 0x68, 0x5f, 0xa3, 0x1d, 0x5f, 0xc5, 0x7e, 0x2f, 0xb2, 0xd7, 0x75,
+  0x73, 0x5d, 0x33, 0x7b, 0x0c, 0xfe, 0x31, 0x86, 0xd5, 0x58, 0x36, 0x18, 0x1f, 0x18, 0x6d, 0x34,
+  0x4e, 0xaa, 0x95, 0x2b, 0x4a, 0xb0, 0x87, 0x69, 0xb0, 0xa5, 0x0a, 0xfa, 0x46, 0xb1, 0xf6, 0x1e,
+  0x41, 0x9e, 0xbe, 0xe6, 0xad, 0x01, 0xf2, 0x01, 0xdd, 0x2a, 0x23, 0xee, 0x42, 0x90, 0xa2, 0x90,
+  0xa4, 0x90, 0x12, 0x0d, 0x4d, 0x0e, 0x2f, 0xab, 0x9a, 0xf7, 0x15, 0xc9, 0x8d, 0x3b, 0xb6, 0x6e,
+  0x53, 0xb7, 0x0f, 0xee, 0xbb, 0xc5, 0x36, 0x3f, 0xf1, 0x2e, 0xe5, 0x1f, 0x0c, 0x57, 0x16, 0x60,
+  0xc0, 0xc5, 0x87, 0x91, 0x2e, 0x32, 0x44, 0xcd, 0xf5, 0x0d, 0x96, 0xa3, 0x99, 0x46, 0xc9, 0xb3,
+  0x24, 0x47, 0x3c, 0xe5, 0x49, 0x95, 0x61, 0x74, 0x32, 0xa2, 0x3a, 0x32, 0x84, 0x76, 0xb1, 0xa1,
+  0x26, 0x4c, 0xe1, 0xea, 0xb8, 0xa5, 0xde, 0xa6, 0x5a, 0xa8, 0x25, 0x1e, 0xa7, 0x8e, 0xec, 0xae,
+  0xca, 0x61, 0x56, 0x15, 0x07, 0x55, 0x5a, 0x2a, 0x74, 0x9f, 0x0d, 0x31, 0x6b, 0x6b, 0x5a, 0x45,
+  0x1f, 0xe4, 0x06, 0x5b, 0x9c, 0x6e, 0x96, 0x6e, 0x3b, 0x4c, 0x82, 0xae, 0xb5, 0xb5, 0x09, 0xba,
+  0x76, 0xd6, 0x5a, 0x5b, 0xd6, 0xb5, 0xf6, 0x1d, 0x5b, 0xe7, 0xb2, 0xb8, 0xf3, 0x45, 0xc7, 0x20,
+  0xec, 0x46, 0x8d, 0x82, 0x86, 0x50, 0xde, 0xce, 0x34, 0x55, 0xf0, 0x57, 0x9e, 0xa7, 0x28, 0x1b,
+  0xf9, 0x60, 0x54, 0x5f, 0x2a, 0x9c, 0x30, 0xa2, 0xcf, 0xbd, 0xc0, 0x89, 0xf5, 0xbe, 0xf0, 0xac,
+  0xe5, 0xb9, 0x7b, 0x43, 0xa7, 0xad, 0x41, 0xdb, 0xea, 0xb5, 0x2b, 0x02, 0xdd, 0xec, 0x76, 0x9b,
+  0x25, 0x34, 0xa1, 0x79, 0x55, 0x48, 0x53, 0x5a, 0x21, 0x4f, 0x93, 0x74, 0x50, 0x5b, 0x89, 0x26,
+  0xac, 0x5f, 0x91, 0x26, 0x3b, 0x68, 0x95, 0x26, 0x9d, 0xa8, 0x20, 0x76, 0xd6, 0x92, 0x51, 0xa9,
+  0x1d, 0xca, 0x27, 0x5e, 0x34, 0x66, 0x02, 0xf2, 0xc2, 0x67, 0x97, 0x8e, 0x25, 0x31, 0x95, 0x0e,
+  0xf3, 0x6b, 0x8b, 0xa8, 0xd4, 0xb6, 0x63, 0xea, 0xb7, 0x92, 0x26, 0x56, 0xa9, 0xfd, 0x32, 0x88,
+  0x62, 0xcc, 0x53, 0xa0, 0x2a, 0x2d, 0x05, 0x49, 0xcc, 0x3e, 0x8a, 0x8c, 0x4b, 0xaa, 0x72, 0x67,
+  0xa8, 0x0e, 0x00, 0x3e, 0x71, 0xa0, 0x69, 0x20, 0x01, 0x62, 0x44, 0x7e, 0x47, 0x5e, 0xbc, 0x91,
+  0x1a, 0x64, 0x85, 0xf0, 0xd1, 0xa2, 0x3b, 0x34, 0x24, 0xb3, 0x26, 0xf6, 0x35, 0x22, 0x0b, 0x71,
+  0x30, 0xad, 0xc4, 0x69, 0xf1, 0x81, 0xb9, 0x45, 0x42, 0xa0, 0x94, 0xa9, 0x63, 0xf6, 0xe1, 0xbb,
+  0x90, 0x7c, 0x75, 0xfe, 0xa4, 0xcb, 0xcf, 0xc2, 0x22, 0x13, 0x09, 0x76, 0x29, 0x92, 0x43, 0x21,
+  0xec, 0x58, 0xab, 0xa1, 0x15, 0x26, 0xc4, 0xe5, 0x1a, 0x07, 0xd6, 0x76, 0x09, 0xfa, 0x4f, 0xfc,
+  0x3b, 0x67, 0xee, 0x11, 0x3c, 0x06, 0x4f, 0x9f, 0xec, 0x05, 0x33, 0x05, 0x2c, 0x73, 0x8f, 0x6d,
+  0x2c, 0x16, 0xfc, 0x31, 0x57, 0xa8, 0x10, 0x11, 0xf1, 0x22, 0x6d, 0x54, 0x30, 0x15, 0xb4, 0xa3,
+  0x65, 0x3b, 0x1d, 0xb9, 0x03, 0x6b, 0x13, 0x29, 0x3a, 0x34, 0xdd, 0x5d, 0x6c, 0x00, 0x92, 0xd0,
+  0xf5, 0xd3, 0x10, 0x6f, 0x9f, 0x22, 0xd6, 0x9c, 0x0e, 0x3f, 0x23, 0xcf, 0xae, 0x9d, 0x2c, 0x6f,
+  0xab, 0x96, 0xcd, 0xea, 0xd5, 0xb2, 0x3c, 0xac, 0xd9, 0x02, 0x5a, 0x0f, 0x73, 0x4f, 0x40, 0xa9,
+  0x33, 0xab, 0x0c, 0x41, 0xb4, 0x94, 0x23, 0x8b, 0x42, 0xb5, 0x34, 0x79, 0xe5, 0xfa, 0x2b, 0x10,
+  0xd1, 0xa2, 0x7d, 0x32, 0x49, 0x09, 0xd3, 0xc6, 0xe6, 0xd7, 0x3f, 0x7e, 0x57, 0x8a, 0xcd, 0xfb,
+  0x39, 0x29, 0xae, 0x25, 0x10, 0x78, 0xbf, 0xf8, 0xb5, 0x6c, 0x48, 0x18, 0xec, 0x10, 0x2b, 0x1a,
+  0x8a, 0x28, 0xc8, 0xce, 0x80, 0xf7, 0x45, 0xe3, 0x9b, 0x7b, 0x51, 0xb6, 0x6c, 0x74, 0xe7, 0xd0,
+  0xa0, 0x7c, 0x6c, 0x73, 0x60, 0xf5, 0x91, 0xe5, 0x60, 0x0a, 0xc6, 0x35, 0x07, 0xe1, 0xe7, 0x4f,
+  0x8b, 0x47, 0x87, 0x43, 0x2c, 0x18, 0x1b, 0x03, 0xc4, 0xf7, 0xe4, 0xe7, 0x4f, 0xcb, 0x19, 0x6e,
+  0x84, 0x5c, 0x91, 0xdd, 0x92, 0x67, 0x02, 0xb6, 0x99, 0x89, 0x2a, 0xc4, 0x03, 0x77, 0xc2, 0x5d,
+  0xb1, 0xdd, 0x33, 0x84, 0xc7, 0x6e, 0x2e, 0x44, 0x07, 0xe4, 0x4d, 0xe0, 0x79, 0x60, 0x97, 0xa2,
+  0x17, 0xa2, 0x03, 0x5b, 0x75, 0xdf, 0x57, 0x7d, 0x13, 0xb8, 0x93, 0x4f, 0xe0, 0x5d, 0xa5, 0x6f,
+  0xde, 0x12, 0x17, 0xc6, 0xa5, 0xe5, 0x78, 0xe8, 0xed, 0x78, 0x1a, 0x06, 0xd7, 0x11, 0x7a, 0x6d,
+  0xd8, 0xcd, 0x48, 0x06, 0xb6, 0x7b, 0xe6, 0x05, 0xd0, 0x78, 0x0c, 0x1b, 0xc2, 0x8b, 0xb8, 0x43,
+  0x3e, 0xfc, 0x11, 0x2b, 0x52, 0xf2, 0xdc, 0x0d, 0x17, 0x60, 0x06, 0xd3, 0x76, 0x1a, 0xec, 0xb2,
+  0x84, 0xce, 0xf1, 0x8c, 0x0a, 0x43, 0x80, 0xd0, 0xd2, 0xc8, 0xdd, 0x73, 0x41, 0xa6, 0x09, 0x0c,
+  0x5b, 0x5a, 0xbc, 0x46, 0xda, 0x56, 0x1e, 0x16, 0x19, 0x20, 0xa8, 0xa5, 0xc4, 0x63, 0xd7, 0x52,
+  0xbc, 0x23, 0x1d, 0xbc, 0x24, 0xdc, 0x2f, 0x71, 0x3a, 0x44, 0x71, 0xb0, 0xcc, 0xf7, 0x3c, 0xf1,
+  0xa8, 0x13, 0xa6, 0x50, 0x33, 0x14, 0x12, 0x58, 0x79, 0x82, 0xcc, 0xb0, 0x81, 0x2c, 0x8e, 0x8b,
+  0x18, 0x1e, 0x9d, 0xb8, 0x6b, 0xd7, 0x9f, 0x06, 0xd7, 0x3d, 0xc6, 0xcd, 0x33, 0x98, 0xce, 0x13,
+  0x65, 0xa9, 0x57, 0xd9, 0x22, 0xaf, 0x31, 0x78, 0x94, 0xa9, 0x6b, 0x57, 0x11, 0x39, 0xc4, 0x07,
+  0x94, 0x87, 0x0c, 0x49, 0x70, 0x85, 0xdb, 0x87, 0x17, 0x67, 0x73, 0x86, 0xff, 0x6d, 0xb8, 0xe2,
+  0x22, 0xfc, 0x43, 0x86, 0x1b, 0x2e, 0xaa, 0xa7, 0x49, 0xf5, 0x35, 0x61, 0x16, 0x88, 0x1e, 0xb3,
+  0x0f, 0x5b, 0x94, 0x5d, 0xbd, 0x69, 0x2b, 0x7b, 0x1f, 0x9b, 0x87, 0x89, 0x23, 0x1f, 0x78, 0xb4,
+  0x87, 0xdb, 0xa7, 0x56, 0xf3, 0xad, 0x9f, 0x24, 0xe8, 0x8a, 0x84, 0x97, 0xad, 0xcb, 0xd0, 0x03,
+  0x74, 0x78, 0x5b, 0xfb, 0x3d, 0x98, 0x94, 0xa4, 0xc0, 0x0f, 0xf8, 0x8d, 0x42, 0x7e, 0x4b, 0x48,
+  0x19, 0xe7, 0x5c, 0x55, 0x06, 0x35, 0xad, 0x9b, 0x21, 0x06, 0xb3, 0xe1, 0xe4, 0xab, 0xd7, 0xaf,
+  0x4f, 0x4f, 0xce, 0x5f, 0xbc, 0xfe, 0xe9, 0x28, 0x99, 0x03, 0x38, 0x43, 0x58, 0xc6, 0x04, 0x0c,
+  0xe1, 0xf6, 0xc6, 0xc0, 0x75, 0xb0, 0xe7, 0x0e, 0xc8, 0xc9, 0xcb, 0xaf, 0xce, 0x4e, 0x9f, 0x8d,
+  0xc4, 0xf4, 0x23, 0x73, 0x7c, 0xd3, 0x6a, 0x8c, 0xcf, 0xbc, 0xcd, 0xfd, 0x58, 0xbd, 0x1f, 0xc4,
+  0xbb, 0x0d, 0xa9, 0x33, 0xbd, 0x15, 0xfe, 0x3e, 0xd0, 0x3f, 0xd2, 0x60, 0xf5, 0x38, 0x28, 0xcd,
+  0x9d, 0x6a, 0x91, 0x06, 0xe5, 0xba, 0x68, 0x5e, 0xe4, 0xf8, 0xed, 0xd0, 0xbe, 0x89, 0x65, 0x45,
+  0x87, 0xdf, 0x86, 0xfb, 0x51, 0x16, 0x5f, 0x63, 0x2e, 0x7c, 0xc7, 0x74, 0xbb, 0xa2, 0xc3, 0x22,
+  0x4d, 0xe4, 0x9b, 0x9b, 0x52, 0x78, 0x40, 0x73, 0x8b, 0xf7, 0xb0, 0xc5, 0x5c, 0x87, 0x3e, 0xe6,
+  0xe9, 0x78, 0xfb, 0xf5, 0x8b, 0x93, 0x60, 0xb1, 0x84, 0x91, 0xf1, 0xd3, 0xfe, 0xdb, 0xb9, 0x73,
+  0xef, 0x6a, 0xfe, 0x39, 0xcd, 0xed, 0x46, 0x6c, 0xd7, 0xea, 0x0e, 0x4c, 0x1e, 0xcf, 0xe4, 0x71,
+  0x71, 0xe9, 0xe6, 0x37, 0x37, 0x37, 0xcd, 0x9d, 0x48, 0xce, 0x89, 0x7a, 0x9e, 0x55, 0xde, 0xcf,
+  0x35, 0x9d, 0xcc, 0x23, 0x4c, 0x85, 0x40, 0xe7, 0x1e, 0x08, 0xff, 0x64, 0xee, 0x39, 0x17, 0xd4,
+  0xef, 0x35, 0x0d, 0x2e, 0x54, 0x02, 0x6b, 0x15, 0xa8, 0xe2, 0x35, 0x46, 0x82, 0x1d, 0xd5, 0x5b,
+  0xfd, 0xdc, 0xaf, 0x28, 0x26, 0xae, 0xa0, 0xda, 0xb5, 0x76, 0xd7, 0x67, 0xb9, 0x2a, 0xd0, 0x4a,
+  0xfd, 0xed, 0x8a, 0xe2, 0xaa, 0xf0, 0xe6, 0xab, 0xb3, 0x73, 0xbe, 0x86, 0x8c, 0x91, 0xba, 0xf6,
+  0x88, 0xfb, 0xbc, 0x79, 0x8e, 0x0b, 0xb6, 0x9e, 0x44, 0x26, 0xb9, 0xc2, 0x87, 0x82, 0x9e, 0x62,
+  0x83, 0xd6, 0x04, 0x5f, 0x09, 0xa4, 0x51, 0xc5, 0x10, 0x92, 0x66, 0xd6, 0x15, 0x70, 0x23, 0xa3,
+  0x79, 0x41, 0xe3, 0x79, 0x30, 0xc5, 0x2b, 0x9a, 0x80, 0x4f, 0x7a, 0xd3, 0x32, 0xb9, 0x27, 0x0b,
+  0x5b, 0x83, 0x77, 0xa4, 0x29, 0x24, 0xa3, 0x7b, 0x7e, 0xbb, 0xa4, 0x4d, 0xa8, 0x8a, 0xb2, 0xed,
+  0x4e, 0xd8, 0xb5, 0xec, 0x2d, 0x0c, 0x03, 0x69, 0x92, 0xf7, 0x59, 0xc3, 0x71, 0x30, 0xbd, 0x1d,
+  0xb1, 0x74, 0x36, 0xbd, 0x28, 0x0e, 0x81, 0x8b, 0x30, 0xc6, 0x29, 0xae, 0x39, 0x65, 0x53, 0x14,
+  0xb6, 0x22, 0x14, 0xb2, 0x50, 0x2d, 0x9c, 0x18, 0x2d, 0xfc, 0xa4, 0xc7, 0x24, 0x43, 0x5c, 0xf2,
+  0x6e, 0xbd, 0x7b, 0x2f, 0xcb, 0xb8, 0x1e, 0xf5, 0xc2, 0x7d, 0xea, 0x1c, 0x1c, 0x1a, 0xe8, 0x5f,
+  0x9e, 0x9f, 0xbf, 0xf9, 0x48, 0x91, 0x2f, 0x7c, 0x73, 0x9b, 0x44, 0x95, 0xb4, 0xf4, 0x21, 0x8a,
+  0xef, 0x30, 0x72, 0x4e, 0x09, 0x61, 0xe9, 0x01, 0xab, 0x16, 0x2d, 0xcd, 0x0d, 0x2f, 0xde, 0xec,
+  0x3b, 0xb2, 0x3a, 0x8f, 0x31, 0xc8, 0x09, 0xfd, 0xc3, 0x46, 0x37, 0x31, 0x63, 0x6d, 0x7c, 0x67,
+  0x99, 0x2f, 0xa6, 0x64, 0x8e, 0x86, 0x17, 0x61, 0x4d, 0x53, 0xc7, 0xb6, 0x80, 0x96, 0xa9, 0xb5,
+  0xec, 0x1a, 0x9d, 0x45, 0x9b, 0x65, 0xb2, 0xfd, 0x0e, 0xd8, 0x33, 0x82, 0xff, 0xef, 0x10, 0xcd,
+  0xc3, 0x3e, 0x4a, 0x99, 0x82, 0xb4, 0x03, 0xb5, 0x92, 0x2c, 0x95, 0x87, 0xf3, 0xc4, 0x77, 0x46,
+  0x1d, 0x65, 0x7b, 0x51, 0x51, 0x4a, 0x2c, 0xc3, 0xf8, 0xb0, 0x9e, 0x66, 0x4a, 0xa0, 0x6f, 0x49,
+  0x90, 0xb5, 0x03, 0xa0, 0xb4, 0x9b, 0xe4, 0x10, 0x68, 0x6d, 0x85, 0x25, 0xf3, 0xb8, 0x40, 0x4f,
+  0xe9, 0x4a, 0x25, 0xb9, 0x02, 0x95, 0xea, 0x3a, 0xcd, 0xd0, 0x62, 0x26, 0x09, 0xd8, 0x73, 0xad,
+  0x7c, 0xe4, 0x4c, 0x4f, 0x44, 0x58, 0x1e, 0x93, 0xac, 0x52, 0x2e, 0x98, 0x45, 0x54, 0xb2, 0x70,
+  0x48, 0x7b, 0x37, 0x00, 0xf6, 0x83, 0xe1, 0x2c, 0xe1, 0x4d, 0xf8, 0xe1, 0xef, 0x3e, 0xfc, 0x01,
+  0x93, 0x55, 0x79, 0x11, 0xd1, 0x52, 0xc9, 0xe3, 0xf6, 0xbf, 0x96, 0x80, 0x2a, 0x94, 0xa8, 0x71,
+  0x2e, 0x06, 0x2a, 0xd4, 0x30, 0x94, 0x62, 0x0a, 0xe4, 0x9c, 0xe6, 0x36, 0xec, 0xe5, 0x9c, 0xd7,
+  0x75, 0x31, 0xaf, 0x6e, 0x38, 0x64, 0x37, 0xd9, 0x72, 0x93, 0x4c, 0xc4, 0x2c, 0x3b, 0xa1, 0xb3,
+  0x48, 0x0c, 0xdc, 0xb7, 0x5f, 0xbf, 0x3c, 0x03, 0x4b, 0x7d, 0x32, 0x7f, 0xc3, 0xbe, 0xb6, 0x94,
+  0x5b, 0xd5, 0xdc, 0xf5, 0x36, 0x32, 0x46, 0x70, 0x81, 0xc6, 0x41, 0xe8, 0x4c, 0xe7, 0x30, 0x39,
+  0x93, 0x96, 0x0e, 0x82, 0xf1, 0x55, 0x23, 0x62, 0x13, 0x15, 0xa5, 0xa2, 0x73, 0x33, 0x22, 0x36,
+  0x71, 0xe9, 0x28, 0x26, 0x9a, 0x18, 0xad, 0x11, 0x31, 0x0d, 0x9c, 0xa1, 0x2a, 0x42, 0x36, 0x0d,
+  0x61, 0x66, 0xc6, 0x59, 0xad, 0x29, 0x76, 0xbe, 0x0b, 0x36, 0x8e, 0x32, 0x23, 0xbe, 0x60, 0x46,
+  0x0b, 0x63, 0x53, 0x0f, 0xcf, 0x8d, 0x42, 0x66, 0x46, 0x9a, 0x8d, 0x9e, 0xe2, 0x54, 0xd7, 0x9b,
+  0x51, 0x2b, 0x7a, 0x1f, 0x1f, 0x4d, 0xa5, 0x68, 0x42, 0x55, 0x4f, 0xab, 0xe0, 0xad, 0x33, 0x4d,
+  0x97, 0x98, 0x23, 0xa1, 0x30, 0x26, 0xc5, 0x50, 0xe2, 0x4e, 0xdd, 0xf8, 0x96, 0xff, 0xa8, 0xb1,
+  0x90, 0x19, 0xb2, 0x12, 0xd7, 0xd5, 0x13, 0x9f, 0xe5, 0x02, 0xa9, 0xea, 0xa0, 0xe2, 0xa7, 0xb8,
+  0x88, 0x7c, 0xc0, 0xf7, 0x42, 0xc3, 0x14, 0x75, 0x53, 0x0f, 0x1b, 0x5b, 0x36, 0x4c, 0x39, 0x43,
+  0x25, 0x28, 0x85, 0x7a, 0x58, 0x56, 0x57, 0x4a, 0xd9, 0x2d, 0xc5, 0x8d, 0x29, 0xa5, 0xa2, 0x00,
+  0xbe, 0x62, 0xe5, 0x14, 0x31, 0x09, 0x1b, 0x99, 0x23, 0xf2, 0xe4, 0x8a, 0xcb, 0x00, 0xf7, 0x2a,
+  0x86, 0x80, 0x3a, 0xb9, 0x12, 0x66, 0x4a, 0x1e, 0xa9, 0x17, 0x67, 0x0d, 0x90, 0xc4, 0x3d, 0xd7,
+  0x51, 0xfe, 0x8a, 0x6c, 0xbe, 0x72, 0x8c, 0x01, 0x6d, 0x23, 0x63, 0xdc, 0x9b, 0x5c, 0x6d, 0x9a,
+  0x46, 0xa0, 0x8d, 0xca, 0xe2, 0xd6, 0x4a, 0x95, 0x75, 0x22, 0x5d, 0xa3, 0x82, 0x20, 0x2f, 0xa5,
+  0xef, 0x24, 0x08, 0x6d, 0x54, 0x12, 0xb8, 0x96, 0xef, 0xb9, 0xba, 0xfa, 0x45, 0xa1, 0xa9, 0xa3,
+  0x74, 0x0d, 0x99, 0x4e, 0x65, 0x4d, 0x4b, 0x7e, 0xc1, 0x9d, 0x0e, 0x50, 0x42, 0xae, 0x31, 0xeb,
+  0xa6, 0x4f, 0x57, 0x98, 0x7d, 0x12, 0x04, 0x1e, 0x16, 0xb8, 0x5e, 0x8f, 0xc9, 0x3c, 0xbf, 0x31,
+  0x50, 0x4b, 0x0f, 0xb3, 0x6e, 0x3f, 0xa6, 0xf2, 0x95, 0x27, 0x4f, 0x3d, 0xe5, 0x2b, 0x99, 0x73,
+  0xa6, 0x9b, 0x5c, 0xe3, 0xfc, 0xa2, 0xbb, 0xae, 0x8e, 0xcb, 0x8c, 0xb2, 0xe8, 0x9a, 0x4a, 0xea,
+  0x8e, 0xb4, 0xfa, 0x5d, 0x76, 0x23, 0x6a, 0xfd, 0x7d, 0x84, 0x51, 0x36, 0xa4, 0x65, 0x79, 0x7c,
+  0x64, 0xf1, 0x7a, 0x08, 0x83, 0xcd, 0x28, 0x2b, 0x92, 0x11, 0xb9, 0x99, 0xd5, 0x58, 0x02, 0xb8,
+  0x8e, 0x2c, 0xc8, 0x03, 0x29, 0xd9, 0xf0, 0x05, 0xb9, 0x7b, 0xd4, 0x2d, 0x66, 0x12, 0xe7, 0xa3,
+  0xdf, 0x63, 0x33, 0x00, 0x60, 0xf7, 0xef, 0xd0, 0x11, 0x78, 0xc5, 0xf6, 0x44, 0xc7, 0xda, 0xde,
+  0x34, 0x09, 0x4b, 0x62, 0xc5, 0xbd, 0xd8, 0x09, 0x2f, 0xa8, 0x50, 0x00, 0xf9, 0xeb, 0x6c, 0x2f,
+  0x6c, 0x97, 0x0d, 0x89, 0xfd, 0xea, 0xde, 0x81, 0xec, 0x21, 0x4e, 0xbc, 0x6e, 0xf9, 0xcb, 0x9c,
+  0xed, 0x7c, 0x6f, 0x49, 0x11, 0x77, 0x59, 0xab, 0xf9, 0xdd, 0x8c, 0xd2, 0xde, 0x21, 0x3b, 0x59,
+  0x5a, 0xb7, 0x3c, 0x87, 0x38, 0xf6, 0x6b, 0x33, 0xe8, 0x95, 0x13, 0xcf, 0x31, 0x3a, 0xbf, 0xd5,
+  0xef, 0x88, 0xdf, 0xae, 0xdf, 0x42, 0x59, 0xef, 0x64, 0x5b, 0x88, 0x3c, 0x13, 0xdb, 0xe8, 0x7a,
+  0xe8, 0xb7, 0x0d, 0xe4, 0x9d, 0x15, 0xdc, 0xea, 0xfc, 0x47, 0xc0, 0x4d, 0xab, 0xbc, 0xcd, 0x82,
+  0x09, 0xf7, 0x83, 0x33, 0xd0, 0x6a, 0xd8, 0x31, 0xbb, 0x67, 0x28, 0x27, 0xbe, 0x11, 0xf0, 0x2b,
+  0x80, 0x1d, 0x7b, 0xab, 0xd0, 0x02, 0x15, 0x56, 0x46, 0xaa, 0xdd, 0xf0, 0xcc, 0x03, 0xb6, 0x8d,
+  0xfe, 0xfd, 0xd0, 0xb5, 0x41, 0xad, 0x8f, 0x2d, 0x57, 0x05, 0x06, 0xff, 0x63, 0xe5, 0x7c, 0x5e,
+  0xda, 0x28, 0x1a, 0xa7, 0xad, 0x3e, 0x9e, 0x86, 0xdb, 0x32, 0x75, 0x66, 0x88, 0x6d, 0xcb, 0x57,
+  0xa0, 0x4f, 0x12, 0x33, 0xc0, 0xd0, 0xf4, 0x07, 0x9e, 0x9a, 0x26, 0x5e, 0x18, 0x67, 0x67, 0x01,
+  0xd5, 0x65, 0x84, 0xae, 0x3f, 0x6b, 0xb4, 0x34, 0x46, 0xb5, 0x80, 0x57, 0x90, 0xc6, 0x0a, 0xe0,
+  0xd7, 0x9e, 0x41, 0xf7, 0x80, 0xbd, 0x16, 0xe6, 0x0f, 0x84, 0xa7, 0xe1, 0x5e, 0x92, 0x6d, 0xf1,
+  0x51, 0x54, 0x91, 0xec, 0x7c, 0xd3, 0x1f, 0x5a, 0xb2, 0x0d, 0xbc, 0x30, 0x4b, 0xb6, 0x9d, 0xea,
+  0x32, 0x42, 0xef, 0x21, 0xd9, 0x6a, 0x5a, 0xad, 0x5a, 0xc0, 0xab, 0xc8, 0x47, 0x39, 0xf8, 0xf5,
+  0x25, 0x7b, 0x7d, 0xd8, 0x6b, 0x61, 0xfe, 0x40, 0x71, 0x8d, 0xd5, 0x97, 0x6a, 0x93, 0x2b, 0xad,
+  0x82, 0x44, 0x6b, 0xcd, 0x7e, 0x60, 0x69, 0xd6, 0xe9, 0x37, 0x4a, 0xb2, 0x85, 0xd2, 0x22, 0xe2,
+  0xd6, 0x97, 0x60, 0x29, 0xa5, 0x5b, 0x65, 0xa0, 0x15, 0xc6, 0xbf, 0x00, 0xec, 0xda, 0x12, 0xbb,
+  0x06, 0xcc, 0xda, 0x98, 0x3e, 0x50, 0xbc, 0xb2, 0x6b, 0x4b, 0xa9, 0xe2, 0xc5, 0xad, 0x2e, 0xa5,
+  0x49, 0xb3, 0x3f, 0x0d, 0x29, 0x4d, 0xe9, 0x2f, 0x92, 0x52, 0x9d, 0xd2, 0x22, 0xe2, 0xee, 0x2d,
+  0xa5, 0x98, 0x36, 0xb0, 0x32, 0xd0, 0xea, 0x63, 0x6f, 0x02, 0x7b, 0x5f, 0x29, 0xad, 0x03, 0xb3,
+  0x36, 0xa6, 0x0f, 0xf4, 0xcb, 0xea, 0x6b, 0xe0, 0xa9, 0xe4, 0xa8, 0x14, 0x98, 0x16, 0x83, 0xac,
+  0x80, 0x66, 0x7d, 0xa0, 0xfc, 0xb4, 0xdd, 0xb8, 0x21, 0xd0, 0x4f, 0xf9, 0x34, 0xfb, 0x5f, 0x75,
+  0xf6, 0xd7, 0xda, 0x6a, 0x54, 0x80, 0xac, 0x24, 0x0a, 0x2b, 0x00, 0xce, 0x5d, 0x59, 0x6a, 0x17,
+  0xe2, 0xe4, 0x1c, 0xef, 0x10, 0x28, 0x11, 0xf4, 0x52, 0xda, 0xb3, 0x9e, 0x29, 0x45, 0x0f, 0x5e,
+  0x87, 0xd4, 0x5b, 0xa4, 0xd9, 0xce, 0xb4, 0x16, 0xe8, 0x15, 0x73, 0xa3, 0xd7, 0xce, 0xeb, 0x16,
+  0xf6, 0xc3, 0x66, 0x30, 0xeb, 0xf0, 0x90, 0x74, 0x77, 0xfa, 0xe9, 0x5f, 0xc7, 0x64, 0xbf, 0x6f,
+  0xf1, 0x02, 0x21, 0x2a, 0x34, 0x74, 0xe2, 0x55, 0x48, 0x16, 0xf8, 0xf8, 0x4d, 0xea, 0x67, 0xc7,
+  0xf6, 0xe8, 0x69, 0xdf, 0xef, 0xe3, 0x0d, 0xc7, 0x8b, 0xfa, 0xe7, 0x00, 0x1c, 0x2d, 0x24, 0x86,
+  0xa1, 0xc5, 0xa8, 0x3a, 0x24, 0xfd, 0xf4, 0xf7, 0x31, 0x26, 0x1c, 0xb2, 0x60, 0xf5, 0x72, 0x35,
+  0x8b, 0x67, 0x74, 0x35, 0x99, 0xc7, 0xc2, 0x43, 0xa5, 0xe2, 0x96, 0x3c, 0xfe, 0xba, 0x0e, 0x6a,
+  0x15, 0x7c, 0xff, 0xca, 0xa0, 0x5b, 0xdc, 0xff, 0xa1, 0x31, 0x58, 0x05, 0xc0, 0x65, 0x8d, 0xbf,
+  0x40, 0xde, 0x33, 0x57, 0x1f, 0xfe, 0x90, 0xee, 0x49, 0x60, 0x6a, 0xa4, 0x87, 0xc8, 0x03, 0x56,
+  0x88, 0x3f, 0xa4, 0x42, 0x2d, 0xb6, 0xf5, 0xb3, 0x90, 0x85, 0x98, 0xe4, 0xf2, 0xa1, 0x64, 0xa1,
+  0x20, 0xbd, 0xdc, 0x7d, 0x82, 0xa2, 0x2b, 0x24, 0x1a, 0x2a, 0x07, 0x95, 0xee, 0x68, 0x68, 0x28,
+  0x1e, 0xd8, 0xcf, 0x93, 0xd1, 0xe9, 0xc3, 0x9c, 0xd8, 0xf8, 0x42, 0xd6, 0x7d, 0xbc, 0x93, 0x32,
+  0x38, 0xee, 0x9e, 0xf4, 0x33, 0xff, 0x24, 0x03, 0xbe, 0x09, 0x47, 0xb5, 0x36, 0xd2, 0x46, 0x5f,
+  0xb5, 0xa2, 0x0e, 0x94, 0x94, 0x72, 0x6b, 0xe9, 0x83, 0xf4, 0x16, 0xf9, 0x91, 0x74, 0x6e, 0xaf,
+  0xde, 0x09, 0x37, 0x6a, 0x85, 0xe4, 0xee, 0xb7, 0xd2, 0x4c, 0xbe, 0xca, 0x6d, 0xd5, 0x25, 0xb9,
+  0x56, 0xf2, 0x15, 0x6c, 0xab, 0x3e, 0x49, 0x6f, 0xa4, 0xe3, 0x84, 0x4d, 0x91, 0x3e, 0x24, 0x03,
+  0xe5, 0xef, 0x63, 0xb2, 0xbd, 0xd7, 0xc7, 0x39, 0x2d, 0x87, 0x5e, 0xa7, 0xfa, 0x88, 0x35, 0x4f,
+  0xb4, 0x10, 0x56, 0x4f, 0xda, 0xa7, 0x7f, 0xdb, 0xdb, 0x27, 0x97, 0xc2, 0x49, 0xa2, 0x30, 0xe4,
+  0xf6, 0xe9, 0xdf, 0xbc, 0xbd, 0xed, 0xbc, 0x19, 0xc3, 0x96, 0x9f, 0x39, 0x2b, 0x7c, 0xcd, 0x6b,
+  0xf1, 0xe1, 0xbb, 0x08, 0xe4, 0x46, 0x7f, 0xe5, 0x94, 0xf5, 0x9e, 0x3e, 0xf6, 0xf2, 0x71, 0xb4,
+  0x89, 0x22, 0x33, 0xb5, 0xd5, 0x49, 0xd6, 0xfa, 0x8b, 0x84, 0xeb, 0x4c, 0x6d, 0xa4, 0x43, 0x80,
+  0xca, 0x44, 0xf0, 0x33, 0x55, 0x36, 0xc9, 0x77, 0xc1, 0xa7, 0x54, 0xcf, 0xa8, 0xb7, 0xec, 0xd7,
+  0xd6, 0x2f, 0x19, 0x8b, 0x9f, 0x07, 0xc0, 0x33, 0x7f, 0xca, 0x79, 0xbc, 0x99, 0x73, 0x09, 0x05,
+  0x64, 0x6e, 0xea, 0x6f, 0xf2, 0x98, 0x4a, 0x1f, 0x99, 0xc2, 0xe9, 0xff, 0x2b, 0x53, 0x2a, 0x87,
+  0x5c, 0x6e, 0x05, 0x25, 0xdd, 0xc1, 0xb7, 0xe9, 0x2b, 0x07, 0x91, 0xc8, 0x86, 0xa9, 0x2b, 0x03,
+  0xb7, 0x24, 0xc7, 0xa5, 0xc8, 0x9b, 0xe8, 0x4e, 0x71, 0x34, 0x95, 0x34, 0x97, 0x69, 0x4e, 0x45,
+  0xfb, 0x26, 0x41, 0x68, 0x1f, 0x2d, 0xc1, 0xa2, 0x9c, 0x8a, 0xf1, 0x40, 0x0e, 0x6b, 0x2c, 0xd9,
+  0x72, 0x98, 0x5f, 0x5e, 0xb8, 0x92, 0x35, 0x8b, 0x6b, 0x50, 0x28, 0x5c, 0xca, 0xae, 0xc8, 0xf1,
+  0x11, 0xcc, 0xb8, 0x87, 0x0f, 0xa1, 0xc1, 0xe1, 0x91, 0x98, 0xb3, 0x7a, 0x52, 0xc8, 0x03, 0xdb,
+  0xfb, 0x06, 0xa6, 0x83, 0xf3, 0x75, 0x5c, 0x1d, 0x72, 0x16, 0xeb, 0xc4, 0xd1, 0x51, 0x09, 0x74,
+  0x15, 0x4f, 0x87, 0x05, 0xb8, 0x7c, 0x5c, 0xbf, 0x26, 0xce, 0x49, 0xd6, 0xec, 0xca, 0x50, 0x2b,
+  0xa2, 0x6b, 0x80, 0x9b, 0x45, 0x0d, 0xac, 0x89, 0x2b, 0x4f, 0xd0, 0x5d, 0x11, 0x62, 0x45, 0x3c,
+  0x73, 0x30, 0xa5, 0x18, 0x83, 0x35, 0xd1, 0x14, 0x19, 0xb8, 0xab, 0xc2, 0xac, 0x88, 0x68, 0x1e,
+  0x6a, 0x2e, 0x2e, 0x61, 0x4d, 0x7c, 0xd5, 0x1c, 0x37, 0xb5, 0xe0, 0x57, 0xc4, 0x5d, 0xef, 0x21,
+  0x35, 0x79, 0xb2, 0xb3, 0xfc, 0x5a, 0x7b, 0x2b, 0x1e, 0x45, 0x65, 0x7c, 0xa8, 0x44, 0x7e, 0x65,
+  0xb0, 0xf0, 0x45, 0x07, 0xa9, 0x5e, 0x3e, 0x09, 0xb6, 0x78, 0x4e, 0xaf, 0x2c, 0x03, 0x76, 0xfa,
+  0xea, 0x5e, 0x72, 0xfc, 0x27, 0x01, 0xad, 0x69, 0xbf, 0x99, 0xb2, 0x00, 0x96, 0x84, 0xae, 0x63,
+  0x5f, 0xcd, 0xdc, 0x8a, 0x6b, 0x8e, 0x1d, 0x37, 0x24, 0x3d, 0x14, 0xaf, 0xfc, 0x29, 0xc7, 0xf3,
+  0xe2, 0xb9, 0xbc, 0x64, 0x01, 0x6c, 0x1a, 0x73, 0xf6, 0x08, 0x46, 0x7b, 0xc1, 0x38, 0x1f, 0x86,
+  0x8e, 0x5f, 0x5b, 0x39, 0x03, 0x64, 0x15, 0xe2, 0x3d, 0x3c, 0x71, 0x39, 0xe9, 0xed, 0xd7, 0x2f,
+  0xc5, 0x2b, 0x6d, 0x3c, 0x0b, 0x0b, 0xfc, 0xdd, 0xc2, 0x66, 0xb9, 0x56, 0x4e, 0xc1, 0xbb, 0x6e,
+  0x8e, 0xf2, 0x6a, 0x57, 0x6f, 0x1e, 0xd2, 0x19, 0xd4, 0x86, 0x7e, 0xe4, 0xaf, 0xf8, 0xa6, 0x0e,
+  0x26, 0x5d, 0x64, 0x0f, 0xd0, 0x5d, 0x52, 0xa7, 0xcb, 0xcc, 0x9a, 0x2e, 0xe7, 0x5c, 0x17, 0xed,
+  0x0f, 0x64, 0x07, 0xbe, 0xc3, 0xd8, 0xc2, 0x9b, 0xe6, 0x2f, 0xce, 0xbe, 0x4a, 0x22, 0x6a, 0x44,
+  0x82, 0xe2, 0x7e, 0x07, 0xf6, 0x81, 0x6c, 0x47, 0xc5, 0x82, 0xdc, 0xe5, 0xfc, 0x03, 0x09, 0x5e,
+  0x18, 0xde, 0xaf, 0xbc, 0xeb, 0xe6, 0x28, 0x88, 0xe5, 0xde, 0xd9, 0x91, 0x98, 0x10, 0xd2, 0xab,
+  0xe0, 0x52, 0x62, 0x02, 0xe6, 0xbf, 0xb4, 0xf5, 0xc0, 0x33, 0xc5, 0xe6, 0x7b, 0x90, 0x23, 0x51,
+  0xf8, 0x78, 0xd2, 0x70, 0x16, 0x78, 0x17, 0x21, 0x5a, 0x32, 0xe9, 0x4b, 0x99, 0x22, 0xa5, 0xce,
+  0xfa, 0x66, 0x93, 0x80, 0xad, 0x5e, 0x23, 0x19, 0xd5, 0x48, 0xcd, 0x93, 0xcc, 0x10, 0x69, 0xd6,
+  0x14, 0x39, 0x6a, 0xc4, 0x0c, 0x61, 0x6e, 0x44, 0xc3, 0x36, 0x67, 0xc6, 0xe7, 0xa6, 0xe2, 0x65,
+  0xc4, 0x6f, 0xd1, 0xaf, 0xfa, 0xdf, 0x2a, 0xe1, 0xfe, 0xf8, 0xb1, 0x9d, 0x5a, 0xd7, 0x72, 0xc9,
+  0x04, 0x2d, 0xb3, 0x70, 0xd1, 0x6a, 0xbe, 0xfa, 0xf0, 0x77, 0x20, 0xf9, 0xe2, 0xfd, 0xd4, 0x6b,
+  0x37, 0xbc, 0xf4, 0x90, 0x73, 0x53, 0xd7, 0xfc, 0x74, 0x6a, 0xf6, 0xa0, 0xe4, 0x17, 0xe4, 0x49,
+  0xc1, 0x1b, 0x92, 0xc9, 0xb3, 0x8f, 0xe9, 0xab, 0x93, 0x2e, 0x86, 0xff, 0x7c, 0xa6, 0xe6, 0x10,
+  0xcb, 0x7b, 0x49, 0x51, 0x52, 0x9b, 0x35, 0x23, 0x0c, 0x93, 0x1d, 0xdc, 0x4d, 0x9c, 0xe9, 0x09,
+  0x64, 0x2f, 0x7e, 0xc9, 0x4f, 0xc5, 0x42, 0x9d, 0x22, 0x46, 0x47, 0xb9, 0x10, 0x63, 0xbf, 0x12,
+  0x23, 0x5f, 0x8a, 0x51, 0xae, 0xa1, 0x96, 0x5f, 0x90, 0x91, 0x81, 0xbc, 0x97, 0xff, 0xe0, 0xb7,
+  0x65, 0x10, 0x75, 0x25, 0x30, 0xae, 0xa2, 0x8e, 0xab, 0x70, 0x43, 0xe6, 0xa0, 0x40, 0x25, 0xea,
+  0x37, 0x62, 0xc4, 0x83, 0xc3, 0x9a, 0xd8, 0x37, 0xcd, 0x19, 0x17, 0x53, 0xf6, 0xae, 0xbc, 0xb8,
+  0xbc, 0x73, 0x69, 0x6e, 0x59, 0xc4, 0x0c, 0x3a, 0x64, 0xaa, 0xb8, 0x07, 0x3b, 0x48, 0x37, 0xa6,
+  0x59, 0x8c, 0x9e, 0x98, 0xcc, 0x22, 0x42, 0x2f, 0x37, 0x9f, 0x0b, 0x9f, 0x92, 0x4c, 0xf5, 0x0f,
+  0x28, 0x42, 0xd6, 0x1f, 0x28, 0x16, 0xd4, 0x90, 0xca, 0x4b, 0x60, 0xfa, 0x3d, 0xd7, 0x2a, 0x0a,
+  0xc2, 0xcc, 0xaa, 0x4a, 0x1a, 0xa2, 0x74, 0x1e, 0xbc, 0x37, 0xad, 0xf3, 0x21, 0x4f, 0x1f, 0x90,
+  0x25, 0x47, 0x28, 0x5f, 0xf2, 0x73, 0x4d, 0x12, 0x1c, 0x72, 0x29, 0xd1, 0xb4, 0x7a, 0xfa, 0x2d,
+  0x5b, 0xb3, 0xee, 0xc0, 0xe9, 0x2e, 0x5a, 0x75, 0x45, 0xc6, 0x85, 0x4c, 0x9f, 0xdc, 0xad, 0xc2,
+  0x0f, 0xdf, 0x4d, 0x2e, 0x01, 0xf0, 0x1d, 0xa8, 0x0e, 0x55, 0x0d, 0xdc, 0xe7, 0x8a, 0x83, 0x85,
+  0x0d, 0x36, 0x47, 0x40, 0xc9, 0xe4, 0xd7, 0xd8, 0x63, 0x51, 0x03, 0x3f, 0x3d, 0x55, 0xb5, 0x40,
+  0x2e, 0x0d, 0xb3, 0x31, 0xa6, 0xf5, 0x87, 0x99, 0xc2, 0xcf, 0x59, 0x46, 0x67, 0x32, 0xa6, 0xee,
+  0x82, 0xfc, 0x85, 0x3c, 0x06, 0x66, 0xd3, 0x66, 0xcd, 0xd9, 0x5c, 0x98, 0xdc, 0x83, 0x03, 0x51,
+  0xd3, 0x84, 0xe0, 0x59, 0xd8, 0x81, 0x6d, 0x1e, 0xc9, 0x02, 0x24, 0xe4, 0x06, 0xdd, 0x92, 0xf1,
+  0x5d, 0x7c, 0x0f, 0xbf, 0x87, 0x94, 0xd9, 0xba, 0x6c, 0xc5, 0xae, 0xe2, 0xe1, 0xb0, 0xca, 0x9d,
+  0x39, 0x22, 0x37, 0xe5, 0xad, 0xa5, 0x5d, 0x65, 0xeb, 0xdf, 0x30, 0x37, 0xb5, 0x6d, 0x80, 0x9a,
+  0x65, 0xfb, 0x40, 0xf4, 0xaa, 0x24, 0x39, 0x14, 0x47, 0x66, 0x86, 0xdb, 0xf4, 0x07, 0xec, 0x1d,
+  0xe5, 0xe4, 0x71, 0xe3, 0xc3, 0x2d, 0x5c, 0x8e, 0xf0, 0xdf, 0x79, 0xbc, 0xf0, 0x8e, 0x1f, 0xfc,
+  0x03, 0xd5, 0x2a, 0x9f, 0x9e, 0x28, 0x10, 0x01, 0x00,
+};
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Erzeugt WebInterfaceGz.h aus WebInterface.h (gzip, in PROGMEM).
+
+Nach jeder Änderung an WebInterface.h ausführen:
+
+    python3 tools/gen_web_gz.py
+
+Die Ausgabe ist deterministisch (gzip mtime=0), der Hash im ETag ändert sich
+also nur, wenn sich das HTML ändert.
+"""
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "WebInterface.h")
+DST = os.path.join(ROOT, "WebInterfaceGz.h")
+
+
+def extract_html(text):
+    m = re.search(r'R"rawl\((.*)\)rawl"', text, re.S)
+    if not m:
+        sys.exit("WebInterface.h: raw string literal R\"rawl(...)rawl\" not found")
+    return m.group(1).encode("utf-8")
+
+
+def main():
+    with open(SRC, encoding="utf-8") as f:
+        html = extract_html(f.read())
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    digest = hashlib.sha1(html).hexdigest()[:12]
+
+    lines = [
+        "// WebInterfaceGz.h — GENERIERT von tools/gen_web_gz.py, nicht von Hand ändern.",
+        "// Quelle: WebInterface.h (%d Bytes) -> gzip (%d Bytes)" % (len(html), len(gz)),
+        "//",
+        "// NOTE: Include this file from exactly one translation unit (IkeaObegraensad.ino only).",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// SHA-1 (gekürzt) des unkomprimierten HTML, Teil des ETags",
+        '#define WEB_INTERFACE_HASH "%s"' % digest,
+        "",
+        "// Länge des unkomprimierten HTML — der Sketch prüft damit per static_assert,",
+        "// ob diese Datei nach einer Änderung an WebInterface.h neu erzeugt wurde",
+        "const size_t WEB_INTERFACE_HTML_LEN = %d;" % len(html),
+        "",
+        "const size_t WEB_INTERFACE_HTML_GZ_LEN = %d;" % len(gz),
+        "const uint8_t WEB_INTERFACE_HTML_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(gz), 16):
+        chunk = gz[i:i + 16]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+
+    with open(DST, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+    print("%s: %d -> %d bytes, hash %s" % (os.path.basename(DST), len(html), len(gz), digest))
+
+
+if __name__ == "__main__":
+    main()
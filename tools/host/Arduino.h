@@ -0,0 +1,91 @@
+// Arduino.h — Minimaler Host-Stub für Tests der Header-Module auf dem PC
+//
+// Nur was MqttDispatch.h, Batch.h und die von ihnen eingebundenen Header
+// brauchen; Pins und PWM sind No-ops. Print::printf() verhält sich wie im ESP8266-Core: 64-Byte-Puffer
+// auf dem Stack, längere Ausgaben landen per new[] auf dem Heap — genau das
+// sollen die Allokations-Tests sehen.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <strings.h>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+template <typename T>
+T constrain(T v, T lo, T hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+enum : uint8_t { D0 = 16, D1 = 5, D2 = 4, D3 = 0, D4 = 2, D5 = 14, D6 = 12, D7 = 13, D8 = 15, A0 = 17 };
+const uint8_t LOW = 0, HIGH = 1, OUTPUT = 1;
+
+inline unsigned long millis() { return 0; }
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void analogWrite(uint8_t, int) {}
+inline void analogWriteRange(uint32_t) {}
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buf++);
+    return n;
+  }
+  size_t write(const char* s, size_t size) { return write((const uint8_t*)s, size); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t println() { return print("\r\n"); }
+  size_t println(const char* s) { return print(s) + println(); }
+
+  size_t printf(const char* format, ...) {
+    va_list arg;
+    va_start(arg, format);
+    char temp[64];
+    char* buffer = temp;
+    size_t len = vsnprintf(temp, sizeof(temp), format, arg);
+    va_end(arg);
+    if (len > sizeof(temp) - 1) {
+      buffer = new (std::nothrow) char[len + 1];
+      if (!buffer) return 0;
+      va_start(arg, format);
+      vsnprintf(buffer, len + 1, format, arg);
+      va_end(arg);
+    }
+    len = write((const uint8_t*)buffer, len);
+    if (buffer != temp) delete[] buffer;
+    return len;
+  }
+};
+
+// Ausgabe verwerfen, nur zählen (stdout würde selbst Puffer allozieren)
+class HostSerial : public Print {
+ public:
+  using Print::write;
+  size_t bytes = 0;
+  size_t write(uint8_t) override { bytes++; return 1; }
+  size_t write(const uint8_t*, size_t size) override { bytes += size; return size; }
+};
+
+inline HostSerial Serial;
+
+#endif  // HOST_ARDUINO_H
@@ -0,0 +1,23 @@
+// EEPROM.h — Host-Stub: RAM-Shadow ohne Flash
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include <Arduino.h>
+
+class EEPROMClass {
+ public:
+  void begin(size_t) {}
+  uint8_t read(int addr) const { return _data[addr]; }
+  void write(int addr, uint8_t v) { _data[addr] = v; }
+  bool commit() { return true; }
+  size_t length() const { return sizeof(_data); }
+  uint8_t* getDataPtr() { return _data; }
+  const uint8_t* getConstDataPtr() const { return _data; }
+
+ private:
+  uint8_t _data[1024] = {};
+};
+
+inline EEPROMClass EEPROM;
+
+#endif  // HOST_EEPROM_H
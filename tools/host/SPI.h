@@ -0,0 +1,15 @@
+// SPI.h — Host-Stub: kein Bus, Bytes werden verworfen
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+class SPIClass {
+ public:
+  void begin() {}
+  void writeBytes(const uint8_t*, uint32_t) {}
+};
+
+inline SPIClass SPI;
+
+#endif  // HOST_SPI_H
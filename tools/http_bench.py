@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Misst Latenz und freien Heap für /api/status mit und ohne Keep-Alive.
+
+    python3 tools/http_bench.py 192.168.1.50 [-n 100] [--path /api/status]
+
+Ohne Keep-Alive wird jede Anfrage mit "Connection: close" auf einer neuen
+Verbindung gestellt, mit Keep-Alive läuft alles über eine Verbindung. Der
+Heap wird vor und nach jeder Runde aus /metrics gelesen.
+
+Lesende Endpoints sind pro Client-IP auf 20 Requests am Stück und danach
+2/s begrenzt (RateLimiter.h). Die Anfragen werden daher im Abstand von
+--interval gestellt (Default knapp über 500 ms), sonst würde fast nur der
+429-Pfad gemessen. Antworten mit anderem Status als 200 werden gezählt,
+nicht mitgemessen und am Ende gemeldet.
+"""
+import argparse
+import http.client
+import re
+import statistics
+import sys
+import time
+
+
+class Pacer:
+    """Hält zwischen zwei Requests (auch /metrics) mindestens interval Sekunden Abstand."""
+
+    def __init__(self, interval):
+        self.interval = interval
+        self.last = None
+
+    def wait(self):
+        if self.last is not None:
+            delay = self.last + self.interval - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+        self.last = time.monotonic()
+
+
+def free_heap(host, port, pacer):
+    pacer.wait()
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    conn.request("GET", "/metrics", headers={"Connection": "close"})
+    resp = conn.getresponse()
+    text = resp.read().decode()
+    conn.close()
+    if resp.status != 200:
+        sys.exit("/metrics answered %d %s (rate limited? raise --interval)" % (resp.status, resp.reason))
+    heap = re.search(r"^obegraensad_heap_free_bytes (\d+)", text, re.M)
+    block = re.search(r"^obegraensad_heap_max_free_block_bytes (\d+)", text, re.M)
+    if not heap or not block:
+        sys.exit("/metrics has no heap gauges")
+    return int(heap.group(1)), int(block.group(1))
+
+
+def run(host, port, path, count, keep_alive, pacer):
+    times = []
+    errors = {}
+    conn = None
+    for _ in range(count):
+        pacer.wait()
+        if conn is None:
+            conn = http.client.HTTPConnection(host, port, timeout=10)
+        start = time.perf_counter()
+        conn.request("GET", path, headers={} if keep_alive else {"Connection": "close"})
+        resp = conn.getresponse()
+        resp.read()
+        elapsed = (time.perf_counter() - start) * 1000
+        if resp.status == 200:
+            times.append(elapsed)
+        else:
+            errors[resp.status] = errors.get(resp.status, 0) + 1
+        if not keep_alive or resp.getheader("Connection", "").lower() == "close":
+            conn.close()
+            conn = None
+    if conn:
+        conn.close()
+    return times, errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--path", default="/api/status")
+    parser.add_argument("-n", "--count", type=int, default=100)
+    parser.add_argument("--interval", type=float, default=0.55,
+                        help="Sekunden zwischen zwei Requests (READ-Budget: 2/s)")
+    args = parser.parse_args()
+
+    pacer = Pacer(args.interval)
+    failed = False
+    for keep_alive in (False, True):
+        heap_before, block_before = free_heap(args.host, args.port, pacer)
+        times, errors = run(args.host, args.port, args.path, args.count, keep_alive, pacer)
+        heap_after, block_after = free_heap(args.host, args.port, pacer)
+        if errors:
+            failed = True
+            print("%-11s non-200 replies: %s" % (
+                "keep-alive" if keep_alive else "close",
+                ", ".join("%d x%d" % (status, n) for status, n in sorted(errors.items()))))
+        if not times:
+            continue
+        times.sort()
+        print("%-11s median %6.1f ms  p95 %6.1f ms  heap %6d -> %6d  max block %6d -> %6d" % (
+            "keep-alive" if keep_alive else "close",
+            statistics.median(times), times[int(len(times) * 0.95) - 1],
+            heap_before, heap_after, block_before, block_after))
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,178 @@
+// mqtt_alloc_test.cpp — Host-Test: MQTT-Befehle ohne Heap-Allokation
+//
+//   g++ -std=gnu++17 -Itools/host -I. tools/mqtt_alloc_test.cpp -o /tmp/mqtt_alloc_test && /tmp/mqtt_alloc_test
+//
+// Kompiliert MqttDispatch.h und Batch.h — denselben Code, den mqttCallback()
+// und stageBatch() in IkeaObegraensad.ino aufrufen — gegen die Stubs in
+// tools/host und schickt Frames, key:value- und JSON-Payloads durch
+// MqttDispatch::handle(). Ersetzt sind nur die Seiteneffekte, die der Sketch
+// liefert (Effekt starten, persistieren, Batch übernehmen), und eine kleine
+// Schema-Tabelle mit je einem Feld pro Typ statt CONFIG_SCHEMA.
+// malloc/calloc/realloc werden gezählt (glibc; operator new landet ebenfalls
+// dort). Jede Nachricht muss 0 Allokationen haben, sonst Exit-Code 1.
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <cstdio>
+
+#include "../MqttDispatch.h"
+#include "../Batch.h"
+
+// --- Allokationen zählen ---
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+
+static size_t allocations = 0;
+
+extern "C" void* malloc(size_t n) { allocations++; return __libc_malloc(n); }
+extern "C" void* calloc(size_t n, size_t m) { allocations++; return __libc_calloc(n, m); }
+extern "C" void* realloc(void* p, size_t n) { allocations++; return __libc_realloc(p, n); }
+
+// --- Zustand des Sketches ---
+
+using namespace ConfigSchema;
+
+const uint16_t PWM_MAX = 1023;
+void effectStub() {}
+void drawStub(uint8_t*) {}
+Effect clockEffect = {effectStub, drawStub, "clock"};
+Effect snakeEffect = {effectStub, drawStub, "snake"};
+Effect rainEffect = {effectStub, drawStub, "rain"};
+
+constexpr EffectRegistry::Entry EFFECTS[] = {
+  {"clock", &clockEffect},
+  {"snake", &snakeEffect},
+  {"rain",  &rainEffect},
+};
+constexpr size_t effectCount = sizeof(EFFECTS) / sizeof(EFFECTS[0]);
+constexpr auto EFFECT_HASH = EffectRegistry::buildHash<EffectRegistry::tableSize(effectCount)>(EFFECTS);
+static_assert(EFFECT_HASH.ok, "effect hash");
+
+bool displayEnabled = true;
+bool autoBrightnessEnabled = false;
+uint16_t brightness = 512;
+uint16_t g_clockDur = 10, g_tempDur = 5, g_humiDur = 5;
+float g_sensorTemp = NAN, g_sensorHumi = NAN;
+uint8_t currentEffectIndex = 0;
+char tzString[64] = "CET-1CEST-2,M3.5.0/02,M10.5.0/03";
+char mqttBaseTopic[32] = "ikeaclock";
+bool haDiscoveryPending = false;
+
+const Field CONFIG_SCHEMA[] = {
+  {"brightness",     nullptr,                 TYPE_U16,    GROUP_BRIGHTNESS, FLAG_BATCH | FLAG_CLAMP, &brightness,            0,                0,  2,  0, PWM_MAX, 512, nullptr, nullptr},
+  {"autoBrightness", "autoBrightnessEnabled", TYPE_BOOL,   GROUP_BRIGHTNESS, FLAG_BATCH,              &autoBrightnessEnabled, 0,                2,  1,  0, 1,       0,   nullptr, nullptr},
+  {"tz",             "timezone",              TYPE_STRING, GROUP_BRIGHTNESS, FLAG_BATCH,              tzString,               sizeof(tzString), 3,  64, 0, 0,       0,   "",      nullptr},
+  {"clockDur",       nullptr,                 TYPE_U16,    GROUP_SLIDES,     FLAG_BATCH,              &g_clockDur,            0,                67, 2,  1, 3600,    10,  nullptr, nullptr},
+};
+const uint8_t CONFIG_SCHEMA_COUNT = sizeof(CONFIG_SCHEMA) / sizeof(CONFIG_SCHEMA[0]);
+
+Batch::Pending<CONFIG_SCHEMA_COUNT> pendingBatch = {};
+
+// --- Seiteneffekte des Sketches (nur gezählt) ---
+
+int changes = 0;
+int persists = 0;
+int batchesApplied = 0;
+
+bool applyEffect(uint8_t idx) {
+  if (idx >= effectCount) return false;
+  currentEffectIndex = idx;
+  return true;
+}
+
+int8_t findEffectIndexByName(const char* name, size_t len) {
+  return EffectRegistry::find(EFFECT_HASH, EFFECTS, name, len);
+}
+
+int8_t findEffectIndexByName(const char* name) {
+  return findEffectIndexByName(name, strlen(name));
+}
+
+const char* effectName(uint8_t idx) { return EFFECTS[idx].name; }
+void persistBrightnessToStorage() { persists++; }
+void persistSlideConfig() { persists++; }
+void markStateChanged() { changes++; }
+
+void applyPendingBatch() {
+  pendingBatch.pending = false;
+  batchesApplied++;
+}
+
+const char* stageBatch(const char* json, size_t len, const char* source, const char*& errorField) {
+  return Batch::stage(CONFIG_SCHEMA, pendingBatch, json, len, source, errorField);
+}
+
+struct Case {
+  const char* topic;
+  const char* payload;
+  size_t len;  // 0 = strlen(payload)
+};
+
+// Ein 32-Byte-Frame (Schachbrett)
+const char FRAME[] =
+  "\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55"
+  "\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55\xAA\x55";
+
+const Case CASES[] = {
+  {"ikeaclock/frame", FRAME, 32},
+  {"ikeaclock/frame", FRAME, 31},
+  {"ikeaclock/cmd", "display:off"},
+  {"ikeaclock/cmd", "display:on"},
+  {"ikeaclock/cmd", "  brightness : 300 "},
+  {"ikeaclock/cmd", "effect:snake"},
+  {"ikeaclock/cmd", "EFFECT:Clock"},
+  {"ikeaclock/cmd", "effect:a-very-long-effect-name-that-does-not-exist-anywhere"},
+  {"ikeaclock/cmd", "autobrightness:on"},
+  {"ikeaclock/cmd", "temp:21.5"},
+  {"ikeaclock/cmd", "humi:45.25"},
+  {"ikeaclock/cmd", "clockdur:15"},
+  {"ikeaclock/cmd", "tempdur:7"},
+  {"ikeaclock/cmd", "humidur:7"},
+  {"ikeaclock/cmd", "an-unknown-but-rather-long-key-for-the-log-line:1"},
+  {"ikeaclock/cmd", "no separator here"},
+  {"ikeaclock/cmd", "{\"brightness\":300,\"effect\":\"clock\",\"display\":true}"},
+  {"ikeaclock/cmd", "{\"temp\":21.5,\"humi\":40.2,\"tz\":\"CET-1CEST-2,M3.5.0/02,M10.5.0/03\",\"clockDur\":12}"},
+  {"ikeaclock/cmd", "{\"autoBrightness\":true,\"brightness\":5000}"},
+  {"ikeaclock/cmd", "{\"display\":tru"},
+  {"ikeaclock/cmd", "{\"nosuchkey\":1}"},
+  {"ikeaclock/cmd", "{\"clockDur\":99999,\"aVeryLongUnknownKeyNameForTheLog\":1}"},
+  {"homeassistant/status", "online"},
+};
+
+int main() {
+  const size_t caseCount = sizeof(CASES) / sizeof(CASES[0]);
+  uint8_t buf[256];
+  int failures = 0;
+  // Zwei Durchläufe: der erste fängt einmalige Initialisierungen ab,
+  // gezählt wird der zweite
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t i = 0; i < caseCount; i++) {
+      size_t len = CASES[i].len ? CASES[i].len : strlen(CASES[i].payload);
+      memcpy(buf, CASES[i].payload, len);
+      size_t before = allocations;
+      MqttDispatch::handle(CASES[i].topic, buf, len);
+      size_t used = allocations - before;
+      if (pass == 0) continue;
+      printf("%-4s %zu alloc  %-20s %s\n", used ? "FAIL" : "ok", used, CASES[i].topic,
+             CASES[i].len ? "(binary)" : CASES[i].payload);
+      if (used) failures++;
+    }
+  }
+
+  // Stichproben: der Code des Sketches ist wirklich gelaufen
+  auto expect = [&](bool ok, const char* what) {
+    if (ok) return;
+    printf("FAIL %s\n", what);
+    failures++;
+  };
+  expect(MqttFrames::received == 2 && MqttFrames::rejected == 2, "frames received/rejected");
+  expect(haDiscoveryPending, "HA birth message");
+  expect(g_humiDur == 7 && g_sensorHumi == 45.25f, "key:value applied");
+  expect(batchesApplied == 6, "valid batches staged, each applied before the next");
+  expect(!pendingBatch.pending, "invalid batch not staged");
+  expect(changes > 0 && persists > 0, "state changed and persisted");
+
+  printf("%zu messages, %d failures\n", caseCount, failures);
+  return failures ? 1 : 0;
+}